@@ -251,6 +251,10 @@
 #include <cmath>
 #include <cstring>
 #include <cstdlib>
+#include <vector>
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
 #if HALF_ENABLE_CPP11_TYPE_TRAITS
 	#include <type_traits>
 #endif
@@ -281,6 +285,47 @@
 	#include <immintrin.h>
 #endif
 
+#ifndef HALF_ENABLE_AVX2_INTRINSICS
+	/// Enable AVX2 instruction set intrinsics.
+	/// Defining this to 1 enables the use of [AVX2 compiler intrinsics](https://en.wikipedia.org/wiki/Advanced_Vector_Extensions#AVX2) 
+	/// for the vectorized integer implementations of the arithmetic operations on arrays, processing 8 values at once instead of the 4 
+	/// of the [SSE2 implementation](\ref HALF_ENABLE_SSE2_INTRINSICS). This will not perform additional checks for support of the AVX2 
+	/// instruction set, so an appropriate target platform is required when enabling this feature. It also requires SSE2 to be enabled.
+	///
+	/// Unless predefined it will be enabled automatically when the `__AVX2__` symbol is defined, which some compilers do on supporting platforms.
+	#define HALF_ENABLE_AVX2_INTRINSICS __AVX2__
+#endif
+#ifndef HALF_ENABLE_SSE2_INTRINSICS
+	/// Enable SSE2 instruction set intrinsics.
+	/// Defining this to 1 enables the use of [SSE2 compiler intrinsics](https://en.wikipedia.org/wiki/SSE2) for vectorized integer 
+	/// implementations of the arithmetic operations on arrays. These follow the same algorithms as the scalar operators for 4 values 
+	/// at once and thus compute the exact same results and exceptions, but don't require the F16C instruction set. This will not 
+	/// perform additional checks for support of the SSE2 instruction set, so an appropriate target platform is required when enabling 
+	/// this feature.
+	///
+	/// Unless predefined it will be enabled automatically when the `__SSE2__` symbol is defined, which some compilers do on supporting platforms.
+	#define HALF_ENABLE_SSE2_INTRINSICS (__SSE2__||HALF_ENABLE_AVX2_INTRINSICS)
+#endif
+#if HALF_ENABLE_AVX2_INTRINSICS
+	#include <immintrin.h>
+#elif HALF_ENABLE_SSE2_INTRINSICS
+	#include <emmintrin.h>
+#endif
+
+#ifndef HALF_ENABLE_OPENMP
+	/// Enable OpenMP parallelization.
+	/// Defining this to 1 enables the use of [OpenMP](https://www.openmp.org) for distributing the matrix operations, like 
+	/// gemm(), and the pairwise and exact reductions of large arrays, like dot(), across multiple threads. This requires the 
+	/// compiler to support OpenMP and to be configured for it.
+	///
+	/// Unless predefined it will be enabled automatically when the `_OPENMP` symbol is defined, which compilers do when OpenMP 
+	/// support is enabled (e.g. with `-fopenmp`).
+	#define HALF_ENABLE_OPENMP _OPENMP
+#endif
+#if HALF_ENABLE_OPENMP
+	#include <omp.h>
+#endif
+
 #ifdef HALF_DOXYGEN_ONLY
 /// Type for internal floating-point computations.
 /// This can be predefined to a built-in floating-point type (`float`, `double` or `long double`) to override the internal 
@@ -289,6 +334,15 @@
 /// deviate from the specified half-precision rounding mode and inhibits proper detection of half-precision exceptions.
 #define HALF_ARITHMETIC_TYPE (undefined)
 
+/// Enable hybrid computation of mathematical functions.
+/// Defining this to 1 causes the correctly rounded mathematical functions (like exp(), log(), sin() or atanh()) to first 
+/// evaluate the corresponding double-precision function from `<cmath>` and to accept its result only if its error bound cannot 
+/// influence the half-precision rounding. Only the rare results too close to a representable value or a rounding midpoint fall 
+/// back to the exact internal implementation, thus results and exceptions are identical to the internal implementation, but 
+/// computed faster on most platforms. This requires the built-in double-precision math functions to be accurate to about 4000 
+/// ULP and will be ignored if #HALF_ARITHMETIC_TYPE is defined.
+#define HALF_HYBRID_MATH	0
+
 /// Enable internal exception flags.
 /// Defining this to 1 causes operations on half-precision values to raise internal floating-point exception flags according to 
 /// the IEEE 754 standard. These can then be cleared and checked with clearexcept(), testexcept().
@@ -433,6 +487,99 @@ namespace half_float
 {
 	class half;
 
+	/// Accuracy tiers for mathematical functions.
+	/// The mathematical functions based on iterative fixed-point algorithms are also provided in the [tiered](\ref tiered) 
+	/// namespace, taking one of these as template argument (e.g. `tiered::exp<accuracy_ulp2>(x)`) to reduce the number of 
+	/// iterations and thus trade accuracy for speed. The error bounds have been verified exhaustively over all arguments when 
+	/// rounding to nearest.
+	enum accuracy
+	{
+		accuracy_exact,		///< Exact to rounding, same as the functions without accuracy argument.
+		accuracy_ulp1,		///< At most 1 ULP off the correctly rounded result.
+		accuracy_ulp2,		///< At most 2 ULP off the correctly rounded result.
+		accuracy_ulp8		///< At most 8 ULP off the correctly rounded result, i.e. at least 8 correct bits.
+	};
+
+	/// Mathematical functions with selectable accuracy.
+	/// These are the mathematical functions based on iterative fixed-point algorithms, taking an [accuracy tier](\ref accuracy) 
+	/// as template argument. They live in their own namespace, so that the plain functions of the same name in the enclosing 
+	/// namespace can still be passed around as function pointers, and have to be called with explicit qualification, e.g. 
+	/// `half_float::tiered::exp<half_float::accuracy_ulp2>(x)`.
+	namespace tiered
+	{
+		template<accuracy> half exp(half);
+		template<accuracy> half exp2(half);
+		template<accuracy> half log(half);
+		template<accuracy> half log10(half);
+		template<accuracy> half log2(half);
+		template<accuracy> void sincos(half, half*, half*);
+		template<accuracy> half sin(half);
+		template<accuracy> half cos(half);
+		template<accuracy> half tan(half);
+		template<accuracy> half asin(half);
+		template<accuracy> half acos(half);
+		template<accuracy> half atan(half);
+		template<accuracy> half sinh(half);
+		template<accuracy> half cosh(half);
+		template<accuracy> half tanh(half);
+	}
+
+	/// Accumulation policies for reductions.
+	/// Reductions over arrays of half-precision values, like dot(), can take one of these as template argument (e.g. 
+	/// `dot<accumulate_exact>(x, y, n)`) to choose between speed and accuracy.
+	enum accumulation
+	{
+		accumulate_float,	///< Accumulate in single-precision with multiple partial sums in unspecified order.
+		accumulate_exact,	///< Accumulate exactly and round only the final result, independent of order.
+		accumulate_pairwise	///< Accumulate in single-precision in a fixed tree, independent of the number of threads.
+	};
+
+	/// Storage orders for matrices.
+	/// The matrix operations, like gemm(), take one of these to specify how the elements of their matrix arguments are 
+	/// stored, with the leading dimension being the distance between consecutive rows or columns, respectively.
+	enum matrix_layout
+	{
+		row_major,			///< Elements of each row are stored contiguously.
+		column_major		///< Elements of each column are stored contiguously.
+	};
+
+	/// Transposition of matrix operands.
+	enum matrix_transpose
+	{
+		no_transpose,		///< Use matrix as stored.
+		transpose			///< Use transpose of stored matrix.
+	};
+
+	/// Padding of convolution inputs.
+	/// The convolutions, like conv2d(), take one of these to specify how many zeros are implicitly added around the input.
+	enum convolution_padding
+	{
+		valid_padding,		///< No padding, so the kernel stays inside the input.
+		same_padding		///< Pad evenly for `ceil(n/stride)` outputs, with the extra zero at the end if odd.
+	};
+
+	/// Rounding of half-precision weight copies.
+	/// The optimizer steps, like adam_step(), take one of these to specify how the updated single-precision master weights 
+	/// are rounded to their half-precision copies.
+	enum weight_rounding
+	{
+		nearest_rounding,		///< Round like conversions to half-precision.
+		stochastic_rounding		///< Round away from zero with probability of the discarded fraction of the last place.
+	};
+
+	/// Numbers of values per class.
+	/// This is returned by count_classes(). The numbers of zeros, subnormals, normals, infinities and NaNs add up to the 
+	/// number of values, the number of negative values is counted independently of them.
+	struct class_counts
+	{
+		std::size_t zero;			///< Number of positive and negative zeros.
+		std::size_t subnormal;		///< Number of subnormal values.
+		std::size_t normal;			///< Number of normal values.
+		std::size_t infinite;		///< Number of positive and negative infinities.
+		std::size_t nan;			///< Number of NaNs.
+		std::size_t negative;		///< Number of values with the sign bit set, including negative zeros and NaNs.
+	};
+
 #if HALF_ENABLE_CPP11_USER_LITERALS
 	/// Library-defined half-precision literals.
 	/// Import this namespace to enable half-precision floating-point literals:
@@ -481,6 +628,14 @@ namespace half_float
 		template<> struct is_float<long double> : true_type {};
 	#endif
 
+		/// Tag for pairwise accumulation.
+		struct pairwise_type {};
+
+		/// Tag for accumulation policy.
+		/// \tparam A accumulation policy
+		template<accumulation A> struct accumulation_type { typedef bool_type<A==accumulate_exact> type; };
+		template<> struct accumulation_type<accumulate_pairwise> { typedef pairwise_type type; };
+
 		/// Type traits for floating-point bits.
 		template<typename T> struct bits { typedef unsigned char type; };
 		template<typename T> struct bits<const T> : bits<T> {};
@@ -611,6 +766,60 @@ namespace half_float
 		#endif
 		}
 
+		/// Platform-independent count of leading zeros.
+		/// \param arg non-zero 32-bit integer value
+		/// \return number of leading zero bits in the 32-bit representation of \a arg
+		inline unsigned int clz(uint32 arg)
+		{
+		#if (defined(__GNUC__) || defined(__clang__)) && UINT_MAX == 0xFFFFFFFF
+			return __builtin_clz(static_cast<unsigned int>(arg));
+		#elif defined(_MSC_VER)
+			unsigned long i;
+			_BitScanReverse(&i, static_cast<unsigned long>(arg));
+			return 31 - i;
+		#else
+			unsigned int n = 0;
+			if(!(arg&0xFFFF0000))
+				arg <<= 16, n += 16;
+			if(!(arg&0xFF000000))
+				arg <<= 8, n += 8;
+			if(!(arg&0xF0000000))
+				arg <<= 4, n += 4;
+			if(!(arg&0xC0000000))
+				arg <<= 2, n += 2;
+			return n + !(arg&0x80000000);
+		#endif
+		}
+
+		/// Normalize mantissa.
+		/// This shifts the mantissa left until bit \a B is set, in a single step.
+		/// \tparam B index of leading bit after normalization
+		/// \tparam T integer type of mantissa
+		/// \param m non-zero mantissa to normalize, not shifted if already not smaller than 2^\a B
+		/// \return number of bits \a m was shifted
+		template<unsigned int B,typename T> int normalize(T &m)
+		{
+			int i = (m>>B) ? 0 : (static_cast<int>(clz(static_cast<uint32>(m)))-static_cast<int>(31-B));
+			m <<= i;
+			return i;
+		}
+
+		/// Normalize mantissa with bounded shift.
+		/// This shifts the mantissa left until bit \a B is set or it was shifted by \a n bits, in a single step.
+		/// \tparam B index of leading bit after normalization
+		/// \tparam T integer type of mantissa
+		/// \param m mantissa to normalize
+		/// \param n maximum number of bits to shift, unbounded if negative
+		/// \return number of bits \a m was shifted
+		template<unsigned int B,typename T> int normalize(T &m, int n)
+		{
+			unsigned int i = !m ? static_cast<unsigned>(n) : (m>>B) ? 0U : (clz(static_cast<uint32>(m))-(31-B));
+			if(i > static_cast<unsigned>(n))
+				i = n;
+			m <<= i;
+			return i;
+		}
+
 		/// \}
 		/// \name Error handling
 		/// \{
@@ -890,7 +1099,7 @@ namespace half_float
 				sign = msign & 0x8000;
 			}
 			if(N)
-				for(; m<(static_cast<uint32>(1)<<F) && exp; m<<=1,--exp) ;
+				exp -= normalize<F>(m, exp);
 			else if(exp < 0)
 				return rounded<R,I>(sign+(m>>(F-10-exp)), (m>>(F-11-exp))&1, s|((m&((static_cast<uint32>(1)<<(F-11-exp))-1))!=0));
 			return rounded<R,I>(sign+(exp<<10)+(m>>(F-10)), (m>>(F-11))&1, s|((m&((static_cast<uint32>(1)<<(F-11))-1))!=0));
@@ -1082,9 +1291,9 @@ namespace half_float
 				value = -value;
 			if(value > 0xFFFF)
 				return overflow<R>(bits);
-			unsigned int m = static_cast<unsigned int>(value), exp = 24;
-			for(; m<0x400; m<<=1,--exp) ;
-			for(; m>0x7FF; m>>=1,++exp) ;
+			unsigned int m = static_cast<unsigned int>(value);
+			int i = 21 - static_cast<int>(clz(m)), exp = 24 + i;
+			m = (i<0) ? (m<<-i) : (m>>i);
 			bits |= (exp<<10) + m;
 			return (exp>24) ? rounded<R,false>(bits, (value>>(exp-25))&1, (((1<<(exp-25))-1)&value)!=0) : bits;
 		}
@@ -1104,7 +1313,7 @@ namespace half_float
 			if(abs)
 			{
 				fbits |= 0x38000000 << static_cast<unsigned>(abs>=0x7C00);
-				for(; abs<0x400; abs<<=1,fbits-=0x800000) ;
+				fbits -= normalize<10>(abs) * 0x800000;
 				fbits += static_cast<bits<float>::type>(abs) << 13;
 			}
 		#else
@@ -1266,7 +1475,7 @@ namespace half_float
 			if(abs)
 			{
 				hi |= 0x3F000000 << static_cast<unsigned>(abs>=0x7C00);
-				for(; abs<0x400; abs<<=1,hi-=0x100000) ;
+				hi -= normalize<10>(abs) * 0x100000;
 				hi += static_cast<uint32>(abs) << 10;
 			}
 			bits<double>::type dbits = static_cast<bits<double>::type>(hi) << 32;
@@ -1399,6 +1608,157 @@ namespace half_float
 		#endif
 		}
 
+		/// Divide by half-precision mantissa.
+		/// This uses a table of truncated reciprocals and a single correction step instead of an actual integer division.
+		/// \param x dividend, less than 2^23
+		/// \param y divisor with implicit bit, in [0x400,0x7FF]
+		/// \param s variable to store sticky bit for rounding
+		/// \return \a x / \a y rounded towards zero
+		inline uint32 divide_mantissa(uint32 x, uint32 y, int &s)
+		{
+			static const uint32 reciprocal_table[1024] = {
+				0xFFFFFFFF, 0xFFC00FFC, 0xFF803FE0, 0xFF408F94, 0xFF00FF00, 0xFEC18E0E, 0xFE823CA5, 0xFE430AAD,
+				0xFE03F80F, 0xFDC504B5, 0xFD863086, 0xFD477B6C, 0xFD08E550, 0xFCCA6E1A, 0xFC8C15B4, 0xFC4DDC06,
+				0xFC0FC0FC, 0xFBD1C47C, 0xFB93E672, 0xFB5626C7, 0xFB188565, 0xFADB0234, 0xFA9D9D1F, 0xFA605611,
+				0xFA232CF2, 0xF9E621AD, 0xF9A9342C, 0xF96C645A, 0xF92FB221, 0xF8F31D6A, 0xF8B6A622, 0xF87A4C31,
+				0xF83E0F83, 0xF801F003, 0xF7C5ED9C, 0xF78A0838, 0xF74E3FC2, 0xF7129425, 0xF6D7054D, 0xF69B9325,
+				0xF6603D98, 0xF6250491, 0xF5E9E7FC, 0xF5AEE7C4, 0xF57403D5, 0xF5393C1B, 0xF4FE9082, 0xF4C400F4,
+				0xF4898D5F, 0xF44F35AE, 0xF414F9CD, 0xF3DAD9A8, 0xF3A0D52C, 0xF366EC45, 0xF32D1EDF, 0xF2F36CE6,
+				0xF2B9D648, 0xF2805AF0, 0xF246FACB, 0xF20DB5C6, 0xF1D48BCE, 0xF19B7CD0, 0xF16288B8, 0xF129AF74,
+				0xF0F0F0F0, 0xF0B84D1B, 0xF07FC3E0, 0xF047552D, 0xF00F00F0, 0xEFD6C715, 0xEF9EA78B, 0xEF66A240,
+				0xEF2EB71F, 0xEEF6E618, 0xEEBF2F18, 0xEE87920D, 0xEE500EE5, 0xEE18A58D, 0xEDE155F3, 0xEDAA2007,
+				0xED7303B5, 0xED3C00ED, 0xED05179C, 0xECCE47B0, 0xEC979118, 0xEC60F3C3, 0xEC2A6FA0, 0xEBF4049B,
+				0xEBBDB2A5, 0xEB8779AC, 0xEB51599F, 0xEB1B526C, 0xEAE56403, 0xEAAF8E52, 0xEA79D149, 0xEA442CD7,
+				0xEA0EA0EA, 0xE9D92D71, 0xE9A3D25E, 0xE96E8F9D, 0xE939651F, 0xE90452D4, 0xE8CF58AA, 0xE89A7692,
+				0xE865AC7B, 0xE830FA54, 0xE7FC600E, 0xE7C7DD98, 0xE79372E2, 0xE75F1FDB, 0xE72AE475, 0xE6F6C09E,
+				0xE6C2B448, 0xE68EBF61, 0xE65AE1DB, 0xE6271BA5, 0xE5F36CB0, 0xE5BFD4EC, 0xE58C5449, 0xE558EAB9,
+				0xE525982A, 0xE4F25C8F, 0xE4BF37D8, 0xE48C29F5, 0xE45932D7, 0xE426526F, 0xE3F388AE, 0xE3C0D584,
+				0xE38E38E3, 0xE35BB2BB, 0xE32942FE, 0xE2F6E99D, 0xE2C4A688, 0xE29279B1, 0xE260630A, 0xE22E6283,
+				0xE1FC780E, 0xE1CAA39C, 0xE198E51F, 0xE1673C88, 0xE135A9C9, 0xE1042CD3, 0xE0D2C599, 0xE0A1740B,
+				0xE070381C, 0xE03F11BC, 0xE00E00E0, 0xDFDD0577, 0xDFAC1F74, 0xDF7B4EC9, 0xDF4A9368, 0xDF19ED43,
+				0xDEE95C4C, 0xDEB8E076, 0xDE8879B2, 0xDE5827F3, 0xDE27EB2C, 0xDDF7C34E, 0xDDC7B04C, 0xDD97B218,
+				0xDD67C8A6, 0xDD37F3E6, 0xDD0833CD, 0xDCD8884D, 0xDCA8F158, 0xDC796EE2, 0xDC4A00DC, 0xDC1AA73A,
+				0xDBEB61EE, 0xDBBC30EC, 0xDB8D1427, 0xDB5E0B91, 0xDB2F171D, 0xDB0036C0, 0xDAD16A6A, 0xDAA2B211,
+				0xDA740DA7, 0xDA457D1F, 0xDA17006D, 0xD9E89783, 0xD9BA4256, 0xD98C00D9, 0xD95DD2FF, 0xD92FB8BC,
+				0xD901B203, 0xD8D3BEC8, 0xD8A5DEFE, 0xD878129A, 0xD84A598E, 0xD81CB3CF, 0xD7EF2151, 0xD7C1A207,
+				0xD79435E5, 0xD766DCDE, 0xD73996E8, 0xD70C63F6, 0xD6DF43FC, 0xD6B236EE, 0xD6853CC0, 0xD6585567,
+				0xD62B80D6, 0xD5FEBF01, 0xD5D20FDE, 0xD5A57360, 0xD578E97C, 0xD54C7225, 0xD5200D52, 0xD4F3BAF4,
+				0xD4C77B03, 0xD49B4D71, 0xD46F3234, 0xD4432940, 0xD4173289, 0xD3EB4E05, 0xD3BF7BA8, 0xD393BB67,
+				0xD3680D36, 0xD33C710B, 0xD310E6DA, 0xD2E56E98, 0xD2BA083B, 0xD28EB3B6, 0xD2637100, 0xD238400D,
+				0xD20D20D2, 0xD1E21344, 0xD1B71758, 0xD18C2D05, 0xD161543E, 0xD1368CF9, 0xD10BD72B, 0xD0E132CA,
+				0xD0B69FCB, 0xD08C1E24, 0xD061ADC9, 0xD0374EB0, 0xD00D00D0, 0xCFE2C41C, 0xCFB8988B, 0xCF8E7E13,
+				0xCF6474A8, 0xCF3A7C41, 0xCF1094D3, 0xCEE6BE55, 0xCEBCF8BB, 0xCE9343FB, 0xCE69A00C, 0xCE400CE4,
+				0xCE168A77, 0xCDED18BC, 0xCDC3B7A9, 0xCD9A6734, 0xCD712752, 0xCD47F7FB, 0xCD1ED923, 0xCCF5CAC2,
+				0xCCCCCCCC, 0xCCA3DF39, 0xCC7B01FF, 0xCC523513, 0xCC29786C, 0xCC00CC00, 0xCBD82FC6, 0xCBAFA3B4,
+				0xCB8727C0, 0xCB5EBBE1, 0xCB36600C, 0xCB0E1439, 0xCAE5D85F, 0xCABDAC72, 0xCA95906B, 0xCA6D8440,
+				0xCA4587E6, 0xCA1D9B56, 0xC9F5BE85, 0xC9CDF16A, 0xC9A633FC, 0xC97E8632, 0xC956E803, 0xC92F5964,
+				0xC907DA4E, 0xC8E06AB7, 0xC8B90A95, 0xC891B9E1, 0xC86A7890, 0xC8434699, 0xC81C23F5, 0xC7F51099,
+				0xC7CE0C7C, 0xC7A71797, 0xC78031E0, 0xC7595B4D, 0xC73293D7, 0xC70BDB74, 0xC6E5321C, 0xC6BE97C6,
+				0xC6980C69, 0xC6718FFC, 0xC64B2278, 0xC624C3D2, 0xC5FE7403, 0xC5D83301, 0xC5B200C5, 0xC58BDD46,
+				0xC565C87B, 0xC53FC25C, 0xC519CAE0, 0xC4F3E1FE, 0xC4CE07B0, 0xC4A83BEB, 0xC4827EA8, 0xC45CCFDE,
+				0xC4372F85, 0xC4119D95, 0xC3EC1A05, 0xC3C6A4CD, 0xC3A13DE6, 0xC37BE546, 0xC3569AE5, 0xC3315EBC,
+				0xC30C30C3, 0xC2E710F0, 0xC2C1FF3D, 0xC29CFBA0, 0xC2780613, 0xC2531E8D, 0xC22E4506, 0xC2097976,
+				0xC1E4BBD5, 0xC1C00C1C, 0xC19B6A41, 0xC176D63F, 0xC152500C, 0xC12DD7A0, 0xC1096CF5, 0xC0E51003,
+				0xC0C0C0C0, 0xC09C7F27, 0xC0784B2E, 0xC05424D0, 0xC0300C03, 0xC00C00C0, 0xBFE802FF, 0xBFC412BA,
+				0xBFA02FE8, 0xBF7C5A81, 0xBF58927F, 0xBF34D7DA, 0xBF112A8A, 0xBEED8A88, 0xBEC9F7CD, 0xBEA67250,
+				0xBE82FA0B, 0xBE5F8EF7, 0xBE3C310B, 0xBE18E041, 0xBDF59C91, 0xBDD265F4, 0xBDAF3C63, 0xBD8C1FD6,
+				0xBD691047, 0xBD460DAD, 0xBD231802, 0xBD002F40, 0xBCDD535D, 0xBCBA8454, 0xBC97C21E, 0xBC750CB2,
+				0xBC52640B, 0xBC2FC821, 0xBC0D38EE, 0xBBEAB669, 0xBBC8408C, 0xBBA5D751, 0xBB837AB0, 0xBB612AA2,
+				0xBB3EE721, 0xBB1CB026, 0xBAFA85A9, 0xBAD867A4, 0xBAB65610, 0xBA9450E6, 0xBA725820, 0xBA506BB6,
+				0xBA2E8BA2, 0xBA0CB7DE, 0xB9EAF062, 0xB9C93528, 0xB9A7862A, 0xB985E35F, 0xB9644CC3, 0xB942C24E,
+				0xB92143FA, 0xB8FFD1C0, 0xB8DE6B99, 0xB8BD117F, 0xB89BC36C, 0xB87A8159, 0xB8594B40, 0xB838211A,
+				0xB81702E0, 0xB7F5F08C, 0xB7D4EA19, 0xB7B3EF7E, 0xB79300B7, 0xB7721DBC, 0xB7514688, 0xB7307B14,
+				0xB70FBB5A, 0xB6EF0753, 0xB6CE5EF9, 0xB6ADC246, 0xB68D3134, 0xB66CABBC, 0xB64C31D8, 0xB62BC383,
+				0xB60B60B6, 0xB5EB096A, 0xB5CABD9A, 0xB5AA7D40, 0xB58A4855, 0xB56A1ED3, 0xB54A00B5, 0xB529EDF4,
+				0xB509E68A, 0xB4E9EA72, 0xB4C9F9A4, 0xB4AA141C, 0xB48A39D4, 0xB46A6AC4, 0xB44AA6E9, 0xB42AEE3A,
+				0xB40B40B4, 0xB3EB9E4F, 0xB3CC0705, 0xB3AC7AD2, 0xB38CF9B0, 0xB36D8397, 0xB34E1883, 0xB32EB86E,
+				0xB30F6352, 0xB2F01929, 0xB2D0D9EE, 0xB2B1A59B, 0xB2927C29, 0xB2735D94, 0xB25449D6, 0xB23540E9,
+				0xB21642C8, 0xB1F74F6C, 0xB1D866D1, 0xB1B988F0, 0xB19AB5C4, 0xB17BED47, 0xB15D2F75, 0xB13E7C47,
+				0xB11FD3B8, 0xB10135C2, 0xB0E2A260, 0xB0C4198C, 0xB0A59B41, 0xB087277A, 0xB068BE30, 0xB04A5F60,
+				0xB02C0B02, 0xB00DC113, 0xAFEF818B, 0xAFD14C67, 0xAFB321A1, 0xAF950133, 0xAF76EB18, 0xAF58DF4B,
+				0xAF3ADDC6, 0xAF1CE685, 0xAEFEF981, 0xAEE116B6, 0xAEC33E1F, 0xAEA56FB6, 0xAE87AB76, 0xAE69F15A,
+				0xAE4C415C, 0xAE2E9B78, 0xAE10FFA8, 0xADF36DE8, 0xADD5E632, 0xADB86880, 0xAD9AF4CF, 0xAD7D8B18,
+				0xAD602B58, 0xAD42D587, 0xAD2589A3, 0xAD0847A5, 0xACEB0F89, 0xACCDE149, 0xACB0BCE1, 0xAC93A24B,
+				0xAC769184, 0xAC598A84, 0xAC3C8D49, 0xAC1F99CD, 0xAC02B00A, 0xABE5CFFD, 0xABC8F9A0, 0xABAC2CEE,
+				0xAB8F69E2, 0xAB72B078, 0xAB5600AB, 0xAB395A76, 0xAB1CBDD3, 0xAB002AC0, 0xAAE3A135, 0xAAC72130,
+				0xAAAAAAAA, 0xAA8E3DA0, 0xAA71DA0C, 0xAA557FEA, 0xAA392F35, 0xAA1CE7E9, 0xAA00AA00, 0xA9E47576,
+				0xA9C84A47, 0xA9AC286E, 0xA9900FE5, 0xA97400A9, 0xA957FAB5, 0xA93BFE04, 0xA9200A92, 0xA9042059,
+				0xA8E83F57, 0xA8CC6785, 0xA8B098E0, 0xA894D362, 0xA8791708, 0xA85D63CD, 0xA841B9AC, 0xA82618A1,
+				0xA80A80A8, 0xA7EEF1BB, 0xA7D36BD7, 0xA7B7EEF7, 0xA79C7B16, 0xA7811031, 0xA765AE43, 0xA74A5547,
+				0xA72F0539, 0xA713BE15, 0xA6F87FD6, 0xA6DD4A78, 0xA6C21DF6, 0xA6A6FA4D, 0xA68BDF78, 0xA670CD73,
+				0xA655C439, 0xA63AC3C6, 0xA61FCC16, 0xA604DD24, 0xA5E9F6ED, 0xA5CF196C, 0xA5B4449C, 0xA599787A,
+				0xA57EB502, 0xA563FA2F, 0xA54947FD, 0xA52E9E68, 0xA513FD6B, 0xA4F96503, 0xA4DED52C, 0xA4C44DE0,
+				0xA4A9CF1D, 0xA48F58DE, 0xA474EB1F, 0xA45A85DB, 0xA4402910, 0xA425D4B8, 0xA40B88CF, 0xA3F14552,
+				0xA3D70A3D, 0xA3BCD78B, 0xA3A2AD39, 0xA3888B42, 0xA36E71A2, 0xA3546056, 0xA33A575A, 0xA32056A9,
+				0xA3065E3F, 0xA2EC6E19, 0xA2D28633, 0xA2B8A688, 0xA29ECF16, 0xA284FFD7, 0xA26B38C8, 0xA25179E5,
+				0xA237C32B, 0xA21E1494, 0xA2046E1F, 0xA1EACFC5, 0xA1D13985, 0xA1B7AB59, 0xA19E253F, 0xA184A732,
+				0xA16B312E, 0xA151C330, 0xA1385D34, 0xA11EFF36, 0xA105A932, 0xA0EC5B25, 0xA0D3150B, 0xA0B9D6E0,
+				0xA0A0A0A0, 0xA0877248, 0xA06E4BD4, 0xA0552D40, 0xA03C1688, 0xA02307A9, 0xA00A00A0, 0x9FF10167,
+				0x9FD809FD, 0x9FBF1A5D, 0x9FA63283, 0x9F8D526C, 0x9F747A15, 0x9F5BA979, 0x9F42E095, 0x9F2A1F65,
+				0x9F1165E7, 0x9EF8B415, 0x9EE009EE, 0x9EC7676C, 0x9EAECC8D, 0x9E96394D, 0x9E7DADA8, 0x9E65299C,
+				0x9E4CAD23, 0x9E34383C, 0x9E1BCAE2, 0x9E036512, 0x9DEB06C9, 0x9DD2B002, 0x9DBA60BB, 0x9DA218F0,
+				0x9D89D89D, 0x9D719FC0, 0x9D596E54, 0x9D414456, 0x9D2921C3, 0x9D110698, 0x9CF8F2D1, 0x9CE0E66A,
+				0x9CC8E160, 0x9CB0E3B1, 0x9C98ED57, 0x9C80FE51, 0x9C69169B, 0x9C513631, 0x9C395D10, 0x9C218B34,
+				0x9C09C09C, 0x9BF1FD42, 0x9BDA4124, 0x9BC28C3E, 0x9BAADE8E, 0x9B93380F, 0x9B7B98BF, 0x9B64009B,
+				0x9B4C6F9E, 0x9B34E5C7, 0x9B1D6311, 0x9B05E779, 0x9AEE72FC, 0x9AD70598, 0x9ABF9F48, 0x9AA84009,
+				0x9A90E7D9, 0x9A7996B4, 0x9A624C96, 0x9A4B097E, 0x9A33CD67, 0x9A1C984E, 0x9A056A30, 0x99EE430B,
+				0x99D722DA, 0x99C0099C, 0x99A8F74B, 0x9991EBE7, 0x997AE76B, 0x9963E9D4, 0x994CF320, 0x9936034A,
+				0x991F1A51, 0x99083831, 0x98F15CE6, 0x98DA886F, 0x98C3BAC7, 0x98ACF3EC, 0x989633DB, 0x987F7A90,
+				0x9868C809, 0x98521C43, 0x983B773A, 0x9824D8EC, 0x980E4156, 0x97F7B074, 0x97E12644, 0x97CAA2C2,
+				0x97B425ED, 0x979DAFC0, 0x97874038, 0x9770D754, 0x975A750F, 0x97441968, 0x972DC45A, 0x971775E4,
+				0x97012E02, 0x96EAECB1, 0x96D4B1EE, 0x96BE7DB7, 0x96A85009, 0x969228E0, 0x967C083A, 0x9665EE14,
+				0x964FDA6C, 0x9639CD3D, 0x9623C686, 0x960DC643, 0x95F7CC72, 0x95E1D910, 0x95CBEC1A, 0x95B6058E,
+				0x95A02568, 0x958A4BA5, 0x95747843, 0x955EAB40, 0x9548E497, 0x95332447, 0x951D6A4D, 0x9507B6A6,
+				0x94F2094F, 0x94DC6245, 0x94C6C186, 0x94B1270F, 0x949B92DD, 0x948604EE, 0x94707D3E, 0x945AFBCC,
+				0x94458094, 0x94300B93, 0x941A9CC8, 0x9405342E, 0x93EFD1C5, 0x93DA7588, 0x93C51F75, 0x93AFCF8A,
+				0x939A85C4, 0x9385421F, 0x9370049B, 0x935ACD33, 0x93459BE6, 0x933070B1, 0x931B4B90, 0x93062C82,
+				0x92F11384, 0x92DC0092, 0x92C6F3AC, 0x92B1ECCD, 0x929CEBF4, 0x9287F11E, 0x9272FC48, 0x925E0D6F,
+				0x92492492, 0x923441AD, 0x921F64BE, 0x920A8DC3, 0x91F5BCB8, 0x91E0F19C, 0x91CC2C6C, 0x91B76D25,
+				0x91A2B3C4, 0x918E0048, 0x917952AE, 0x9164AAF3, 0x91500915, 0x913B6D10, 0x9126D6E4, 0x9112468D,
+				0x90FDBC09, 0x90E93755, 0x90D4B86E, 0x90C03F54, 0x90ABCC02, 0x90975E76, 0x9082F6AF, 0x906E94A9,
+				0x905A3863, 0x9045E1D9, 0x90319109, 0x901D45F2, 0x90090090, 0x8FF4C0E0, 0x8FE086E2, 0x8FCC5292,
+				0x8FB823EE, 0x8FA3FAF3, 0x8F8FD79F, 0x8F7BB9F0, 0x8F67A1E3, 0x8F538F77, 0x8F3F82A8, 0x8F2B7B74,
+				0x8F1779D9, 0x8F037DD5, 0x8EEF8765, 0x8EDB9687, 0x8EC7AB39, 0x8EB3C578, 0x8E9FE542, 0x8E8C0A94,
+				0x8E78356D, 0x8E6465C9, 0x8E509BA8, 0x8E3CD705, 0x8E2917E0, 0x8E155E36, 0x8E01AA04, 0x8DEDFB49,
+				0x8DDA5202, 0x8DC6AE2C, 0x8DB30FC6, 0x8D9F76CD, 0x8D8BE33F, 0x8D78551A, 0x8D64CC5B, 0x8D514901,
+				0x8D3DCB08, 0x8D2A5270, 0x8D16DF35, 0x8D037155, 0x8CF008CF, 0x8CDCA59F, 0x8CC947C4, 0x8CB5EF3C,
+				0x8CA29C04, 0x8C8F4E1A, 0x8C7C057C, 0x8C68C228, 0x8C55841C, 0x8C424B55, 0x8C2F17D2, 0x8C1BE98F,
+				0x8C08C08C, 0x8BF59CC5, 0x8BE27E39, 0x8BCF64E5, 0x8BBC50C8, 0x8BA941E0, 0x8B963829, 0x8B8333A2,
+				0x8B70344A, 0x8B5D3A1D, 0x8B4A4519, 0x8B37553E, 0x8B246A87, 0x8B1184F4, 0x8AFEA483, 0x8AEBC930,
+				0x8AD8F2FB, 0x8AC621E1, 0x8AB355E0, 0x8AA08EF5, 0x8A8DCD1F, 0x8A7B105D, 0x8A6858AA, 0x8A55A607,
+				0x8A42F870, 0x8A304FE3, 0x8A1DAC60, 0x8A0B0DE2, 0x89F87469, 0x89E5DFF3, 0x89D3507C, 0x89C0C605,
+				0x89AE4089, 0x899BC008, 0x8989447F, 0x8976CDED, 0x89645C4F, 0x8951EFA3, 0x893F87E8, 0x892D251B,
+				0x891AC73A, 0x89086E44, 0x88F61A37, 0x88E3CB0F, 0x88D180CD, 0x88BF3B6D, 0x88ACFAED, 0x889ABF4C,
+				0x88888888, 0x8876569F, 0x8864298E, 0x88520154, 0x883FDDF0, 0x882DBF5E, 0x881BA59D, 0x880990AC,
+				0x87F78087, 0x87E5752F, 0x87D36E9F, 0x87C16CD7, 0x87AF6FD5, 0x879D7797, 0x878B841A, 0x8779955D,
+				0x8767AB5F, 0x8755C61C, 0x8743E594, 0x873209C5, 0x872032AC, 0x870E6047, 0x86FC9296, 0x86EAC995,
+				0x86D90544, 0x86C745A0, 0x86B58AA7, 0x86A3D458, 0x869222B1, 0x868075B0, 0x866ECD53, 0x865D2998,
+				0x864B8A7D, 0x8639F002, 0x86285A23, 0x8616C8DF, 0x86053C34, 0x85F3B420, 0x85E230A3, 0x85D0B1B9,
+				0x85BF3761, 0x85ADC199, 0x859C5060, 0x858AE3B3, 0x85797B91, 0x856817F8, 0x8556B8E7, 0x85455E5B,
+				0x85340853, 0x8522B6CD, 0x851169C7, 0x85002140, 0x84EEDD35, 0x84DD9DA5, 0x84CC628F, 0x84BB2BF0,
+				0x84A9F9C8, 0x8498CC13, 0x8487A2D0, 0x84767DFE, 0x84655D9B, 0x845441A5, 0x84432A1B, 0x843216FA,
+				0x84210842, 0x840FFDEF, 0x83FEF802, 0x83EDF677, 0x83DCF94D, 0x83CC0083, 0x83BB0C17, 0x83AA1C07,
+				0x83993052, 0x838848F5, 0x837765F0, 0x83668740, 0x8355ACE3, 0x8344D6D9, 0x83340520, 0x832337B5,
+				0x83126E97, 0x8301A9C5, 0x82F0E93D, 0x82E02CFD, 0x82CF7503, 0x82BEC14F, 0x82AE11DD, 0x829D66AE,
+				0x828CBFBE, 0x827C1D0D, 0x826B7E99, 0x825AE460, 0x824A4E60, 0x8239BC99, 0x82292F07, 0x8218A5AB,
+				0x82082082, 0x81F79F8A, 0x81E722C2, 0x81D6AA28, 0x81C635BC, 0x81B5C57A, 0x81A55962, 0x8194F172,
+				0x81848DA8, 0x81742E04, 0x8163D282, 0x81537B23, 0x814327E3, 0x8132D8C2, 0x81228DBE, 0x811246D6,
+				0x81020408, 0x80F1C551, 0x80E18AB2, 0x80D15428, 0x80C121B2, 0x80B0F34E, 0x80A0C8FB, 0x8090A2B7,
+				0x80808080, 0x80706256, 0x80604836, 0x8050321F, 0x80402010, 0x80301206, 0x80200802, 0x80100200 };
+		#if HALF_ENABLE_CPP11_LONG_LONG
+			uint32 q = static_cast<uint32>((static_cast<unsigned long long>(x)*reciprocal_table[y-0x400])>>42);
+		#else
+			uint32 q = mulhi<std::round_toward_zero>(x<<9, reciprocal_table[y-0x400]) >> 19;
+		#endif
+			uint32 r = x - q*y;
+			if(r >= y)
+			{
+				++q;
+				r -= y;
+			}
+			return s = (r!=0), q;
+		}
+
 		/// Half precision positive modulus.
 		/// \tparam Q `true` to compute full quotient, `false` else
 		/// \tparam R `true` to compute signed remainder, `false` for positive remainder
@@ -1412,8 +1772,8 @@ namespace half_float
 			if(x > y)
 			{
 				int absx = x, absy = y, expx = 0, expy = 0;
-				for(; absx<0x400; absx<<=1,--expx) ;
-				for(; absy<0x400; absy<<=1,--expy) ;
+				expx -= normalize<10>(absx);
+				expy -= normalize<10>(absy);
 				expx += absx >> 10;
 				expy += absy >> 10;
 				int mx = (absx&0x3FF) | 0x400, my = (absy&0x3FF) | 0x400;
@@ -1442,7 +1802,7 @@ namespace half_float
 					if(!mx)
 						return *quo = q, 0;
 				}
-				for(; mx<0x400; mx<<=1,--expy) ;
+				expy -= normalize<10>(mx);
 				x = (expy>0) ? ((expy<<10)|(mx&0x3FF)) : (mx>>(1-expy));
 			}
 			if(R)
@@ -1462,7 +1822,7 @@ namespace half_float
 				{
 					int exp = (y>>10) + (y<=0x3FF), d = exp - (x>>10) - (x<=0x3FF);
 					int m = (((y&0x3FF)|((y>0x3FF)<<10))<<1) - (((x&0x3FF)|((x>0x3FF)<<10))<<(1-d));
-					for(; m<0x800 && exp>1; m<<=1,--exp) ;
+					exp -= normalize<11>(m, exp-1);
 					x = 0x8000 + ((exp-1)<<10) + (m>>1);
 					q += Q;
 				}
@@ -1496,6 +1856,18 @@ namespace half_float
 			return m;
 		}
 
+		/// Number of iterations for accuracy tier.
+		/// \tparam A accuracy tier to use
+		/// \param n number of iterations for exact results
+		/// \param n1 number of iterations for results at most 1 ULP off
+		/// \param n2 number of iterations for results at most 2 ULP off
+		/// \param n8 number of iterations for results at most 8 ULP off
+		/// \return number of iterations for \a A
+		template<accuracy A> HALF_CONSTEXPR unsigned int iterations(unsigned int n, unsigned int n1, unsigned int n2, unsigned int n8)
+		{
+			return (A==accuracy_ulp1) ? n1 : (A==accuracy_ulp2) ? n2 : (A==accuracy_ulp8) ? n8 : n;
+		}
+
 		/// Fixed point binary exponential.
 		/// This uses the BKM algorithm in E-mode.
 		/// \param m exponent in [0,1) as Q0.31
@@ -1627,12 +1999,12 @@ namespace half_float
 		inline std::pair<uint32,uint32> atan2_args(unsigned int abs)
 		{
 			int exp = -15;
-			for(; abs<0x400; abs<<=1,--exp) ;
+			exp -= normalize<10>(abs);
 			exp += abs >> 10;
 			uint32 my = ((abs&0x3FF)|0x400) << 5, r = my * my;
 			int rexp = 2 * exp;
 			r = 0x40000000 - ((rexp>-31) ? ((r>>-rexp)|((r&((static_cast<uint32>(1)<<-rexp)-1))!=0)) : 1);
-			for(rexp=0; r<0x40000000; r<<=1,--rexp) ;
+			rexp = -normalize<30>(r);
 			uint32 mx = sqrt<30>(r, rexp);
 			int d = exp - rexp;
 			if(d < 0)
@@ -1723,7 +2095,7 @@ namespace half_float
 			m = (((static_cast<uint32>(ilog)<<27)+(m>>4))^msign) - msign;
 			if(!m)
 				return 0;
-			for(; m<0x80000000; m<<=1,--exp) ;
+			exp -= normalize<31>(m);
 			int i = m >= L, s;
 			exp += i;
 			m >>= 1 + i;
@@ -1789,7 +2161,7 @@ namespace half_float
 		{
 			int abs = arg & 0x7FFF, expx = (abs>>10) + (abs<=0x3FF) - 15, expy = -15, ilog, i;
 			uint32 mx = static_cast<uint32>((abs&0x3FF)|((abs>0x3FF)<<10)) << 20, my, r;
-			for(; abs<0x400; abs<<=1,--expy) ;
+			expy -= normalize<10>(abs);
 			expy += abs >> 10;
 			r = ((abs&0x3FF)|0x400) << 5;
 			r *= r;
@@ -1814,7 +2186,7 @@ namespace half_float
 			else
 			{
 				r -= 0x40000000 >> expy;
-				for(; r<0x40000000; r<<=1,--expy) ;
+				expy -= normalize<30>(r);
 			}
 			my = sqrt<30>(r, expy);
 			my = (my<<15) + (r<<14)/my;
@@ -1846,7 +2218,7 @@ namespace half_float
 			/// \param abs unsigned half-precision value
 			f31(unsigned int abs) : exp(-15)
 			{
-				for(; abs<0x400; abs<<=1,--exp) ;
+				exp -= normalize<10>(abs);
 				m = static_cast<uint32>((abs&0x3FF)|0x400) << 21;
 				exp += (abs>>10);
 			}
@@ -1875,7 +2247,7 @@ namespace half_float
 				uint32 m = a.m - ((d<32) ? (b.m>>d) : 0);
 				if(!m)
 					return f31(0, -32);
-				for(; m<0x80000000; m<<=1,--exp) ;
+				exp -= normalize<31>(m);
 				return f31(m, exp);
 			}
 
@@ -1961,7 +2333,8 @@ namespace half_float
 				if(z.exp >= 0)
 				{
 					sign &= (L|((z.m>>(31-z.exp))&1)) - 1;
-					for(z=f31((z.m<<(1+z.exp))&0xFFFFFFFF, -1); z.m<0x80000000; z.m<<=1,--z.exp) ;
+					z = f31((z.m<<(1+z.exp))&0xFFFFFFFF, -1);
+					z.exp -= normalize<31>(z.m);
 				}
 				if(z.exp == -1)
 					z = f31(0x80000000, 0) - z;
@@ -1969,7 +2342,8 @@ namespace half_float
 				{
 					z = z * pi;
 					z.m = sincos(z.m>>(1-z.exp), 30).first;
-					for(z.exp=1; z.m<0x80000000; z.m<<=1,--z.exp) ;
+					z.exp = 1;
+					z.exp -= normalize<31>(z.m);
 				}
 				else
 					z = f31(0x80000000, 0);
@@ -1983,7 +2357,7 @@ namespace half_float
 					{
 						uint32 m = log2((z.m+1)>>1, 27);
 						z = f31(-((static_cast<uint32>(z.exp)<<26)+(m>>5)), 5);
-						for(; z.m<0x80000000; z.m<<=1,--z.exp) ;
+						z.exp -= normalize<31>(z.m);
 						l = l + z / lbe;
 					}
 					sign = static_cast<unsigned>(x.exp&&(l.exp<s.exp||(l.exp==s.exp&&l.m<s.m))) << 15;
@@ -2030,9 +2404,706 @@ namespace half_float
 			}
 			return fixed2half<R,31,false,false,true>(s.m, s.exp+14, sign);
 		}
+
+		/// Round hybrid result for IEEE double-precision.
+		/// \tparam R rounding mode to use
+		/// \param value double-precision approximation with relative error smaller than 2^-40
+		/// \param hbits variable to take rounded half-precision value
+		/// \retval true if \a hbits contains the correctly rounded result
+		/// \retval false if the result has to be computed exactly
+		/// \exception FE_UNDERFLOW on underflows if successful
+		/// \exception FE_INEXACT if successful
+		template<std::float_round_style R> bool hybrid_impl(double value, unsigned int &hbits, true_type)
+		{
+			bits<double>::type dbits;
+			std::memcpy(&dbits, &value, sizeof(double));
+			unsigned int exp = (dbits>>52) & 0x7FF;
+			if(exp < 0x3E7 || exp >= 0x40F)
+				return false;
+			int i = (exp<0x3F1) ? (0x41A-exp) : 41;
+			if(((dbits+0x2000)&((static_cast<bits<double>::type>(1)<<i)-1)) < 0x4000)
+				return false;
+			hbits = float2half_impl<R>(value, true_type());
+			return true;
+		}
+
+		/// Round hybrid result for non-IEEE double-precision.
+		/// \retval false always
+		template<std::float_round_style R> bool hybrid_impl(double, unsigned int&, false_type) { return false; }
+
+		/// Round hybrid result.
+		/// This accepts a double-precision approximation of a result and rounds it to half-precision if its error bound cannot 
+		/// influence the rounding, i.e. if it is neither too close to a representable half-precision value nor to a midpoint between 
+		/// two such values. Results smaller than the smallest subnormal, overflowing, infinite or NaN results are always rejected.
+		/// \tparam R rounding mode to use
+		/// \param value double-precision approximation with relative error smaller than 2^-40
+		/// \param hbits variable to take rounded half-precision value
+		/// \retval true if \a hbits contains the correctly rounded result
+		/// \retval false if the result has to be computed exactly
+		/// \exception FE_UNDERFLOW on underflows if successful
+		/// \exception FE_INEXACT if successful
+		template<std::float_round_style R> bool hybrid(double value, unsigned int &hbits)
+		{
+			return hybrid_impl<R>(value, hbits, bool_type<std::numeric_limits<double>::is_iec559&&sizeof(bits<double>::type)==sizeof(double)>());
+		}
+
+		/// Standard normal distribution function in double-precision.
+		/// For arguments up to 3 in magnitude this sums the Taylor series of `exp(x^2/2) * (Phi(x)-0.5)`, which only has 
+		/// positive terms, and otherwise evaluates the continued fraction of the Mills ratio for the smaller tail, keeping the 
+		/// relative error well below 2^-40 for all half-precision arguments.
+		/// \param x argument
+		/// \return probability of standard normal variate being less than \a x
+		inline double gauss_cdf(double x)
+		{
+			double pdf = std::exp(-0.5*x*x) * 0.398942280401432678, t = std::abs(x);
+			if(t <= 3.0)
+			{
+				double term = x, sum = x, x2 = x * x;
+				for(int n=3; std::abs(term)>1e-17*std::abs(sum); n+=2)
+					sum += term *= x2 / n;
+				return 0.5 + pdf*sum;
+			}
+			double r = 0.0;
+			for(int k=60; k>0; --k)
+				r = k / (t+r);
+			r = pdf / (t+r);
+			return (x<0.0) ? r : (1.0-r);
+		}
+
+		/// Round result of activation function.
+		/// This rounds a double-precision approximation like hybrid() if possible. Otherwise it is either too close to a 
+		/// representable value or midpoint, which activation functions only get that close to when the result is smaller 
+		/// than the smallest subnormal, or is converted directly.
+		/// \tparam R rounding mode to use
+		/// \param value double-precision approximation with relative error smaller than 2^-40
+		/// \param sign half-precision sign bit of result, as \a value may have underflowed to zero
+		/// \return rounded half-precision value
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT according to rounding
+		template<std::float_round_style R> unsigned int activated(double value, unsigned int sign)
+		{
+			unsigned int hbits;
+			if(hybrid<R>(value, hbits))
+				return hbits;
+			double abs = std::abs(value);
+			if(abs < 5.9604644775390625e-8)
+				return rounded<R,true>(sign, abs>=2.98023223876953125e-8, 1);
+			return float2half<R>(value);
+		}
+		/// \}
+		/// \name SIMD arithmetic
+		/// \{
+
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		/// SSE2 vector of 4 half-precision values in 32-bit lanes.
+		/// Shifts, multiplications and divisions are only valid for the operand ranges documented, which are all that the 
+		/// vectorized arithmetic needs. They are emulated with exact single-precision operations where SSE2 has no direct 
+		/// integer equivalent.
+		struct sse2
+		{
+			typedef __m128i type;
+			enum { size = 4 };
+			static type load(const void *p) { return _mm_unpacklo_epi16(_mm_loadl_epi64(static_cast<const __m128i*>(p)), _mm_setzero_si128()); }
+			static void store(void *p, type a) { a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16); _mm_storel_epi64(static_cast<__m128i*>(p), _mm_packs_epi32(a, a)); }
+			static type set(int a) { return _mm_set1_epi32(a); }
+			static type add(type a, type b) { return _mm_add_epi32(a, b); }
+			static type sub(type a, type b) { return _mm_sub_epi32(a, b); }
+			static type band(type a, type b) { return _mm_and_si128(a, b); }
+			static type bor(type a, type b) { return _mm_or_si128(a, b); }
+			static type bxor(type a, type b) { return _mm_xor_si128(a, b); }
+			static type andnot(type m, type a) { return _mm_andnot_si128(m, a); }
+			static type eq(type a, type b) { return _mm_cmpeq_epi32(a, b); }
+			static type gt(type a, type b) { return _mm_cmpgt_epi32(a, b); }
+			static type select(type m, type a, type b) { return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+			static type shl(type a, int i) { return _mm_slli_epi32(a, i); }
+			static type shr(type a, int i) { return _mm_srli_epi32(a, i); }
+			static bool any(type m) { return _mm_movemask_epi8(m) != 0; }
+
+			/// Power of two.
+			/// \param n exponents in [0,30]
+			/// \return 2^\a n
+			static type pow2(type n) { return _mm_cvttps_epi32(_mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23))); }
+
+			/// Variable left shift.
+			/// \param a values smaller than 2^15
+			/// \param n shift amounts in [0,14]
+			/// \return \a a shifted left by \a n
+			static type shlv(type a, type n) { return _mm_madd_epi16(a, pow2(n)); }
+
+			/// Variable right shift.
+			/// \param a values smaller than 2^24
+			/// \param n shift amounts in [0,31]
+			/// \return \a a shifted right by \a n
+			static type shrv(type a, type n)
+			{
+				return _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(a), _mm_castsi128_ps(_mm_slli_epi32(_mm_sub_epi32(_mm_set1_epi32(127), n), 23))));
+			}
+
+			/// Multiplication.
+			/// \param a values smaller than 2^15
+			/// \param b values smaller than 2^15
+			/// \return \a a * \a b
+			static type mul(type a, type b) { return _mm_madd_epi16(a, b); }
+
+			/// Division.
+			/// \param a dividends smaller than 2^23
+			/// \param b divisors in [1,2^11)
+			/// \return \a a / \a b rounded towards zero
+			static type div(type a, type b) { return _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(a), _mm_cvtepi32_ps(b))); }
+
+			/// Binary logarithm.
+			/// \param a values in [1,2^24)
+			/// \return floor(log2(\a a))
+			static type ilog2(type a) { return _mm_sub_epi32(_mm_srli_epi32(_mm_castps_si128(_mm_cvtepi32_ps(a)), 23), _mm_set1_epi32(127)); }
+
+			/// Combine all lanes.
+			/// \param a vector to reduce
+			/// \return bitwise OR of all lanes
+			static int reduce_or(type a)
+			{
+				a = _mm_or_si128(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+				return _mm_cvtsi128_si32(_mm_or_si128(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(2, 3, 0, 1))));
+			}
+		};
+	#endif
+
+	#if HALF_ENABLE_AVX2_INTRINSICS
+		/// AVX2 vector of 8 half-precision values in 32-bit lanes.
+		/// This provides the same operations as detail::sse2 with the same operand ranges.
+		struct avx2
+		{
+			typedef __m256i type;
+			enum { size = 8 };
+			static type load(const void *p) { return _mm256_cvtepu16_epi32(_mm_loadu_si128(static_cast<const __m128i*>(p))); }
+			static void store(void *p, type a) { _mm_storeu_si128(static_cast<__m128i*>(p), _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi32(a, a), 0x08))); }
+			static type set(int a) { return _mm256_set1_epi32(a); }
+			static type add(type a, type b) { return _mm256_add_epi32(a, b); }
+			static type sub(type a, type b) { return _mm256_sub_epi32(a, b); }
+			static type band(type a, type b) { return _mm256_and_si256(a, b); }
+			static type bor(type a, type b) { return _mm256_or_si256(a, b); }
+			static type bxor(type a, type b) { return _mm256_xor_si256(a, b); }
+			static type andnot(type m, type a) { return _mm256_andnot_si256(m, a); }
+			static type eq(type a, type b) { return _mm256_cmpeq_epi32(a, b); }
+			static type gt(type a, type b) { return _mm256_cmpgt_epi32(a, b); }
+			static type select(type m, type a, type b) { return _mm256_blendv_epi8(b, a, m); }
+			static type shl(type a, int i) { return _mm256_slli_epi32(a, i); }
+			static type shr(type a, int i) { return _mm256_srli_epi32(a, i); }
+			static bool any(type m) { return _mm256_movemask_epi8(m) != 0; }
+			static type pow2(type n) { return _mm256_sllv_epi32(_mm256_set1_epi32(1), n); }
+			static type shlv(type a, type n) { return _mm256_sllv_epi32(a, n); }
+			static type shrv(type a, type n) { return _mm256_srlv_epi32(a, n); }
+			static type mul(type a, type b) { return _mm256_mullo_epi32(a, b); }
+			static type div(type a, type b) { return _mm256_cvttps_epi32(_mm256_div_ps(_mm256_cvtepi32_ps(a), _mm256_cvtepi32_ps(b))); }
+			static type ilog2(type a) { return _mm256_sub_epi32(_mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(a)), 23), _mm256_set1_epi32(127)); }
+			static int reduce_or(type a) { return sse2::reduce_or(_mm_or_si128(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1))); }
+		};
+	#endif
+
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		/// Vectorized rounding.
+		/// This computes the same as rounded() with \a I `false` for each lane.
+		/// \tparam R rounding mode to use
+		/// \tparam V vector type
+		/// \param value finite half-precision values to round
+		/// \param g guard bits (0 or 1)
+		/// \param s sticky bits (0 or 1)
+		/// \param flags vector to add exceptions to
+		/// \return rounded half-precision values
+		template<std::float_round_style R,typename V> typename V::type simd_rounded(typename V::type value, typename V::type g, typename V::type s, typename V::type &flags)
+		{
+			typedef typename V::type vec;
+			vec one = V::set(1);
+			if(R == std::round_to_nearest)
+				value = V::add(value, V::band(g, V::bor(s, value)));
+			else if(R == std::round_toward_infinity)
+				value = V::add(value, V::andnot(V::shr(value, 15), V::band(V::bor(g, s), one)));
+			else if(R == std::round_toward_neg_infinity)
+				value = V::add(value, V::band(V::shr(value, 15), V::bor(g, s)));
+			vec exp = V::band(value, V::set(0x7C00)), inexact = V::gt(V::bor(g, s), V::set(0)), overflow = V::eq(exp, V::set(0x7C00));
+			vec subnormal = V::eq(exp, V::set(0)), underflow = subnormal;
+			if(HALF_ERRHANDLING_UNDERFLOW_TO_INEXACT)
+				underflow = V::band(underflow, inexact);
+			flags = V::bor(flags, V::select(overflow, V::set(FE_OVERFLOW), V::select(subnormal, V::band(underflow, V::set(FE_UNDERFLOW)), 
+				V::band(inexact, V::set(FE_INEXACT)))));
+			return value;
+		}
+
+		/// Vectorized overflow result.
+		/// This computes the same as overflow() for each lane, but without raising exceptions.
+		/// \tparam R rounding mode to use
+		/// \tparam V vector type
+		/// \param sign half-precision values with sign bit only
+		/// \return rounded overflowing half-precision values
+		template<std::float_round_style R,typename V> typename V::type simd_overflow(typename V::type sign)
+		{
+			return	(R==std::round_toward_infinity) ? V::sub(V::add(sign, V::set(0x7C00)), V::shr(sign, 15)) :
+					(R==std::round_toward_neg_infinity) ? V::add(V::add(sign, V::set(0x7BFF)), V::shr(sign, 15)) :
+					(R==std::round_toward_zero) ? V::bor(sign, V::set(0x7BFF)) :
+					V::bor(sign, V::set(0x7C00));
+		}
+
+		/// Vectorized underflow result.
+		/// This computes the same as underflow() for each lane, but without raising exceptions.
+		/// \tparam R rounding mode to use
+		/// \tparam V vector type
+		/// \param sign half-precision values with sign bit only
+		/// \return rounded underflowing half-precision values
+		template<std::float_round_style R,typename V> typename V::type simd_underflow(typename V::type sign)
+		{
+			return	(R==std::round_toward_infinity) ? V::sub(V::add(sign, V::set(1)), V::shr(sign, 15)) :
+					(R==std::round_toward_neg_infinity) ? V::add(sign, V::shr(sign, 15)) :
+					sign;
+		}
+
+		/// Vectorized fixed point to half-precision conversion.
+		/// This computes the same as fixed2half() with \a S, \a N and \a I `false` for each lane.
+		/// \tparam R rounding mode to use
+		/// \tparam F number of fractional bits (at most 21)
+		/// \tparam V vector type
+		/// \param m mantissas in Q1.F with leading bit set
+		/// \param exp exponents in [-11,29]
+		/// \param sign half-precision values with sign bit only
+		/// \param s sticky bits (0 or 1)
+		/// \param flags vector to add exceptions to
+		/// \return rounded half-precision values
+		template<std::float_round_style R,unsigned int F,typename V> typename V::type simd_fixed2half(typename V::type m, typename V::type exp, 
+			typename V::type sign, typename V::type s, typename V::type &flags)
+		{
+			typedef typename V::type vec;
+			vec one = V::set(1), neg = V::gt(V::set(0), exp);
+			if(!V::any(neg))
+				return simd_rounded<R,V>(V::add(V::add(sign, V::shl(exp, 10)), V::shr(m, F-10)), V::band(V::shr(m, F-11), one), 
+					V::bor(s, V::andnot(V::eq(V::band(m, V::set((1<<(F-11))-1)), V::set(0)), one)), flags);
+			vec i = V::add(V::set(F-11), V::band(neg, V::sub(V::set(0), exp)));
+			vec value = V::add(V::add(sign, V::shl(V::andnot(neg, exp), 10)), V::shrv(m, V::add(i, one)));
+			s = V::bor(s, V::andnot(V::eq(V::band(m, V::sub(V::pow2(i), one)), V::set(0)), one));
+			return simd_rounded<R,V>(value, V::band(V::shrv(m, i), one), s, flags);
+		}
+
+		/// Vectorized normalization.
+		/// \tparam V vector type
+		/// \param abs absolute values of finite non-zero half-precision values
+		/// \param exp exponents to adjust by the shift
+		/// \return \a abs with subnormal values shifted to have their leading bit at position 10
+		template<typename V> typename V::type simd_normalize(typename V::type abs, typename V::type &exp)
+		{
+			typedef typename V::type vec;
+			if(!V::any(V::gt(V::set(0x400), abs)))
+				return abs;
+			vec i = V::sub(V::set(10), V::ilog2(V::bor(abs, V::set(1))));
+			i = V::andnot(V::gt(V::set(0), i), i);
+			exp = V::sub(exp, i);
+			return V::shlv(abs, i);
+		}
+
+		/// Vectorized addition.
+		/// This computes the same as operator+(half,half) for each lane.
+		/// \tparam R rounding mode to use
+		/// \tparam V vector type
+		/// \param x first operands
+		/// \param y second operands
+		/// \param flags vector to add exceptions to
+		/// \return sums
+		template<std::float_round_style R,typename V> typename V::type simd_add(typename V::type x, typename V::type y, typename V::type &flags)
+		{
+			typedef typename V::type vec;
+			vec zero = V::set(0), one = V::set(1), inf = V::set(0x7C00), absx = V::band(x, V::set(0x7FFF)), absy = V::band(y, V::set(0x7FFF));
+			vec sub = V::eq(V::band(V::bxor(x, y), V::set(0x8000)), V::set(0x8000)), swap = V::gt(absy, absx);
+			vec sign = V::band(V::select(V::band(sub, swap), y, x), V::set(0x8000));
+			vec hi = V::select(swap, absy, absx), lo = V::select(swap, absx, absy), nhi = V::gt(V::set(0x400), hi), nlo = V::gt(V::set(0x400), lo);
+			vec exp = V::sub(V::shr(hi, 10), nhi), d = V::add(V::sub(exp, V::shr(lo, 10)), nlo);
+			vec mx = V::shl(V::bor(V::band(hi, V::set(0x3FF)), V::andnot(nhi, V::set(0x400))), 3);
+			vec my = V::shl(V::bor(V::band(lo, V::set(0x3FF)), V::andnot(nlo, V::set(0x400))), 3), far = V::gt(d, V::set(12));
+			d = V::andnot(far, d);
+			my = V::select(far, one, V::bor(V::shrv(my, d), V::andnot(V::eq(V::band(my, V::sub(V::pow2(d), one)), zero), one)));
+
+			vec ms = V::sub(mx, my), n = V::sub(V::set(13), V::ilog2(V::bor(ms, one)));
+			n = V::andnot(V::gt(zero, n), n);
+			n = V::select(V::gt(n, V::sub(exp, one)), V::sub(exp, one), n);
+			vec es = V::sub(exp, n);
+			ms = V::shlv(ms, n);
+			vec ma = V::add(mx, my), i = V::shr(ma, 14), ea = V::add(exp, i);
+			ma = V::bor(V::shrv(ma, i), V::band(ma, i));
+			vec m = V::select(sub, ms, ma), f = zero, value;
+			exp = V::select(sub, es, ea);
+			value = simd_rounded<R,V>(V::add(V::add(sign, V::shl(V::sub(exp, one), 10)), V::shr(m, 3)), V::band(V::shr(m, 2), one), 
+				V::andnot(V::eq(V::band(m, V::set(3)), zero), one), f);
+
+			vec ovf = V::andnot(sub, V::gt(ea, V::set(30))), cancel = V::band(sub, V::eq(ms, zero)), xzero = V::eq(absx, zero), yzero = V::eq(absy, zero);
+			vec special = V::bor(V::gt(absx, V::set(0x7BFF)), V::gt(absy, V::set(0x7BFF)));
+			if(!V::any(V::bor(V::bor(ovf, cancel), V::bor(V::bor(xzero, yzero), special))))
+				return flags = V::bor(flags, f), value;
+			value = V::select(ovf, simd_overflow<R,V>(sign), value);
+			value = V::select(cancel, V::set((R==std::round_toward_neg_infinity) ? 0x8000 : 0), value);
+			f = V::select(ovf, V::set(FE_OVERFLOW), V::andnot(cancel, f));
+			value = V::select(yzero, x, value);
+			value = V::select(xzero, V::select(yzero, (R==std::round_toward_neg_infinity) ? V::bor(x, y) : V::band(x, y), y), value);
+			f = V::andnot(V::bor(xzero, yzero), f);
+
+			vec xnan = V::gt(absx, inf), ynan = V::gt(absy, inf), nan = V::bor(xnan, ynan);
+			vec invalid = V::band(V::band(sub, V::eq(absx, inf)), V::eq(absy, inf));
+			vec snan = V::bor(V::andnot(V::gt(V::band(x, V::set(0x200)), zero), xnan), V::andnot(V::gt(V::band(y, V::set(0x200)), zero), ynan));
+			value = V::select(special, V::select(nan, V::bor(V::select(xnan, x, y), V::set(0x200)), V::select(invalid, V::set(0x7FFF), 
+				V::select(V::eq(absy, inf), y, x))), value);
+			flags = V::bor(flags, V::select(special, V::band(V::bor(V::andnot(nan, invalid), snan), V::set(FE_INVALID)), f));
+			return value;
+		}
+
+		/// Vectorized subtraction.
+		/// This computes the same as operator-(half,half) for each lane.
+		/// \tparam R rounding mode to use
+		/// \tparam V vector type
+		/// \param x first operands
+		/// \param y second operands
+		/// \param flags vector to add exceptions to
+		/// \return differences
+		template<std::float_round_style R,typename V> typename V::type simd_sub(typename V::type x, typename V::type y, typename V::type &flags)
+		{
+			return simd_add<R,V>(x, V::bxor(y, V::set(0x8000)), flags);
+		}
+
+		/// Vectorized multiplication.
+		/// This computes the same as operator*(half,half) for each lane.
+		/// \tparam R rounding mode to use
+		/// \tparam V vector type
+		/// \param x first operands
+		/// \param y second operands
+		/// \param flags vector to add exceptions to
+		/// \return products
+		template<std::float_round_style R,typename V> typename V::type simd_mul(typename V::type x, typename V::type y, typename V::type &flags)
+		{
+			typedef typename V::type vec;
+			vec zero = V::set(0), inf = V::set(0x7C00), absx = V::band(x, V::set(0x7FFF)), absy = V::band(y, V::set(0x7FFF));
+			vec sign = V::band(V::bxor(x, y), V::set(0x8000)), exp = V::set(-16), mx = simd_normalize<V>(absx, exp), my = simd_normalize<V>(absy, exp);
+			exp = V::add(exp, V::add(V::shr(mx, 10), V::shr(my, 10)));
+			vec m = V::mul(V::bor(V::band(mx, V::set(0x3FF)), V::set(0x400)), V::bor(V::band(my, V::set(0x3FF)), V::set(0x400))), i = V::shr(m, 21);
+			vec s = V::band(m, i), f = zero;
+			exp = V::add(exp, i);
+			vec ovf = V::gt(exp, V::set(29)), unf = V::gt(V::set(-11), exp);
+			vec value = simd_fixed2half<R,20,V>(V::select(V::eq(i, zero), m, V::shr(m, 1)), V::select(V::bor(ovf, unf), zero, exp), sign, s, f);
+			vec xzero = V::eq(absx, zero), yzero = V::eq(absy, zero), zeros = V::bor(xzero, yzero);
+			vec special = V::bor(V::gt(absx, V::set(0x7BFF)), V::gt(absy, V::set(0x7BFF)));
+			if(!V::any(V::bor(V::bor(ovf, unf), V::bor(zeros, special))))
+				return flags = V::bor(flags, f), value;
+			value = V::select(ovf, simd_overflow<R,V>(sign), V::select(unf, simd_underflow<R,V>(sign), value));
+			f = V::select(ovf, V::set(FE_OVERFLOW), V::select(unf, V::set(FE_UNDERFLOW), f));
+			value = V::select(zeros, sign, value);
+			f = V::andnot(zeros, f);
+			vec xnan = V::gt(absx, inf), ynan = V::gt(absy, inf), nan = V::bor(xnan, ynan);
+			vec invalid = V::bor(V::band(V::eq(absx, inf), yzero), V::band(V::eq(absy, inf), xzero));
+			vec snan = V::bor(V::andnot(V::gt(V::band(x, V::set(0x200)), zero), xnan), V::andnot(V::gt(V::band(y, V::set(0x200)), zero), ynan));
+			value = V::select(special, V::select(nan, V::bor(V::select(xnan, x, y), V::set(0x200)), V::select(invalid, V::set(0x7FFF), 
+				V::bor(sign, inf))), value);
+			flags = V::bor(flags, V::select(special, V::band(V::bor(V::andnot(nan, invalid), snan), V::set(FE_INVALID)), f));
+			return value;
+		}
+
+		/// Vectorized division.
+		/// This computes the same as operator/(half,half) for each lane.
+		/// \tparam R rounding mode to use
+		/// \tparam V vector type
+		/// \param x first operands
+		/// \param y second operands
+		/// \param flags vector to add exceptions to
+		/// \return quotients
+		template<std::float_round_style R,typename V> typename V::type simd_div(typename V::type x, typename V::type y, typename V::type &flags)
+		{
+			typedef typename V::type vec;
+			vec zero = V::set(0), one = V::set(1), inf = V::set(0x7C00), absx = V::band(x, V::set(0x7FFF)), absy = V::band(y, V::set(0x7FFF));
+			vec sign = V::band(V::bxor(x, y), V::set(0x8000)), expx = V::set(14), expy = zero;
+			vec mx = simd_normalize<V>(absx, expx), my = simd_normalize<V>(absy, expy);
+			vec exp = V::sub(V::add(expx, V::shr(mx, 10)), V::add(expy, V::shr(my, 10)));
+			mx = V::bor(V::band(mx, V::set(0x3FF)), V::set(0x400));
+			my = V::bor(V::band(my, V::set(0x3FF)), V::set(0x400));
+			vec i = V::gt(my, mx), f = zero;
+			exp = V::add(exp, i);
+			mx = V::shlv(mx, V::sub(V::set(11), i));
+			vec q = V::div(mx, my), s = V::andnot(V::eq(V::sub(mx, V::mul(q, my)), zero), one);
+			vec ovf = V::gt(exp, V::set(29)), unf = V::gt(V::set(-11), exp);
+			vec value = simd_fixed2half<R,11,V>(q, V::select(V::bor(ovf, unf), zero, exp), sign, s, f);
+			vec xzero = V::eq(absx, zero), yzero = V::eq(absy, zero), special = V::bor(V::gt(absx, V::set(0x7BFF)), V::gt(absy, V::set(0x7BFF)));
+			if(!V::any(V::bor(V::bor(ovf, unf), V::bor(V::bor(xzero, yzero), special))))
+				return flags = V::bor(flags, f), value;
+			value = V::select(ovf, simd_overflow<R,V>(sign), V::select(unf, simd_underflow<R,V>(sign), value));
+			f = V::select(ovf, V::set(FE_OVERFLOW), V::select(unf, V::set(FE_UNDERFLOW), f));
+			value = V::select(xzero, V::select(yzero, V::set(0x7FFF), sign), V::select(yzero, V::bor(sign, inf), value));
+			f = V::select(xzero, V::band(yzero, V::set(FE_INVALID)), V::select(yzero, V::set(FE_DIVBYZERO), f));
+			vec xnan = V::gt(absx, inf), ynan = V::gt(absy, inf), nan = V::bor(xnan, ynan), invalid = V::eq(absx, absy);
+			vec snan = V::bor(V::andnot(V::gt(V::band(x, V::set(0x200)), zero), xnan), V::andnot(V::gt(V::band(y, V::set(0x200)), zero), ynan));
+			value = V::select(special, V::select(nan, V::bor(V::select(xnan, x, y), V::set(0x200)), V::select(invalid, V::set(0x7FFF), 
+				V::bor(sign, V::band(V::eq(absx, inf), inf)))), value);
+			flags = V::bor(flags, V::select(special, V::band(V::bor(V::andnot(nan, invalid), snan), V::set(FE_INVALID)), f));
+			return value;
+		}
+
+		/// Vectorized binary operation on arrays.
+		/// This processes as many elements as fit into whole vectors and leaves the remaining ones to the caller. The exceptions 
+		/// of all elements are raised together at the end and the floating-point environment of the host is left untouched.
+		/// \tparam V vector type
+		/// \tparam F vectorized operation
+		/// \param x first operand array of half-precision values
+		/// \param incx 1 to step through \a x or 0 to broadcast a single value
+		/// \param y second operand array of half-precision values
+		/// \param incy 1 to step through \a y or 0 to broadcast a single value
+		/// \param out array to store half-precision results at
+		/// \param n number of elements
+		/// \return number of elements processed
+		/// \exception FE_... according to \a F
+		template<typename V,typename V::type(*F)(typename V::type,typename V::type,typename V::type&)> 
+		std::size_t simd_array(const void *x, std::size_t incx, const void *y, std::size_t incy, void *out, std::size_t n)
+		{
+			typedef typename V::type vec;
+			const unsigned char *px = static_cast<const unsigned char*>(x), *py = static_cast<const unsigned char*>(y);
+			unsigned char *pout = static_cast<unsigned char*>(out);
+			unsigned int csr = _mm_getcsr();
+			vec flags = V::set(0), vx = V::set(incx ? 0 : *static_cast<const uint16*>(x)), vy = V::set(incy ? 0 : *static_cast<const uint16*>(y));
+			std::size_t i = 0;
+			for(; i+V::size<=n; i+=V::size)
+				V::store(pout+2*i, F(incx ? V::load(px+2*i) : vx, incy ? V::load(py+2*i) : vy, flags));
+			_mm_setcsr(csr);
+			raise(V::reduce_or(flags));
+			return i;
+		}
+	#endif
+		/// \}
+		/// \name Fast approximations
+		/// \{
+
+		/// Binary exponential in single-precision.
+		/// \param arg function argument
+		/// \return 2 raised to \a arg, saturated to [2^-64, 2^64] for finite arguments
+		inline float fast_exp2(float arg)
+		{
+			if(!(arg > -64.0f))
+				return (arg==-std::numeric_limits<float>::infinity()) ? 0.0f : (arg==arg) ? 5.42101086e-20f : arg;
+			if(arg >= 64.0f)
+				return (arg==std::numeric_limits<float>::infinity()) ? arg : 1.84467441e19f;
+			int i = static_cast<int>(arg+((arg<0.0f) ? -0.5f : 0.5f));
+			float f = arg - static_cast<float>(i), e;
+			bits<float>::type ebits = static_cast<bits<float>::type>(i+127) << 23;
+			std::memcpy(&e, &ebits, sizeof(float));
+			return e * (1.0f+f*(0.693147181f+f*(0.240226507f+f*(0.0555041087f+f*(0.00961812911f+f*0.00133335581f)))));
+		}
+
+		/// Exponential minus one in single-precision.
+		/// \param arg function argument
+		/// \return e raised to \a arg and subtracted by 1
+		inline float fast_expm1(float arg)
+		{
+			if(std::abs(arg) >= 0.5f)
+				return fast_exp2(arg*1.44269504f) - 1.0f;
+			return arg + arg*arg*(0.5f+arg*(1.66666667e-1f+arg*(4.16666667e-2f+arg*(8.33333333e-3f+arg*(1.38888889e-3f+arg*1.98412698e-4f)))));
+		}
+
+		/// Binary logarithm in single-precision.
+		/// \param arg function argument
+		/// \return logarithm of \a arg to base 2
+		inline float fast_log2(float arg)
+		{
+			if(!(arg > 0.0f))
+				return (arg==0.0f) ? -std::numeric_limits<float>::infinity() : std::numeric_limits<float>::quiet_NaN();
+			if(arg == std::numeric_limits<float>::infinity())
+				return arg;
+			bits<float>::type fbits;
+			std::memcpy(&fbits, &arg, sizeof(float));
+			int exp = static_cast<int>(fbits>>23) - 127;
+			fbits = (fbits&0x7FFFFF) | 0x3F800000;
+			if(fbits > 0x3FB504F3)
+			{
+				fbits -= 0x800000;
+				++exp;
+			}
+			float m, s, s2;
+			std::memcpy(&m, &fbits, sizeof(float));
+			s = (m-1.0f) / (m+1.0f);
+			s2 = s * s;
+			return static_cast<float>(exp) + s*(2.88539008f+s2*(0.961796694f+s2*(0.577078016f+s2*0.412198583f)));
+		}
+
+		/// Natural logarithm in single-precision.
+		/// \param arg function argument
+		/// \return logarithm of \a arg to base e
+		inline float fast_log(float arg) { return fast_log2(arg) * 0.693147181f; }
+
+		/// Cubic root in single-precision.
+		/// \param arg function argument
+		/// \return cubic root of \a arg
+		inline float fast_cbrt(float arg)
+		{
+			float a = std::abs(arg), r;
+			if(a == 0.0f || !(a < std::numeric_limits<float>::infinity()))
+				return arg;
+			bits<float>::type fbits;
+			std::memcpy(&fbits, &a, sizeof(float));
+			fbits = fbits/3 + 0x2A5137A0;
+			std::memcpy(&r, &fbits, sizeof(float));
+			for(int i=0; i<3; ++i)
+				r -= (r-a/(r*r)) * 0.333333333f;
+			return (arg<0.0f) ? -r : r;
+		}
+
+		/// Power function in single-precision.
+		/// \param x base
+		/// \param y exponent
+		/// \return \a x raised to \a y
+		inline float fast_pow(float x, float y)
+		{
+			if(y == 0.0f || x == 1.0f)
+				return 1.0f;
+			float a = std::abs(x);
+			if(a == 1.0f && std::abs(y) == std::numeric_limits<float>::infinity())
+				return 1.0f;
+			float r = fast_exp2(y*fast_log2(a));
+			if(builtin_signbit(x) && std::floor(y) == y)
+				return (std::abs(y) < 2048.0f && std::fmod(y, 2.0f) != 0.0f) ? -r : r;
+			return (x<0.0f && x>-std::numeric_limits<float>::infinity()) ? std::numeric_limits<float>::quiet_NaN() : r;
+		}
+
+		/// Natural logarithm of one plus argument in single-precision.
+		/// \param arg function argument
+		/// \return logarithm of \a arg plus 1 to base e
+		inline float fast_log1p(float arg)
+		{
+			float u = 1.0f + arg;
+			return (u==1.0f) ? arg : (u==std::numeric_limits<float>::infinity()) ? u : (fast_log(u)*arg/(u-1.0f));
+		}
+
+		/// Sine and cosine of reduced argument in single-precision.
+		/// \param arg function argument reduced to [-pi/4, pi/4]
+		/// \param k quadrant of original argument
+		/// \return sine and cosine of original argument
+		inline std::pair<float,float> fast_sincos(float arg, int k)
+		{
+			float z = arg * arg, s = arg + arg*z*(-1.66666667e-1f+z*(8.33333333e-3f+z*(-1.98412698e-4f+z*2.75573192e-6f)));
+			float c = 1.0f + z*(-0.5f+z*(4.16666667e-2f+z*(-1.38888889e-3f+z*2.48015873e-5f)));
+			switch(k & 3)
+			{
+				case 1: return std::make_pair(c, -s);
+				case 2: return std::make_pair(-s, -c);
+				case 3: return std::make_pair(-c, s);
+				default: return std::make_pair(s, c);
+			}
+		}
+
+		/// Sine and cosine in single-precision.
+		/// The argument reduction is carried out in double-precision to stay accurate for all half-precision arguments.
+		/// \param arg function argument
+		/// \return sine and cosine of \a arg
+		inline std::pair<float,float> fast_sincos(float arg)
+		{
+			if(!(std::abs(arg) < std::numeric_limits<float>::infinity()))
+				return std::make_pair(std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::quiet_NaN());
+			double d = arg, k = std::floor(d*0.63661977236758134+0.5);
+			return fast_sincos(static_cast<float>((d-k*1.5707963267948966)-k*6.123233995736766e-17), static_cast<int>(k));
+		}
+
+		/// Sine of pi times argument in single-precision.
+		/// \param arg function argument
+		/// \return sine of pi times \a arg
+		inline float fast_sinpi(float arg)
+		{
+			float k = std::floor(2.0f*arg+0.5f);
+			return fast_sincos((arg-0.5f*k)*3.14159265f, static_cast<int>(k)).first;
+		}
+
+		/// Arc tangent in single-precision.
+		/// \param arg function argument
+		/// \return arc tangent of \a arg
+		inline float fast_atan(float arg)
+		{
+			float a = std::abs(arg), r = 0.0f;
+			if(a > 1.0f)
+			{
+				a = 1.0f / a;
+				r = 1.57079633f;
+			}
+			float t = (a>0.414213562f) ? ((a-1.0f)/(a+1.0f)) : a, z = t * t;
+			t += t*z*(-0.333333333f+z*(0.2f+z*(-0.142857143f+z*(0.111111111f+z*-9.09090909e-2f))));
+			if(a > 0.414213562f)
+				t += 0.785398163f;
+			if(r != 0.0f)
+				t = r - t;
+			return (arg<0.0f) ? -t : t;
+		}
+
+		/// Arc tangent of quotient in single-precision.
+		/// \param y numerator
+		/// \param x denominator
+		/// \return arc tangent of \a y / \a x
+		inline float fast_atan2(float y, float x)
+		{
+			float ay = std::abs(y), ax = std::abs(x), r;
+			if(ay == ax)
+				r = (ax==0.0f) ? 0.0f : 0.785398163f;
+			else
+				r = (ay<ax) ? fast_atan(ay/ax) : (1.57079633f-fast_atan(ax/ay));
+			if(x < 0.0f || (x == 0.0f && builtin_signbit(x)))
+				r = 3.14159265f - r;
+			return builtin_signbit(y) ? -r : r;
+		}
+
+		/// Complementary error function in single-precision.
+		/// \param arg function argument
+		/// \return 1 minus error function of \a arg
+		inline float fast_erfc(float arg)
+		{
+			float a = std::abs(arg), t = 1.0f / (1.0f+0.5f*a);
+			float r = t * fast_exp2(1.44269504f*(-a*a-1.26551223f+t*(1.00002368f+t*(0.37409196f+t*(0.09678418f+t*(-0.18628806f+
+				t*(0.27886807f+t*(-1.13520398f+t*(1.48851587f+t*(-0.82215223f+t*0.17087277f))))))))));
+			return (arg<0.0f) ? (2.0f-r) : r;
+		}
+
+		/// Logarithm of gamma function for arguments near 2 in single-precision.
+		/// \param arg function argument minus 2 in [-0.5, 0.5]
+		/// \return logarithm of gamma function of \a arg plus 2
+		inline float fast_lgamma2(float arg)
+		{
+			return arg*(0.422784335f+arg*(0.322467033f+arg*(-6.73523011e-2f+arg*(2.05808084e-2f+arg*(-7.38555102e-3f+arg*(2.89051033e-3f+
+				arg*(-1.19275392e-3f+arg*(5.09669524e-4f+arg*(-2.23154759e-4f+arg*9.94575128e-5f)))))))));
+		}
+
+		/// Logarithm of gamma function in single-precision.
+		/// \param arg function argument
+		/// \return natural logarith of absolute value of gamma function of \a arg
+		inline float fast_lgamma(float arg)
+		{
+			if(arg < 0.5f)
+			{
+				if(arg <= 0.0f && std::floor(arg) == arg)
+					return std::numeric_limits<float>::infinity();
+				if(arg > 0.0f)
+					return fast_lgamma2(arg) - fast_log1p(arg) - fast_log(arg);
+				return fast_log(3.14159265f/std::abs(fast_sinpi(arg))) - fast_lgamma(1.0f-arg);
+			}
+			if(arg <= 2.5f)
+				return (arg<1.5f) ? (fast_lgamma2(arg-1.0f)-fast_log1p(arg-1.0f)) : fast_lgamma2(arg-2.0f);
+			if(arg == std::numeric_limits<float>::infinity())
+				return arg;
+			float s = 1.0f + 76.1800917f/(arg+1.0f) - 86.5053203f/(arg+2.0f) + 24.0140982f/(arg+3.0f) - 
+				1.23173957f/(arg+4.0f) + 1.20865097e-3f/(arg+5.0f) - 5.39523938e-6f/(arg+6.0f);
+			return (arg+0.5f)*fast_log(arg+5.5f) - (arg+5.5f) + fast_log(2.50662827f*s/arg);
+		}
+
+		/// Gamma function in single-precision.
+		/// \param arg function argument
+		/// \return gamma function of \a arg
+		inline float fast_tgamma(float arg)
+		{
+			if(arg <= 0.0f && std::floor(arg) == arg)
+				return (arg==0.0f) ? (1.0f/arg) : std::numeric_limits<float>::quiet_NaN();
+			if(arg < 0.5f)
+			{
+				if(arg > 0.0f)
+					return fast_exp2(1.44269504f*fast_lgamma(arg));
+				return 3.14159265f / (fast_sinpi(arg)*fast_exp2(1.44269504f*fast_lgamma(1.0f-arg)));
+			}
+			return fast_exp2(1.44269504f*fast_lgamma(arg));
+		}
 		/// \}
 
 		template<typename,typename,std::float_round_style> struct half_caster;
+		struct fixed_sum;
+		struct weight_rounder;
 	}
 
 	/// Half-precision floating-point type.
@@ -2192,13 +3263,14 @@ namespace half_float
 		friend HALF_CONSTEXPR_NOERR half fmax(half, half);
 		friend HALF_CONSTEXPR_NOERR half fmin(half, half);
 		friend half fdim(half, half);
+		friend half recip(half);
 		friend half nanh(const char*);
-		friend half exp(half);
-		friend half exp2(half);
+		template<accuracy> friend half tiered::exp(half);
+		template<accuracy> friend half tiered::exp2(half);
 		friend half expm1(half);
-		friend half log(half);
-		friend half log10(half);
-		friend half log2(half);
+		template<accuracy> friend half tiered::log(half);
+		template<accuracy> friend half tiered::log10(half);
+		template<accuracy> friend half tiered::log2(half);
 		friend half log1p(half);
 		friend half sqrt(half);
 		friend half rsqrt(half);
@@ -2206,17 +3278,17 @@ namespace half_float
 		friend half hypot(half, half);
 		friend half hypot(half, half, half);
 		friend half pow(half, half);
-		friend void sincos(half, half*, half*);
-		friend half sin(half);
-		friend half cos(half);
-		friend half tan(half);
-		friend half asin(half);
-		friend half acos(half);
-		friend half atan(half);
+		template<accuracy> friend void tiered::sincos(half, half*, half*);
+		template<accuracy> friend half tiered::sin(half);
+		template<accuracy> friend half tiered::cos(half);
+		template<accuracy> friend half tiered::tan(half);
+		template<accuracy> friend half tiered::asin(half);
+		template<accuracy> friend half tiered::acos(half);
+		template<accuracy> friend half tiered::atan(half);
 		friend half atan2(half, half);
-		friend half sinh(half);
-		friend half cosh(half);
-		friend half tanh(half);
+		template<accuracy> friend half tiered::sinh(half);
+		template<accuracy> friend half tiered::cosh(half);
+		template<accuracy> friend half tiered::tanh(half);
 		friend half asinh(half);
 		friend half acosh(half);
 		friend half atanh(half);
@@ -2224,6 +3296,10 @@ namespace half_float
 		friend half erfc(half);
 		friend half lgamma(half);
 		friend half tgamma(half);
+		friend half relu(half);
+		friend half sigmoid(half);
+		friend half silu(half);
+		friend half gelu(half);
 		friend half ceil(half);
 		friend half floor(half);
 		friend half trunc(half);
@@ -2255,7 +3331,11 @@ namespace half_float
 		friend HALF_CONSTEXPR bool isless(half, half);
 		friend HALF_CONSTEXPR bool islessequal(half, half);
 		friend HALF_CONSTEXPR bool islessgreater(half, half);
+		friend half reduce_min(const half*, std::size_t);
+		friend half reduce_max(const half*, std::size_t);
 		template<typename,typename,std::float_round_style> friend struct detail::half_caster;
+		friend struct detail::fixed_sum;
+		friend struct detail::weight_rounder;
 		friend class std::numeric_limits<half>;
 	#if HALF_ENABLE_CPP11_HASH
 		friend struct std::hash<half>;
@@ -2578,7 +3658,7 @@ namespace half_float
 		{
 			if(!(mx-=my))
 				return half(detail::binary, static_cast<unsigned>(half::round_style==std::round_toward_neg_infinity)<<15);
-			for(; mx<0x2000 && exp>1; mx<<=1,--exp) ;
+			exp -= detail::normalize<13>(mx, exp-1);
 		}
 		else
 		{
@@ -2627,8 +3707,8 @@ namespace half_float
 										((absx==0x7C00 && !absy)||(absy==0x7C00 && !absx)) ? detail::invalid() : (sign|0x7C00));
 		if(!absx || !absy)
 			return half(detail::binary, sign);
-		for(; absx<0x400; absx<<=1,--exp) ;
-		for(; absy<0x400; absy<<=1,--exp) ;
+		exp -= detail::normalize<10>(absx);
+		exp -= detail::normalize<10>(absy);
 		detail::uint32 m = static_cast<detail::uint32>((absx&0x3FF)|0x400) * static_cast<detail::uint32>((absy&0x3FF)|0x400);
 		int i = m >> 21, s = m & i;
 		exp += (absx>>10) + (absy>>10) + i;
@@ -2662,8 +3742,8 @@ namespace half_float
 			return half(detail::binary, absy ? sign : detail::invalid());
 		if(!absy)
 			return half(detail::binary, detail::pole(sign));
-		for(; absx<0x400; absx<<=1,--exp) ;
-		for(; absy<0x400; absy<<=1,++exp) ;
+		exp -= detail::normalize<10>(absx);
+		exp += detail::normalize<10>(absy);
 		detail::uint32 mx = (absx&0x3FF) | 0x400, my = (absy&0x3FF) | 0x400;
 		int i = mx < my;
 		exp += (absx>>10) - (absy>>10) - i;
@@ -2671,9 +3751,9 @@ namespace half_float
 			return half(detail::binary, detail::overflow<half::round_style>(sign));
 		else if(exp < -11)
 			return half(detail::binary, detail::underflow<half::round_style>(sign));
-		mx <<= 12 + i;
-		my <<= 1;
-		return half(detail::binary, detail::fixed2half<half::round_style,11,false,false,false>(mx/my, exp, sign, mx%my!=0));
+		int s;
+		mx = detail::divide_mantissa(mx<<(11+i), my, s);
+		return half(detail::binary, detail::fixed2half<half::round_style,11,false,false,false>(mx, exp, sign, s));
 	#endif
 	}
 
@@ -2825,8 +3905,8 @@ namespace half_float
 					(absy==0x7C00) ? half(detail::binary, (!absx || (sub && absz==0x7C00)) ? detail::invalid() : (sign|0x7C00)) : z;
 		if(!absx || !absy)
 			return absz ? z : half(detail::binary, (half::round_style==std::round_toward_neg_infinity) ? (z.data_|sign) : (z.data_&sign));
-		for(; absx<0x400; absx<<=1,--exp) ;
-		for(; absy<0x400; absy<<=1,--exp) ;
+		exp -= detail::normalize<10>(absx);
+		exp -= detail::normalize<10>(absy);
 		detail::uint32 m = static_cast<detail::uint32>((absx&0x3FF)|0x400) * static_cast<detail::uint32>((absy&0x3FF)|0x400);
 		int i = m >> 21;
 		exp += (absx>>10) + (absy>>10) + i;
@@ -2834,7 +3914,7 @@ namespace half_float
 		if(absz)
 		{
 			int expz = 0;
-			for(; absz<0x400; absz<<=1,--expz) ;
+			expz -= detail::normalize<10>(absz);
 			expz += absz >> 10;
 			detail::uint32 mz = static_cast<detail::uint32>((absz&0x3FF)|0x400) << 13;
 			if(expz > exp || (expz == exp && mz > m))
@@ -2851,7 +3931,7 @@ namespace half_float
 				m = m - mz;
 				if(!m)
 					return half(detail::binary, static_cast<unsigned>(half::round_style==std::round_toward_neg_infinity)<<15);
-				for(; m<0x800000; m<<=1,--exp) ;
+				exp -= detail::normalize<23>(m);
 			}
 			else
 			{
@@ -2908,6 +3988,36 @@ namespace half_float
 		return (x.data_^(0x8000|(0x8000-(x.data_>>15)))) <= (y.data_^(0x8000|(0x8000-(y.data_>>15)))) ? half(detail::binary, 0) : (x-y);
 	}
 
+	/// Reciprocal.
+	/// This function is exact to rounding for all rounding modes and gives the same result as 1 / \a arg, but is faster 
+	/// due to skipping the handling of the dividend.
+	/// \param arg function argument
+	/// \return reciprocal of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_DIVBYZERO for 0
+	/// \exception FE_OVERFLOW, ...INEXACT according to rounding
+	inline half recip(half arg)
+	{
+	#ifdef HALF_ARITHMETIC_TYPE
+		return half(detail::binary, detail::float2half<half::round_style>(detail::internal_t(1)/detail::half2float<detail::internal_t>(arg.data_)));
+	#else
+		int abs = arg.data_ & 0x7FFF, exp = 29, s;
+		unsigned int sign = arg.data_ & 0x8000;
+		if(abs >= 0x7C00)
+			return half(detail::binary, (abs==0x7C00) ? sign : detail::signal(arg.data_));
+		if(!abs)
+			return half(detail::binary, detail::pole(sign));
+		exp += detail::normalize<10>(abs);
+		detail::uint32 m = (abs&0x3FF) | 0x400;
+		int i = m > 0x400;
+		exp -= (abs>>10) + i;
+		if(exp > 29)
+			return half(detail::binary, detail::overflow<half::round_style>(sign));
+		m = detail::divide_mantissa(0x200000<<i, m, s);
+		return half(detail::binary, detail::fixed2half<half::round_style,11,false,false,false>(m, exp, sign, s));
+	#endif
+	}
+
 	/// Get NaN value.
 	/// **See also:** Documentation for [std::nan](https://en.cppreference.com/w/cpp/numeric/math/nan).
 	/// \param arg string code
@@ -2925,19 +4035,24 @@ namespace half_float
 	/// \name Exponential functions
 	/// \{
 
-	/// Exponential function.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::exp](https://en.cppreference.com/w/cpp/numeric/math/exp).
+	/// Exponential function with selectable accuracy.
+	/// This function is exact to rounding for `accuracy_exact` and otherwise stays within the error bound of the selected 
+	/// [accuracy tier](\ref accuracy) when rounding to nearest.
+	/// \tparam A accuracy of result
 	/// \param arg function argument
 	/// \return e raised to \a arg
 	/// \exception FE_INVALID for signaling NaN
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half exp(half arg)
+	template<accuracy A> half tiered::exp(half arg)
 	{
 	#ifdef HALF_ARITHMETIC_TYPE
 		return half(detail::binary, detail::float2half<half::round_style>(std::exp(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::exp(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int abs = arg.data_ & 0x7FFF, e = (abs>>10) + (abs<=0x3FF), exp;
 		if(!abs)
 			return half(detail::binary, 0x3C00);
@@ -2956,23 +4071,38 @@ namespace half_float
 			exp = m >> (45-e);
 			m = (m<<(e-14)) & 0x7FFFFFFF;
 		}
-		return half(detail::binary, detail::exp2_post<half::round_style>(m, exp, (arg.data_&0x8000)!=0, 0, 26));
+		return half(detail::binary, detail::exp2_post<half::round_style>(m, exp, (arg.data_&0x8000)!=0, 0, detail::iterations<A>(26, 12, 11, 9)));
 	#endif
 	}
 
-	/// Binary exponential.
+	/// Exponential function.
 	/// This function is exact to rounding for all rounding modes.
 	///
-	/// **See also:** Documentation for [std::exp2](https://en.cppreference.com/w/cpp/numeric/math/exp2).
+	/// **See also:** Documentation for [std::exp](https://en.cppreference.com/w/cpp/numeric/math/exp).
+	/// \param arg function argument
+	/// \return e raised to \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half exp(half arg) { return tiered::exp<accuracy_exact>(arg); }
+
+	/// Binary exponential with selectable accuracy.
+	/// This function is exact to rounding for `accuracy_exact` and otherwise stays within the error bound of the selected 
+	/// [accuracy tier](\ref accuracy) when rounding to nearest.
+	/// \tparam A accuracy of result
 	/// \param arg function argument
 	/// \return 2 raised to \a arg
 	/// \exception FE_INVALID for signaling NaN
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half exp2(half arg)
+	template<accuracy A> half tiered::exp2(half arg)
 	{
 	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
 		return half(detail::binary, detail::float2half<half::round_style>(std::exp2(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH && HALF_ENABLE_CPP11_CMATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::exp2(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int abs = arg.data_ & 0x7FFF, e = (abs>>10) + (abs<=0x3FF), exp = (abs&0x3FF) + ((abs>0x3FF)<<10);
 		if(!abs)
 			return half(detail::binary, 0x3C00);
@@ -2981,10 +4111,20 @@ namespace half_float
 		if(abs >= 0x4E40)
 			return half(detail::binary, (arg.data_&0x8000) ? detail::underflow<half::round_style>() : detail::overflow<half::round_style>());
 		return half(detail::binary, detail::exp2_post<half::round_style>(
-			(static_cast<detail::uint32>(exp)<<(6+e))&0x7FFFFFFF, exp>>(25-e), (arg.data_&0x8000)!=0, 0, 28));
+			(static_cast<detail::uint32>(exp)<<(6+e))&0x7FFFFFFF, exp>>(25-e), (arg.data_&0x8000)!=0, 0, detail::iterations<A>(28, 12, 11, 9)));
 	#endif
 	}
 
+	/// Binary exponential.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::exp2](https://en.cppreference.com/w/cpp/numeric/math/exp2).
+	/// \param arg function argument
+	/// \return 2 raised to \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half exp2(half arg) { return tiered::exp2<accuracy_exact>(arg); }
+
 	/// Exponential minus one.
 	/// This function may be 1 ULP off the correctly rounded exact result in <0.05% of inputs for `std::round_to_nearest` 
 	/// and in <1% of inputs for any other rounding mode.
@@ -3031,27 +4171,33 @@ namespace half_float
 		}
 		else
 			m -= (exp<31) ? (0x80000000>>exp) : 1;
-		for(exp+=14; m<0x80000000 && exp; m<<=1,--exp) ;
+		exp += 14;
+		exp -= detail::normalize<31>(m, exp);
 		if(exp > 29)
 			return half(detail::binary, detail::overflow<half::round_style>());
 		return half(detail::binary, detail::rounded<half::round_style,true>(sign+(exp<<10)+(m>>21), (m>>20)&1, (m&0xFFFFF)!=0));
 	#endif
 	}
 
-	/// Natural logarithm.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::log](https://en.cppreference.com/w/cpp/numeric/math/log).
+	/// Natural logarithm with selectable accuracy.
+	/// This function is exact to rounding for `accuracy_exact` and otherwise stays within the error bound of the selected 
+	/// [accuracy tier](\ref accuracy) when rounding to nearest.
+	/// \tparam A accuracy of result
 	/// \param arg function argument
 	/// \return logarithm of \a arg to base e
 	/// \exception FE_INVALID for signaling NaN or negative argument
 	/// \exception FE_DIVBYZERO for 0
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half log(half arg)
+	template<accuracy A> half tiered::log(half arg)
 	{
 	#ifdef HALF_ARITHMETIC_TYPE
 		return half(detail::binary, detail::float2half<half::round_style>(std::log(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::log(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int abs = arg.data_ & 0x7FFF, exp = -15;
 		if(!abs)
 			return half(detail::binary, detail::pole(0x8000));
@@ -3059,27 +4205,43 @@ namespace half_float
 			return half(detail::binary, (arg.data_<=0xFC00) ? detail::invalid() : detail::signal(arg.data_));
 		if(abs >= 0x7C00)
 			return (abs==0x7C00) ? arg : half(detail::binary, detail::signal(arg.data_));
-		for(; abs<0x400; abs<<=1,--exp) ;
+		exp -= detail::normalize<10>(abs);
 		exp += abs >> 10;
 		return half(detail::binary, detail::log2_post<half::round_style,0xB8AA3B2A>(
-			detail::log2(static_cast<detail::uint32>((abs&0x3FF)|0x400)<<20, 27)+8, exp, 17));
+			detail::log2(static_cast<detail::uint32>((abs&0x3FF)|0x400)<<20, detail::iterations<A>(27, 20, 20, 18))+8, exp, 17));
 	#endif
 	}
 
-	/// Common logarithm.
+	/// Natural logarithm.
 	/// This function is exact to rounding for all rounding modes.
 	///
-	/// **See also:** Documentation for [std::log10](https://en.cppreference.com/w/cpp/numeric/math/log10).
+	/// **See also:** Documentation for [std::log](https://en.cppreference.com/w/cpp/numeric/math/log).
+	/// \param arg function argument
+	/// \return logarithm of \a arg to base e
+	/// \exception FE_INVALID for signaling NaN or negative argument
+	/// \exception FE_DIVBYZERO for 0
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half log(half arg) { return tiered::log<accuracy_exact>(arg); }
+
+	/// Common logarithm with selectable accuracy.
+	/// This function is exact to rounding for `accuracy_exact` and otherwise stays within the error bound of the selected 
+	/// [accuracy tier](\ref accuracy) when rounding to nearest.
+	/// \tparam A accuracy of result
 	/// \param arg function argument
 	/// \return logarithm of \a arg to base 10
 	/// \exception FE_INVALID for signaling NaN or negative argument
 	/// \exception FE_DIVBYZERO for 0
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half log10(half arg)
+	template<accuracy A> half tiered::log10(half arg)
 	{
 	#ifdef HALF_ARITHMETIC_TYPE
 		return half(detail::binary, detail::float2half<half::round_style>(std::log10(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::log10(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int abs = arg.data_ & 0x7FFF, exp = -15;
 		if(!abs)
 			return half(detail::binary, detail::pole(0x8000));
@@ -3094,27 +4256,43 @@ namespace half_float
 			case 0x63D0: return half(detail::binary, 0x4200);
 			case 0x70E2: return half(detail::binary, 0x4400);
 		}
-		for(; abs<0x400; abs<<=1,--exp) ;
+		exp -= detail::normalize<10>(abs);
 		exp += abs >> 10;
 		return half(detail::binary, detail::log2_post<half::round_style,0xD49A784C>(
-			detail::log2(static_cast<detail::uint32>((abs&0x3FF)|0x400)<<20, 27)+8, exp, 16));
+			detail::log2(static_cast<detail::uint32>((abs&0x3FF)|0x400)<<20, detail::iterations<A>(27, 22, 20, 20))+8, exp, 16));
 	#endif
 	}
 
-	/// Binary logarithm.
+	/// Common logarithm.
 	/// This function is exact to rounding for all rounding modes.
 	///
-	/// **See also:** Documentation for [std::log2](https://en.cppreference.com/w/cpp/numeric/math/log2).
+	/// **See also:** Documentation for [std::log10](https://en.cppreference.com/w/cpp/numeric/math/log10).
+	/// \param arg function argument
+	/// \return logarithm of \a arg to base 10
+	/// \exception FE_INVALID for signaling NaN or negative argument
+	/// \exception FE_DIVBYZERO for 0
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half log10(half arg) { return tiered::log10<accuracy_exact>(arg); }
+
+	/// Binary logarithm with selectable accuracy.
+	/// This function is exact to rounding for `accuracy_exact` and otherwise stays within the error bound of the selected 
+	/// [accuracy tier](\ref accuracy) when rounding to nearest.
+	/// \tparam A accuracy of result
 	/// \param arg function argument
 	/// \return logarithm of \a arg to base 2
 	/// \exception FE_INVALID for signaling NaN or negative argument
 	/// \exception FE_DIVBYZERO for 0
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half log2(half arg)
+	template<accuracy A> half tiered::log2(half arg)
 	{
 	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
 		return half(detail::binary, detail::float2half<half::round_style>(std::log2(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH && HALF_ENABLE_CPP11_CMATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::log2(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int abs = arg.data_ & 0x7FFF, exp = -15, s = 0;
 		if(!abs)
 			return half(detail::binary, detail::pole(0x8000));
@@ -3124,25 +4302,37 @@ namespace half_float
 			return (abs==0x7C00) ? arg : half(detail::binary, detail::signal(arg.data_));
 		if(abs == 0x3C00)
 			return half(detail::binary, 0);
-		for(; abs<0x400; abs<<=1,--exp) ;
+		exp -= detail::normalize<10>(abs);
 		exp += (abs>>10);
 		if(!(abs&0x3FF))
 		{
 			unsigned int value = static_cast<unsigned>(exp<0) << 15, m = std::abs(exp) << 6;
-			for(exp=18; m<0x400; m<<=1,--exp) ;
+			exp = 18 - detail::normalize<10>(m);
 			return half(detail::binary, value+(exp<<10)+m);
 		}
 		detail::uint32 ilog = exp, sign = detail::sign_mask(ilog), m = 
-			(((ilog<<27)+(detail::log2(static_cast<detail::uint32>((abs&0x3FF)|0x400)<<20, 28)>>4))^sign) - sign;
+			(((ilog<<27)+(detail::log2(static_cast<detail::uint32>((abs&0x3FF)|0x400)<<20, detail::iterations<A>(28, 20, 20, 18))>>4))^sign) - sign;
 		if(!m)
 			return half(detail::binary, 0);
-		for(exp=14; m<0x8000000 && exp; m<<=1,--exp) ;
+		exp = 14;
+		exp -= detail::normalize<27>(m, exp);
 		for(; m>0xFFFFFFF; m>>=1,++exp)
 			s |= m & 1;
 		return half(detail::binary, detail::fixed2half<half::round_style,27,false,false,true>(m, exp, sign&0x8000, s));
 	#endif
 	}
 
+	/// Binary logarithm.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::log2](https://en.cppreference.com/w/cpp/numeric/math/log2).
+	/// \param arg function argument
+	/// \return logarithm of \a arg to base 2
+	/// \exception FE_INVALID for signaling NaN or negative argument
+	/// \exception FE_DIVBYZERO for 0
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half log2(half arg) { return tiered::log2<accuracy_exact>(arg); }
+
 	/// Natural logarithm plus one.
 	/// This function may be 1 ULP off the correctly rounded exact result in <0.05% of inputs for `std::round_to_nearest` 
 	/// and in ~1% of inputs for any other rounding mode.
@@ -3163,13 +4353,13 @@ namespace half_float
 		int abs = arg.data_ & 0x7FFF, exp = -15;
 		if(!abs || abs >= 0x7C00)
 			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
-		for(; abs<0x400; abs<<=1,--exp) ;
+		exp -= detail::normalize<10>(abs);
 		exp += abs >> 10;
 		detail::uint32 m = static_cast<detail::uint32>((abs&0x3FF)|0x400) << 20;
 		if(arg.data_ & 0x8000)
 		{
 			m = 0x40000000 - (m>>-exp);
-			for(exp=0; m<0x40000000; m<<=1,--exp) ;
+			exp = -detail::normalize<30>(m);
 		}
 		else
 		{
@@ -3211,7 +4401,7 @@ namespace half_float
 		int abs = arg.data_ & 0x7FFF, exp = 15;
 		if(!abs || arg.data_ >= 0x7C00)
 			return half(detail::binary, (abs>0x7C00) ? detail::signal(arg.data_) : (arg.data_>0x8000) ? detail::invalid() : arg.data_);
-		for(; abs<0x400; abs<<=1,--exp) ;
+		exp -= detail::normalize<10>(abs);
 		detail::uint32 r = static_cast<detail::uint32>((abs&0x3FF)|0x400) << 10, m = detail::sqrt<20>(r, exp+=abs>>10);
 		return half(detail::binary, detail::rounded<half::round_style,false>((exp<<10)+(m&0x3FF), r>m, r!=0));
 	#endif
@@ -3229,11 +4419,16 @@ namespace half_float
 	#ifdef HALF_ARITHMETIC_TYPE
 		return half(detail::binary, detail::float2half<half::round_style>(detail::internal_t(1)/std::sqrt(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(1.0/std::sqrt(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		unsigned int abs = arg.data_ & 0x7FFF, bias = 0x4000;
 		if(!abs || arg.data_ >= 0x7C00)
 			return half(detail::binary,	(abs>0x7C00) ? detail::signal(arg.data_) : (arg.data_>0x8000) ?
 										detail::invalid() : !abs ? detail::pole(arg.data_&0x8000) : 0);
-		for(; abs<0x400; abs<<=1,bias-=0x400) ;
+		bias -= detail::normalize<10>(abs) * 0x400;
 		unsigned int frac = (abs+=bias) & 0x7FF;
 		if(frac == 0x400)
 			return half(detail::binary, 0x7A00-(abs>>1));
@@ -3242,12 +4437,14 @@ namespace half_float
 			return pow(arg, half(detail::binary, 0xB800));
 		detail::uint32 f = 0x17376 - abs, mx = (abs&0x3FF) | 0x400, my = ((f>>1)&0x3FF) | 0x400, mz = my * my;
 		int expy = (f>>11) - 31, expx = 32 - (abs>>10), i = mz >> 21;
-		for(mz=0x60000000-(((mz>>i)*mx)>>(expx-2*expy-i)); mz<0x40000000; mz<<=1,--expy) ;
+		mz = 0x60000000-(((mz>>i)*mx)>>(expx-2*expy-i));
+		expy -= detail::normalize<30>(mz);
 		i = (my*=mz>>10) >> 31;
 		expy += i;
 		my = (my>>(20+i)) + 1;
 		i = (mz=my*my) >> 21;
-		for(mz=0x60000000-(((mz>>i)*mx)>>(expx-2*expy-i)); mz<0x40000000; mz<<=1,--expy) ;
+		mz = 0x60000000-(((mz>>i)*mx)>>(expx-2*expy-i));
+		expy -= detail::normalize<30>(mz);
 		i = (my*=(mz>>10)+1) >> 31;
 		return half(detail::binary, detail::fixed2half<half::round_style,30,false,false,true>(my>>i, expy+i+14));
 	#endif
@@ -3266,13 +4463,18 @@ namespace half_float
 	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
 		return half(detail::binary, detail::float2half<half::round_style>(std::cbrt(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH && HALF_ENABLE_CPP11_CMATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::cbrt(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int abs = arg.data_ & 0x7FFF, exp = -15;
 		if(!abs || abs == 0x3C00 || abs >= 0x7C00)
 			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
-		for(; abs<0x400; abs<<=1, --exp);
+		exp -= detail::normalize<10>(abs);
 		detail::uint32 ilog = exp + (abs>>10), sign = detail::sign_mask(ilog), f, m = 
 			(((ilog<<27)+(detail::log2(static_cast<detail::uint32>((abs&0x3FF)|0x400)<<20, 24)>>4))^sign) - sign;
-		for(exp=2; m<0x80000000; m<<=1,--exp) ;
+		exp = 2 - detail::normalize<31>(m);
 		m = detail::multiply64(m, 0xAAAAAAAB);
 		int i = m >> 31, s;
 		exp += i;
@@ -3322,6 +4524,12 @@ namespace half_float
 			return half(detail::binary, detail::float2half<half::round_style>(std::sqrt(fx*fx+fy*fy)));
 		#endif
 	#else
+	#if HALF_HYBRID_MATH
+		double fx = detail::half2float<double>(x.data_), fy = detail::half2float<double>(y.data_);
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::sqrt(fx*fx+fy*fy), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, expx = 0, expy = 0;
 		if(absx >= 0x7C00 || absy >= 0x7C00)
 			return half(detail::binary,	(absx==0x7C00) ? detail::select(0x7C00, y.data_) :
@@ -3332,8 +4540,8 @@ namespace half_float
 			return half(detail::binary, detail::check_underflow(absx));
 		if(absy > absx)
 			std::swap(absx, absy);
-		for(; absx<0x400; absx<<=1,--expx) ;
-		for(; absy<0x400; absy<<=1,--expy) ;
+		expx -= detail::normalize<10>(absx);
+		expy -= detail::normalize<10>(absy);
 		detail::uint32 mx = (absx&0x3FF) | 0x400, my = (absy&0x3FF) | 0x400;
 		mx *= mx;
 		my *= my;
@@ -3364,6 +4572,12 @@ namespace half_float
 		detail::internal_t fx = detail::half2float<detail::internal_t>(x.data_), fy = detail::half2float<detail::internal_t>(y.data_), fz = detail::half2float<detail::internal_t>(z.data_);
 		return half(detail::binary, detail::float2half<half::round_style>(std::sqrt(fx*fx+fy*fy+fz*fz)));
 	#else
+	#if HALF_HYBRID_MATH
+		double fx = detail::half2float<double>(x.data_), fy = detail::half2float<double>(y.data_), fz = detail::half2float<double>(z.data_);
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::sqrt(fx*fx+fy*fy+fz*fz), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, absz = z.data_ & 0x7FFF, expx = 0, expy = 0, expz = 0;
 		if(!absx)
 			return hypot(y, z);
@@ -3382,9 +4596,9 @@ namespace half_float
 			std::swap(absx, absy);
 		if(absz > absy)
 			std::swap(absy, absz);
-		for(; absx<0x400; absx<<=1,--expx) ;
-		for(; absy<0x400; absy<<=1,--expy) ;
-		for(; absz<0x400; absz<<=1,--expz) ;
+		expx -= detail::normalize<10>(absx);
+		expy -= detail::normalize<10>(absy);
+		expz -= detail::normalize<10>(absz);
 		detail::uint32 mx = (absx&0x3FF) | 0x400, my = (absy&0x3FF) | 0x400, mz = (absz&0x3FF) | 0x400;
 		mx *= mx;
 		my *= my;
@@ -3451,11 +4665,11 @@ namespace half_float
 			case 0x4000: return x * x;
 			case 0xBC00: return half(detail::binary, 0x3C00) / x;
 		}
-		for(; absx<0x400; absx<<=1,--exp) ;
+		exp -= detail::normalize<10>(absx);
 		detail::uint32 ilog = exp + (absx>>10), msign = detail::sign_mask(ilog), f, m = 
 			(((ilog<<27)+((detail::log2(static_cast<detail::uint32>((absx&0x3FF)|0x400)<<20)+8)>>4))^msign) - msign;
-		for(exp=-11; m<0x80000000; m<<=1,--exp) ;
-		for(; absy<0x400; absy<<=1,--exp) ;
+		exp = -11 - detail::normalize<31>(m);
+		exp -= detail::normalize<10>(absy);
 		m = detail::multiply64(m, static_cast<detail::uint32>((absy&0x3FF)|0x400)<<21);
 		int i = m >> 31;
 		exp += (absy>>10) + i;
@@ -3479,22 +4693,32 @@ namespace half_float
 	/// \name Trigonometric functions
 	/// \{
 
-	/// Compute sine and cosine simultaneously.
-	///	This returns the same results as sin() and cos() but is faster than calling each function individually.
-	///
-	/// This function is exact to rounding for all rounding modes.
+	/// Compute sine and cosine simultaneously with selectable accuracy.
+	/// This function is exact to rounding for `accuracy_exact` and otherwise stays within the error bound of the selected 
+	/// [accuracy tier](\ref accuracy) when rounding to nearest.
+	/// \tparam A accuracy of results
 	/// \param arg function argument
 	/// \param sin variable to take sine of \a arg
 	/// \param cos variable to take cosine of \a arg
 	/// \exception FE_INVALID for signaling NaN or infinity
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline void sincos(half arg, half *sin, half *cos)
+	template<accuracy A> void tiered::sincos(half arg, half *sin, half *cos)
 	{
 	#ifdef HALF_ARITHMETIC_TYPE
 		detail::internal_t f = detail::half2float<detail::internal_t>(arg.data_);
 		*sin = half(detail::binary, detail::float2half<half::round_style>(std::sin(f)));
 		*cos = half(detail::binary, detail::float2half<half::round_style>(std::cos(f)));
 	#else
+	#if HALF_HYBRID_MATH
+		double f = detail::half2float<double>(arg.data_);
+		unsigned int sbits, cbits;
+		if(detail::hybrid<half::round_style>(std::sin(f), sbits) && detail::hybrid<half::round_style>(std::cos(f), cbits))
+		{
+			*sin = half(detail::binary, sbits);
+			*cos = half(detail::binary, cbits);
+			return;
+		}
+	#endif
 		int abs = arg.data_ & 0x7FFF, sign = arg.data_ >> 15, k;
 		if(abs >= 0x7C00)
 			*sin = *cos = half(detail::binary, (abs==0x7C00) ? detail::invalid() : detail::signal(arg.data_));
@@ -3532,7 +4756,7 @@ namespace half_float
 					return;
 				}
 			}
-			std::pair<detail::uint32,detail::uint32> sc = detail::sincos(detail::angle_arg(abs, k), 28);
+			std::pair<detail::uint32,detail::uint32> sc = detail::sincos(detail::angle_arg(abs, k), detail::iterations<A>(28, 25, 24, 22));
 			switch(k & 3)
 			{
 				case 1: sc = std::make_pair(sc.second, -sc.first); break;
@@ -3545,19 +4769,35 @@ namespace half_float
 	#endif
 	}
 
-	/// Sine function.
-	/// This function is exact to rounding for all rounding modes.
+	/// Compute sine and cosine simultaneously.
+	///	This returns the same results as sin() and cos() but is faster than calling each function individually.
 	///
-	/// **See also:** Documentation for [std::sin](https://en.cppreference.com/w/cpp/numeric/math/sin).
+	/// This function is exact to rounding for all rounding modes.
+	/// \param arg function argument
+	/// \param sin variable to take sine of \a arg
+	/// \param cos variable to take cosine of \a arg
+	/// \exception FE_INVALID for signaling NaN or infinity
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void sincos(half arg, half *sin, half *cos) { tiered::sincos<accuracy_exact>(arg, sin, cos); }
+
+	/// Sine function with selectable accuracy.
+	/// This function is exact to rounding for `accuracy_exact` and otherwise stays within the error bound of the selected 
+	/// [accuracy tier](\ref accuracy) when rounding to nearest.
+	/// \tparam A accuracy of result
 	/// \param arg function argument
 	/// \return sine value of \a arg
 	/// \exception FE_INVALID for signaling NaN or infinity
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half sin(half arg)
+	template<accuracy A> half tiered::sin(half arg)
 	{
 	#ifdef HALF_ARITHMETIC_TYPE
 		return half(detail::binary, detail::float2half<half::round_style>(std::sin(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::sin(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int abs = arg.data_ & 0x7FFF, k;
 		if(!abs)
 			return arg;
@@ -3572,25 +4812,40 @@ namespace half_float
 				case 0x6A64: return half(detail::binary, detail::rounded<half::round_style,true>((~arg.data_&0x8000)|0x3BFE, 1, 1));
 				case 0x6D8C: return half(detail::binary, detail::rounded<half::round_style,true>((arg.data_&0x8000)|0x0FE6, 1, 1));
 			}
-		std::pair<detail::uint32,detail::uint32> sc = detail::sincos(detail::angle_arg(abs, k), 28);
+		std::pair<detail::uint32,detail::uint32> sc = detail::sincos(detail::angle_arg(abs, k), detail::iterations<A>(28, 25, 24, 22));
 		detail::uint32 sign = -static_cast<detail::uint32>(((k>>1)&1)^(arg.data_>>15));
 		return half(detail::binary, detail::fixed2half<half::round_style,30,true,true,true>((((k&1) ? sc.second : sc.first)^sign) - sign));
 	#endif
 	}
 
-	/// Cosine function.
+	/// Sine function.
 	/// This function is exact to rounding for all rounding modes.
 	///
-	/// **See also:** Documentation for [std::cos](https://en.cppreference.com/w/cpp/numeric/math/cos).
+	/// **See also:** Documentation for [std::sin](https://en.cppreference.com/w/cpp/numeric/math/sin).
+	/// \param arg function argument
+	/// \return sine value of \a arg
+	/// \exception FE_INVALID for signaling NaN or infinity
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half sin(half arg) { return tiered::sin<accuracy_exact>(arg); }
+
+	/// Cosine function with selectable accuracy.
+	/// This function is exact to rounding for `accuracy_exact` and otherwise stays within the error bound of the selected 
+	/// [accuracy tier](\ref accuracy) when rounding to nearest.
+	/// \tparam A accuracy of result
 	/// \param arg function argument
 	/// \return cosine value of \a arg
 	/// \exception FE_INVALID for signaling NaN or infinity
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half cos(half arg)
+	template<accuracy A> half tiered::cos(half arg)
 	{
 	#ifdef HALF_ARITHMETIC_TYPE
 		return half(detail::binary, detail::float2half<half::round_style>(std::cos(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::cos(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int abs = arg.data_ & 0x7FFF, k;
 		if(!abs)
 			return half(detail::binary, 0x3C00);
@@ -3600,25 +4855,40 @@ namespace half_float
 			return half(detail::binary, detail::rounded<half::round_style,true>(0x3BFF, 1, 1));
 		if(half::round_style != std::round_to_nearest && abs == 0x598C)
 			return half(detail::binary, detail::rounded<half::round_style,true>(0x80FC, 1, 1));
-		std::pair<detail::uint32,detail::uint32> sc = detail::sincos(detail::angle_arg(abs, k), 28);
+		std::pair<detail::uint32,detail::uint32> sc = detail::sincos(detail::angle_arg(abs, k), detail::iterations<A>(28, 25, 24, 22));
 		detail::uint32 sign = -static_cast<detail::uint32>(((k>>1)^k)&1);
 		return half(detail::binary, detail::fixed2half<half::round_style,30,true,true,true>((((k&1) ? sc.first : sc.second)^sign) - sign));
 	#endif
 	}
 
-	/// Tangent function.
+	/// Cosine function.
 	/// This function is exact to rounding for all rounding modes.
 	///
-	/// **See also:** Documentation for [std::tan](https://en.cppreference.com/w/cpp/numeric/math/tan).
+	/// **See also:** Documentation for [std::cos](https://en.cppreference.com/w/cpp/numeric/math/cos).
+	/// \param arg function argument
+	/// \return cosine value of \a arg
+	/// \exception FE_INVALID for signaling NaN or infinity
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half cos(half arg) { return tiered::cos<accuracy_exact>(arg); }
+
+	/// Tangent function with selectable accuracy.
+	/// This function is exact to rounding for `accuracy_exact` and otherwise stays within the error bound of the selected 
+	/// [accuracy tier](\ref accuracy) when rounding to nearest.
+	/// \tparam A accuracy of result
 	/// \param arg function argument
 	/// \return tangent value of \a arg
 	/// \exception FE_INVALID for signaling NaN or infinity
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half tan(half arg)
+	template<accuracy A> half tiered::tan(half arg)
 	{
 	#ifdef HALF_ARITHMETIC_TYPE
 		return half(detail::binary, detail::float2half<half::round_style>(std::tan(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::tan(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int abs = arg.data_ & 0x7FFF, exp = 13, k;
 		if(!abs)
 			return arg;
@@ -3632,30 +4902,45 @@ namespace half_float
 				case 0x658C: return half(detail::binary, detail::rounded<half::round_style,true>((arg.data_&0x8000)|0x07E6, 1, 1));
 				case 0x7330: return half(detail::binary, detail::rounded<half::round_style,true>((~arg.data_&0x8000)|0x4B62, 1, 1));
 			}
-		std::pair<detail::uint32,detail::uint32> sc = detail::sincos(detail::angle_arg(abs, k), 30);
+		std::pair<detail::uint32,detail::uint32> sc = detail::sincos(detail::angle_arg(abs, k), detail::iterations<A>(30, 26, 24, 23));
 		if(k & 1)
 			sc = std::make_pair(-sc.second, sc.first);
 		detail::uint32 signy = detail::sign_mask(sc.first), signx = detail::sign_mask(sc.second);
 		detail::uint32 my = (sc.first^signy) - signy, mx = (sc.second^signx) - signx;
-		for(; my<0x80000000; my<<=1,--exp) ;
-		for(; mx<0x80000000; mx<<=1,++exp) ;
+		exp -= detail::normalize<31>(my);
+		exp += detail::normalize<31>(mx);
 		return half(detail::binary, detail::tangent_post<half::round_style>(my, mx, exp, (signy^signx^arg.data_)&0x8000));
 	#endif
 	}
 
-	/// Arc sine.
+	/// Tangent function.
 	/// This function is exact to rounding for all rounding modes.
 	///
-	/// **See also:** Documentation for [std::asin](https://en.cppreference.com/w/cpp/numeric/math/asin).
+	/// **See also:** Documentation for [std::tan](https://en.cppreference.com/w/cpp/numeric/math/tan).
+	/// \param arg function argument
+	/// \return tangent value of \a arg
+	/// \exception FE_INVALID for signaling NaN or infinity
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half tan(half arg) { return tiered::tan<accuracy_exact>(arg); }
+
+	/// Arc sine with selectable accuracy.
+	/// This function is exact to rounding for `accuracy_exact` and otherwise stays within the error bound of the selected 
+	/// [accuracy tier](\ref accuracy) when rounding to nearest.
+	/// \tparam A accuracy of result
 	/// \param arg function argument
 	/// \return arc sine value of \a arg
 	/// \exception FE_INVALID for signaling NaN or if abs(\a arg) > 1
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half asin(half arg)
+	template<accuracy A> half tiered::asin(half arg)
 	{
 	#ifdef HALF_ARITHMETIC_TYPE
 		return half(detail::binary, detail::float2half<half::round_style>(std::asin(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::asin(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		unsigned int abs = arg.data_ & 0x7FFF, sign = arg.data_ & 0x8000;
 		if(!abs)
 			return arg;
@@ -3667,24 +4952,39 @@ namespace half_float
 		if(half::round_style != std::round_to_nearest && (abs == 0x2B44 || abs == 0x2DC3))
 			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_+1, 1, 1));
 		std::pair<detail::uint32,detail::uint32> sc = detail::atan2_args(abs);
-		detail::uint32 m = detail::atan2(sc.first, sc.second, (half::round_style==std::round_to_nearest) ? 27 : 26);
+		detail::uint32 m = detail::atan2(sc.first, sc.second, detail::iterations<A>((half::round_style==std::round_to_nearest) ? 27 : 26, 16, 15, 13));
 		return half(detail::binary, detail::fixed2half<half::round_style,30,false,true,true>(m, 14, sign));
 	#endif
 	}
 
-	/// Arc cosine function.
+	/// Arc sine.
 	/// This function is exact to rounding for all rounding modes.
 	///
-	/// **See also:** Documentation for [std::acos](https://en.cppreference.com/w/cpp/numeric/math/acos).
+	/// **See also:** Documentation for [std::asin](https://en.cppreference.com/w/cpp/numeric/math/asin).
+	/// \param arg function argument
+	/// \return arc sine value of \a arg
+	/// \exception FE_INVALID for signaling NaN or if abs(\a arg) > 1
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half asin(half arg) { return tiered::asin<accuracy_exact>(arg); }
+
+	/// Arc cosine function with selectable accuracy.
+	/// This function is exact to rounding for `accuracy_exact` and otherwise stays within the error bound of the selected 
+	/// [accuracy tier](\ref accuracy) when rounding to nearest.
+	/// \tparam A accuracy of result
 	/// \param arg function argument
 	/// \return arc cosine value of \a arg
 	/// \exception FE_INVALID for signaling NaN or if abs(\a arg) > 1
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half acos(half arg)
+	template<accuracy A> half tiered::acos(half arg)
 	{
 	#ifdef HALF_ARITHMETIC_TYPE
 		return half(detail::binary, detail::float2half<half::round_style>(std::acos(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::acos(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		unsigned int abs = arg.data_ & 0x7FFF, sign = arg.data_ >> 15;
 		if(!abs)
 			return half(detail::binary, detail::rounded<half::round_style,true>(0x3E48, 0, 1));
@@ -3692,24 +4992,39 @@ namespace half_float
 			return half(detail::binary,	(abs>0x7C00) ? detail::signal(arg.data_) : (abs>0x3C00) ? detail::invalid() :
 										sign ? detail::rounded<half::round_style,true>(0x4248, 0, 1) : 0);
 		std::pair<detail::uint32,detail::uint32> cs = detail::atan2_args(abs);
-		detail::uint32 m = detail::atan2(cs.second, cs.first, 28);
+		detail::uint32 m = detail::atan2(cs.second, cs.first, detail::iterations<A>(28, 16, 15, 13));
 		return half(detail::binary, detail::fixed2half<half::round_style,31,false,true,true>(sign ? (0xC90FDAA2-m) : m, 15, 0, sign));
 	#endif
 	}
 
-	/// Arc tangent function.
+	/// Arc cosine function.
 	/// This function is exact to rounding for all rounding modes.
 	///
-	/// **See also:** Documentation for [std::atan](https://en.cppreference.com/w/cpp/numeric/math/atan).
+	/// **See also:** Documentation for [std::acos](https://en.cppreference.com/w/cpp/numeric/math/acos).
+	/// \param arg function argument
+	/// \return arc cosine value of \a arg
+	/// \exception FE_INVALID for signaling NaN or if abs(\a arg) > 1
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half acos(half arg) { return tiered::acos<accuracy_exact>(arg); }
+
+	/// Arc tangent function with selectable accuracy.
+	/// This function is exact to rounding for `accuracy_exact` and otherwise stays within the error bound of the selected 
+	/// [accuracy tier](\ref accuracy) when rounding to nearest.
+	/// \tparam A accuracy of result
 	/// \param arg function argument
 	/// \return arc tangent value of \a arg
 	/// \exception FE_INVALID for signaling NaN
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half atan(half arg)
+	template<accuracy A> half tiered::atan(half arg)
 	{
 	#ifdef HALF_ARITHMETIC_TYPE
 		return half(detail::binary, detail::float2half<half::round_style>(std::atan(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::atan(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		unsigned int abs = arg.data_ & 0x7FFF, sign = arg.data_ & 0x8000;
 		if(!abs)
 			return arg;
@@ -3719,12 +5034,22 @@ namespace half_float
 			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_-1, 1, 1));
 		int exp = (abs>>10) + (abs<=0x3FF);
 		detail::uint32 my = (abs&0x3FF) | ((abs>0x3FF)<<10);
-		detail::uint32 m = (exp>15) ?	detail::atan2(my<<19, 0x20000000>>(exp-15), (half::round_style==std::round_to_nearest) ? 26 : 24) :
-										detail::atan2(my<<(exp+4), 0x20000000, (half::round_style==std::round_to_nearest) ? 30 : 28);
+		detail::uint32 m = (exp>15) ?	detail::atan2(my<<19, 0x20000000>>(exp-15), detail::iterations<A>((half::round_style==std::round_to_nearest) ? 26 : 24, 13, 12, 10)) :
+										detail::atan2(my<<(exp+4), 0x20000000, detail::iterations<A>((half::round_style==std::round_to_nearest) ? 30 : 28, 17, 16, 14));
 		return half(detail::binary, detail::fixed2half<half::round_style,30,false,true,true>(m, 14, sign));
 	#endif
 	}
 
+	/// Arc tangent function.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::atan](https://en.cppreference.com/w/cpp/numeric/math/atan).
+	/// \param arg function argument
+	/// \return arc tangent value of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half atan(half arg) { return tiered::atan<accuracy_exact>(arg); }
+
 	/// Arc tangent function.
 	/// This function may be 1 ULP off the correctly rounded exact result in ~0.005% of inputs for `std::round_to_nearest`, 
 	/// in ~0.1% of inputs for `std::round_toward_zero` and in ~0.02% of inputs for any other rounding mode.
@@ -3762,7 +5087,7 @@ namespace half_float
 			return half(detail::binary, detail::rounded<half::round_style,true>(signy|0x4248, 0, 1));
 		if(!signx && d < ((half::round_style==std::round_toward_zero) ? -15 : -9))
 		{
-			for(; absy<0x400; absy<<=1,--d) ;
+			d -= detail::normalize<10>(absy);
 			detail::uint32 mx = ((absx<<1)&0x7FF) | 0x800, my = ((absy<<1)&0x7FF) | 0x800;
 			int i = my < mx;
 			d -= i;
@@ -3782,27 +5107,33 @@ namespace half_float
 	/// \name Hyperbolic functions
 	/// \{
 
-	/// Hyperbolic sine.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::sinh](https://en.cppreference.com/w/cpp/numeric/math/sinh).
+	/// Hyperbolic sine with selectable accuracy.
+	/// This function is exact to rounding for `accuracy_exact` and otherwise stays within the error bound of the selected 
+	/// [accuracy tier](\ref accuracy) when rounding to nearest.
+	/// \tparam A accuracy of result
 	/// \param arg function argument
 	/// \return hyperbolic sine value of \a arg
 	/// \exception FE_INVALID for signaling NaN
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half sinh(half arg)
+	template<accuracy A> half tiered::sinh(half arg)
 	{
 	#ifdef HALF_ARITHMETIC_TYPE
 		return half(detail::binary, detail::float2half<half::round_style>(std::sinh(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::sinh(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int abs = arg.data_ & 0x7FFF, exp;
 		if(!abs || abs >= 0x7C00)
 			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
 		if(abs <= 0x2900)
 			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_, 0, 1));
-		std::pair<detail::uint32,detail::uint32> mm = detail::hyperbolic_args(abs, exp, (half::round_style==std::round_to_nearest) ? 29 : 27);
+		std::pair<detail::uint32,detail::uint32> mm = detail::hyperbolic_args(abs, exp, detail::iterations<A>((half::round_style==std::round_to_nearest) ? 29 : 27, 16, 15, 13));
 		detail::uint32 m = mm.first - mm.second;
-		for(exp+=13; m<0x80000000 && exp; m<<=1,--exp) ;
+		exp += 13;
+		exp -= detail::normalize<31>(m, exp);
 		unsigned int sign = arg.data_ & 0x8000;
 		if(exp > 29)
 			return half(detail::binary, detail::overflow<half::round_style>(sign));
@@ -3810,25 +5141,40 @@ namespace half_float
 	#endif
 	}
 
-	/// Hyperbolic cosine.
+	/// Hyperbolic sine.
 	/// This function is exact to rounding for all rounding modes.
 	///
-	/// **See also:** Documentation for [std::cosh](https://en.cppreference.com/w/cpp/numeric/math/cosh).
+	/// **See also:** Documentation for [std::sinh](https://en.cppreference.com/w/cpp/numeric/math/sinh).
+	/// \param arg function argument
+	/// \return hyperbolic sine value of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half sinh(half arg) { return tiered::sinh<accuracy_exact>(arg); }
+
+	/// Hyperbolic cosine with selectable accuracy.
+	/// This function is exact to rounding for `accuracy_exact` and otherwise stays within the error bound of the selected 
+	/// [accuracy tier](\ref accuracy) when rounding to nearest.
+	/// \tparam A accuracy of result
 	/// \param arg function argument
 	/// \return hyperbolic cosine value of \a arg
 	/// \exception FE_INVALID for signaling NaN
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half cosh(half arg)
+	template<accuracy A> half tiered::cosh(half arg)
 	{
 	#ifdef HALF_ARITHMETIC_TYPE
 		return half(detail::binary, detail::float2half<half::round_style>(std::cosh(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::cosh(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int abs = arg.data_ & 0x7FFF, exp;
 		if(!abs)
 			return half(detail::binary, 0x3C00);
 		if(abs >= 0x7C00)
 			return half(detail::binary, (abs>0x7C00) ? detail::signal(arg.data_) : 0x7C00);
-		std::pair<detail::uint32,detail::uint32> mm = detail::hyperbolic_args(abs, exp, (half::round_style==std::round_to_nearest) ? 23 : 26);
+		std::pair<detail::uint32,detail::uint32> mm = detail::hyperbolic_args(abs, exp, detail::iterations<A>((half::round_style==std::round_to_nearest) ? 23 : 26, 12, 11, 9));
 		detail::uint32 m = mm.first + mm.second, i = (~m&0xFFFFFFFF) >> 31;
 		m = (m>>i) | (m&i) | 0x80000000;
 		if((exp+=13+i) > 29)
@@ -3837,19 +5183,34 @@ namespace half_float
 	#endif
 	}
 
-	/// Hyperbolic tangent.
+	/// Hyperbolic cosine.
 	/// This function is exact to rounding for all rounding modes.
 	///
-	/// **See also:** Documentation for [std::tanh](https://en.cppreference.com/w/cpp/numeric/math/tanh).
+	/// **See also:** Documentation for [std::cosh](https://en.cppreference.com/w/cpp/numeric/math/cosh).
+	/// \param arg function argument
+	/// \return hyperbolic cosine value of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half cosh(half arg) { return tiered::cosh<accuracy_exact>(arg); }
+
+	/// Hyperbolic tangent with selectable accuracy.
+	/// This function is exact to rounding for `accuracy_exact` and otherwise stays within the error bound of the selected 
+	/// [accuracy tier](\ref accuracy) when rounding to nearest.
+	/// \tparam A accuracy of result
 	/// \param arg function argument
 	/// \return hyperbolic tangent value of \a arg
 	/// \exception FE_INVALID for signaling NaN
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half tanh(half arg)
+	template<accuracy A> half tiered::tanh(half arg)
 	{
 	#ifdef HALF_ARITHMETIC_TYPE
 		return half(detail::binary, detail::float2half<half::round_style>(std::tanh(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::tanh(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int abs = arg.data_ & 0x7FFF, exp;
 		if(!abs)
 			return arg;
@@ -3861,14 +5222,24 @@ namespace half_float
 			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_-1, 1, 1));
 		if(half::round_style != std::round_to_nearest && abs == 0x2D3F)
 			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_-3, 0, 1));
-		std::pair<detail::uint32,detail::uint32> mm = detail::hyperbolic_args(abs, exp, 27);
+		std::pair<detail::uint32,detail::uint32> mm = detail::hyperbolic_args(abs, exp, detail::iterations<A>(27, 17, 16, 14));
 		detail::uint32 my = mm.first - mm.second - (half::round_style!=std::round_to_nearest), mx = mm.first + mm.second, i = (~mx&0xFFFFFFFF) >> 31;
-		for(exp=13; my<0x80000000; my<<=1,--exp) ;
+		exp = 13 - detail::normalize<31>(my);
 		mx = (mx>>i) | 0x80000000;
 		return half(detail::binary, detail::tangent_post<half::round_style>(my, mx, exp-i, arg.data_&0x8000));
 	#endif
 	}
 
+	/// Hyperbolic tangent.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::tanh](https://en.cppreference.com/w/cpp/numeric/math/tanh).
+	/// \param arg function argument
+	/// \return hyperbolic tangent value of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half tanh(half arg) { return tiered::tanh<accuracy_exact>(arg); }
+
 	/// Hyperbolic area sine.
 	/// This function is exact to rounding for all rounding modes.
 	///
@@ -3882,6 +5253,11 @@ namespace half_float
 	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
 		return half(detail::binary, detail::float2half<half::round_style>(std::asinh(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH && HALF_ENABLE_CPP11_CMATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::asinh(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int abs = arg.data_ & 0x7FFF;
 		if(!abs || abs >= 0x7C00)
 			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
@@ -3910,6 +5286,11 @@ namespace half_float
 	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
 		return half(detail::binary, detail::float2half<half::round_style>(std::acosh(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH && HALF_ENABLE_CPP11_CMATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::acosh(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int abs = arg.data_ & 0x7FFF;
 		if((arg.data_&0x8000) || abs < 0x3C00)
 			return half(detail::binary, (abs<=0x7C00) ? detail::invalid() : detail::signal(arg.data_));
@@ -3935,6 +5316,11 @@ namespace half_float
 	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
 		return half(detail::binary, detail::float2half<half::round_style>(std::atanh(detail::half2float<detail::internal_t>(arg.data_))));
 	#else
+	#if HALF_HYBRID_MATH && HALF_ENABLE_CPP11_CMATH
+		unsigned int hbits;
+		if(detail::hybrid<half::round_style>(std::atanh(detail::half2float<double>(arg.data_)), hbits))
+			return half(detail::binary, hbits);
+	#endif
 		int abs = arg.data_ & 0x7FFF, exp = 0;
 		if(!abs)
 			return arg;
@@ -3943,7 +5329,7 @@ namespace half_float
 		if(abs < 0x2700)
 			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_, 0, 1));
 		detail::uint32 m = static_cast<detail::uint32>((abs&0x3FF)|((abs>0x3FF)<<10)) << ((abs>>10)+(abs<=0x3FF)+6), my = 0x80000000 + m, mx = 0x80000000 - m;
-		for(; mx<0x80000000; mx<<=1,++exp) ;
+		exp += detail::normalize<31>(mx);
 		int i = my >= mx, s;
 		return half(detail::binary, detail::log2_post<half::round_style,0xB8AA3B2A>(detail::log2(
 			(detail::divide64(my>>i, mx, s)+1)>>1, 27)+0x10, exp+i-1, 16, arg.data_&0x8000));
@@ -4057,6 +5443,73 @@ namespace half_float
 	#endif
 	}
 
+	/// \}
+
+	/// \name Activation functions
+	/// \{
+
+	/// Rectified linear unit.
+	/// \param arg function argument
+	/// \return \a arg if positive or NaN, +0 otherwise
+	/// \exception FE_INVALID for signaling NaN
+	inline half relu(half arg)
+	{
+		return half(detail::binary, ((arg.data_&0x7FFF)>0x7C00) ? detail::signal(arg.data_) : (arg.data_&0x8000) ? 0 : arg.data_);
+	}
+
+	/// Logistic sigmoid function.
+	/// This computes `1/(1+exp(-arg))` and is exact to rounding for all rounding modes.
+	/// \param arg function argument
+	/// \return sigmoid of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+	inline half sigmoid(half arg)
+	{
+		unsigned int abs = arg.data_ & 0x7FFF;
+		if(!abs)
+			return half(detail::binary, 0x3800);
+		if(abs >= 0x7C00)
+			return half(detail::binary, (abs==0x7C00) ? (0x3C00&((arg.data_>>15)-1U)) : detail::signal(arg.data_));
+		if(arg.data_ >= 0x4840 && arg.data_ < 0x8000)
+			return half(detail::binary, detail::rounded<half::round_style,true>(0x3BFF, 1, 1));
+		return half(detail::binary, detail::activated<half::round_style>(1.0/(1.0+std::exp(-detail::half2float<double>(arg.data_))), 0));
+	}
+
+	/// Sigmoid linear unit.
+	/// This computes `arg/(1+exp(-arg))` (also known as swish) and is exact to rounding for all rounding modes.
+	/// \param arg function argument
+	/// \return SiLU of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+	inline half silu(half arg)
+	{
+		unsigned int abs = arg.data_ & 0x7FFF;
+		if(!abs || abs >= 0x7C00)
+			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : (arg.data_==0xFC00) ? half(detail::binary, 0x8000) : arg;
+		if(arg.data_ >= 0x4840 && arg.data_ < 0x8000)
+			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_-1, 1, 1));
+		double x = detail::half2float<double>(arg.data_);
+		return half(detail::binary, detail::activated<half::round_style>(x/(1.0+std::exp(-x)), arg.data_&0x8000));
+	}
+
+	/// Gaussian error linear unit.
+	/// This computes `arg*Phi(arg)` with the standard normal distribution function `Phi(x) = (1+erf(x/sqrt(2)))/2` and is 
+	/// exact to rounding for all rounding modes.
+	/// \param arg function argument
+	/// \return GELU of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+	inline half gelu(half arg)
+	{
+		unsigned int abs = arg.data_ & 0x7FFF;
+		if(!abs || abs >= 0x7C00)
+			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : (arg.data_==0xFC00) ? half(detail::binary, 0x8000) : arg;
+		if(arg.data_ >= 0x4400 && arg.data_ < 0x8000)
+			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_-1, 1, 1));
+		double x = detail::half2float<double>(arg.data_);
+		return half(detail::binary, detail::activated<half::round_style>(x*detail::gauss_cdf(x), arg.data_&0x8000));
+	}
+
 	/// \}
 	/// \anchor rounding
 	/// \name Rounding
@@ -4157,7 +5610,7 @@ namespace half_float
 		unsigned int abs = arg.data_ & 0x7FFF;
 		if(abs >= 0x7C00 || !abs)
 			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
-		for(; abs<0x400; abs<<=1,--*exp) ;
+		*exp -= detail::normalize<10>(abs);
 		*exp += (abs>>10) - 14;
 		return half(detail::binary, (arg.data_&0x8000)|0x3800|(abs&0x3FF));
 	}
@@ -4176,7 +5629,7 @@ namespace half_float
 		unsigned int abs = arg.data_ & 0x7FFF, sign = arg.data_ & 0x8000;
 		if(abs >= 0x7C00 || !abs)
 			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
-		for(; abs<0x400; abs<<=1,--exp) ;
+		exp -= detail::normalize<10>(abs);
 		exp += abs >> 10;
 		if(exp > 30)
 			return half(detail::binary, detail::overflow<half::round_style>(sign));
@@ -4232,7 +5685,7 @@ namespace half_float
 		iptr->data_ = arg.data_ & ~mask;
 		if(!m)
 			return half(detail::binary, arg.data_&0x8000);
-		for(; m<0x400; m<<=1,--exp) ;
+		exp -= detail::normalize<10>(m);
 		return half(detail::binary, (arg.data_&0x8000)|(exp<<10)|(m&0x3FF));
 	}
 
@@ -4252,7 +5705,8 @@ namespace half_float
 			detail::raise(FE_INVALID);
 			return !abs ? FP_ILOGB0 : (abs==0x7C00) ? INT_MAX : FP_ILOGBNAN;
 		}
-		for(exp=(abs>>10)-15; abs<0x200; abs<<=1,--exp) ;
+		exp = (abs>>10)-15;
+		exp -= detail::normalize<9>(abs);
 		return exp;
 	}
 
@@ -4269,12 +5723,13 @@ namespace half_float
 			return half(detail::binary, detail::pole(0x8000));
 		if(abs >= 0x7C00)
 			return half(detail::binary, (abs==0x7C00) ? 0x7C00 : detail::signal(arg.data_));
-		for(exp=(abs>>10)-15; abs<0x200; abs<<=1,--exp) ;
+		exp = (abs>>10)-15;
+		exp -= detail::normalize<9>(abs);
 		unsigned int value = static_cast<unsigned>(exp<0) << 15;
 		if(exp)
 		{
 			unsigned int m = std::abs(exp) << 6;
-			for(exp=18; m<0x400; m<<=1,--exp) ;
+			exp = 18 - detail::normalize<10>(m);
 			value |= (exp<<10) + m;
 		}
 		return half(detail::binary, value);
@@ -4582,6 +6037,5539 @@ namespace half_float
 			throw std::range_error(msg);
 	}
 	/// \}
+
+	namespace detail
+	{
+		/// Addition for array arithmetic.
+		struct add_op
+		{
+			static half scalar(half x, half y) { return x + y; }
+		#if HALF_ENABLE_F16C_INTRINSICS
+			static __m256 f16c(__m256 x, __m256 y) { return _mm256_add_ps(x, y); }
+			static __m256 f16c_exact(__m256 x, __m256 y, __m256 r) { return _mm256_and_ps(_mm256_cmp_ps(_mm256_sub_ps(r, x), y, _CMP_EQ_OQ), _mm256_cmp_ps(_mm256_sub_ps(r, y), x, _CMP_EQ_OQ)); }
+		#endif
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			template<typename V> static typename V::type simd(typename V::type x, typename V::type y, typename V::type &flags)
+			{
+				return simd_add<std::numeric_limits<half>::round_style,V>(x, y, flags);
+			}
+		#endif
+		};
+
+		/// Subtraction for array arithmetic.
+		struct sub_op
+		{
+			static half scalar(half x, half y) { return x - y; }
+		#if HALF_ENABLE_F16C_INTRINSICS
+			static __m256 f16c(__m256 x, __m256 y) { return _mm256_sub_ps(x, y); }
+			static __m256 f16c_exact(__m256 x, __m256 y, __m256 r) { return _mm256_and_ps(_mm256_cmp_ps(_mm256_sub_ps(x, r), y, _CMP_EQ_OQ), _mm256_cmp_ps(_mm256_add_ps(r, y), x, _CMP_EQ_OQ)); }
+		#endif
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			template<typename V> static typename V::type simd(typename V::type x, typename V::type y, typename V::type &flags)
+			{
+				return simd_sub<std::numeric_limits<half>::round_style,V>(x, y, flags);
+			}
+		#endif
+		};
+
+		/// Multiplication for array arithmetic.
+		struct mul_op
+		{
+			static half scalar(half x, half y) { return x * y; }
+		#if HALF_ENABLE_F16C_INTRINSICS
+			static __m256 f16c(__m256 x, __m256 y) { return _mm256_mul_ps(x, y); }
+			static __m256 f16c_exact(__m256 x, __m256 y, __m256 r) { return _mm256_cmp_ps(r, _mm256_mul_ps(x, y), _CMP_EQ_OQ); }
+		#endif
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			template<typename V> static typename V::type simd(typename V::type x, typename V::type y, typename V::type &flags)
+			{
+				return simd_mul<std::numeric_limits<half>::round_style,V>(x, y, flags);
+			}
+		#endif
+		};
+
+		/// Division for array arithmetic.
+		struct div_op
+		{
+			static half scalar(half x, half y) { return x / y; }
+		#if HALF_ENABLE_F16C_INTRINSICS
+			static __m256 f16c(__m256 x, __m256 y) { return _mm256_div_ps(x, y); }
+			static __m256 f16c_exact(__m256 x, __m256 y, __m256 r) { return _mm256_cmp_ps(_mm256_mul_ps(r, y), x, _CMP_EQ_OQ); }
+		#endif
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			template<typename V> static typename V::type simd(typename V::type x, typename V::type y, typename V::type &flags)
+			{
+				return simd_div<std::numeric_limits<half>::round_style,V>(x, y, flags);
+			}
+		#endif
+		};
+
+	#if HALF_ENABLE_F16C_INTRINSICS
+		/// Single-precision binary operation on arrays.
+		/// This computes 8 results at once in single-precision with the rounding mode of the MXCSR register set to the 
+		/// half-precision rounding mode and rounds them to half-precision with the same mode. Since single-precision has more 
+		/// than twice the precision of half-precision, this double rounding is innocuous for the basic arithmetic operations, 
+		/// thus results are identical to the scalar operators as long as they are normalized and finite. Lanes with any other 
+		/// results (zeros, subnormals, infinities, NaNs or the largest finite values that the scalar operators might round 
+		/// differently on overflow) are recomputed with the scalar operation. Inexact results are detected with exact 
+		/// single-precision checks rather than the MXCSR flags, which cannot be attributed to individual lanes.
+		/// \tparam O operation to compute
+		/// \param x first operand array
+		/// \param incx 1 to step through \a x or 0 to broadcast a single value
+		/// \param y second operand array
+		/// \param incy 1 to step through \a y or 0 to broadcast a single value
+		/// \param out array to store results at
+		/// \param n number of elements
+		/// \return number of elements processed
+		/// \exception FE_... according to \a O
+		template<typename O> std::size_t f16c_array(const half *x, std::size_t incx, const half *y, std::size_t incy, half *out, std::size_t n)
+		{
+			const std::float_round_style R = std::numeric_limits<half>::round_style;
+			const unsigned int mode = 0x1F80 | ((R==std::round_to_nearest) ? 0x0000 : (R==std::round_toward_infinity) ? 0x4000 : 
+				(R==std::round_toward_neg_infinity) ? 0x2000 : 0x6000);
+			unsigned int csr = _mm_getcsr();
+			_mm_setcsr(mode);
+			__m128i hx = _mm_set1_epi16(static_cast<short>(incx ? 0 : *reinterpret_cast<const uint16*>(x)));
+			__m128i hy = _mm_set1_epi16(static_cast<short>(incy ? 0 : *reinterpret_cast<const uint16*>(y)));
+			__m128i abs = _mm_set1_epi16(0x7FFF), max = _mm_set1_epi16(0x7BFE), min = _mm_set1_epi16(0x400);
+		#if HALF_ENABLE_AVX2_INTRINSICS
+			typedef avx2 V;
+		#elif HALF_ENABLE_SSE2_INTRINSICS
+			typedef sse2 V;
+		#endif
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			typename V::type flags = V::set(0);
+		#endif
+			int inexact = 0;
+			std::size_t i = 0;
+			for(; i+8<=n; i+=8)
+			{
+				if(incx)
+					hx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i));
+				if(incy)
+					hy = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y+i));
+				__m256 fx = _mm256_cvtph_ps(hx), fy = _mm256_cvtph_ps(hy);
+				__m128i h = _mm256_cvtps_ph(O::f16c(fx, fy), _MM_FROUND_CUR_DIRECTION), a = _mm_and_si128(h, abs);
+				int exact = _mm256_movemask_ps(O::f16c_exact(fx, fy, _mm256_cvtph_ps(h)));
+				if(int rare = _mm_movemask_epi8(_mm_or_si128(_mm_cmpgt_epi16(a, max), _mm_cmpgt_epi16(min, a))))
+				{
+				#if HALF_ENABLE_SSE2_INTRINSICS
+					uint16 vx[8], vy[8], r[8];
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(vx), hx);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(vy), hy);
+					if(R != std::round_to_nearest)
+						_mm_setcsr(0x1F80);
+					for(unsigned int j=0; j<8; j+=V::size)
+						V::store(r+j, O::template simd<V>(V::load(vx+j), V::load(vy+j), flags));
+					if(R != std::round_to_nearest)
+						_mm_setcsr(mode);
+					h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r));
+					exact = 0xFF;
+				#else
+					half r[8];
+				#if HALF_ERRHANDLING_FENV
+					_mm_setcsr(csr);
+				#endif
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(r), h);
+					for(unsigned int j=0; j<8; ++j)
+					{
+						if(rare & (1<<(2*j)))
+						{
+							r[j] = O::scalar(x[incx*(i+j)], y[incy*(i+j)]);
+							exact |= 1 << j;
+						}
+					}
+					h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r));
+				#if HALF_ERRHANDLING_FENV
+					csr = _mm_getcsr();
+					_mm_setcsr(mode);
+				#endif
+				#endif
+				}
+				inexact |= ~exact & 0xFF;
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out+i), h);
+			}
+			_mm_setcsr(csr);
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			raise(V::reduce_or(flags));
+		#endif
+			raise(FE_INEXACT, inexact != 0);
+			return i;
+		}
+	#endif
+
+		/// Binary operation on arrays.
+		/// This uses the [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) implementation or the [AVX2](\ref HALF_ENABLE_AVX2_INTRINSICS) 
+		/// or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) integer implementation if available and computes the remaining elements with 
+		/// the scalar operation. The vectorized implementations are not used if half-precision operations are computed in 
+		/// [another type](\ref HALF_ARITHMETIC_TYPE) or if exceptions set `errno` or throw C++ exceptions, since those would 
+		/// happen at a different point than for the scalar operations.
+		/// \tparam O operation to compute
+		/// \param x first operand array
+		/// \param incx 1 to step through \a x or 0 to broadcast a single value
+		/// \param y second operand array
+		/// \param incy 1 to step through \a y or 0 to broadcast a single value
+		/// \param out array to store results at
+		/// \param n number of elements
+		/// \exception FE_... according to \a O
+		template<typename O> void array_op(const half *x, std::size_t incx, const half *y, std::size_t incy, half *out, std::size_t n)
+		{
+			std::size_t i = 0;
+		#if !defined(HALF_ARITHMETIC_TYPE) && !HALF_ERRHANDLING_ERRNO && !HALF_ERRHANDLING_THROWS
+			if(sizeof(half) == sizeof(uint16))
+			{
+			#if HALF_ENABLE_F16C_INTRINSICS
+				i = f16c_array<O>(x, incx, y, incy, out, n);
+			#elif HALF_ENABLE_AVX2_INTRINSICS
+				i = simd_array<avx2,&O::template simd<avx2> >(x, incx, y, incy, out, n);
+			#elif HALF_ENABLE_SSE2_INTRINSICS
+				i = simd_array<sse2,&O::template simd<sse2> >(x, incx, y, incy, out, n);
+			#endif
+			}
+		#endif
+			for(; i<n; ++i)
+				out[i] = O::scalar(x[incx*i], y[incy*i]);
+		}
+
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		/// Round half-precision values to integral values.
+		/// This computes the same as integral() for 8 values at a time. The powers of two of the last integral place are 
+		/// computed by converting their exponents to single-precision.
+		/// \tparam R rounding mode to use
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \param x 8 half-precision values
+		/// \param inexact vector to set all bits of lanes in that would raise FE_INEXACT
+		/// \param invalid vector to set all bits of signaling NaN lanes in
+		/// \return 8 half-precision integral values
+		template<std::float_round_style R,bool E> inline __m128i sse2_integral(__m128i x, __m128i &inexact, __m128i &invalid)
+		{
+			__m128i zero = _mm_setzero_si128(), a = _mm_and_si128(x, _mm_set1_epi16(0x7FFF)), s = _mm_srai_epi16(x, 15);
+			__m128i low = _mm_cmplt_epi16(a, _mm_set1_epi16(0x3C00)), high = _mm_cmpgt_epi16(a, _mm_set1_epi16(0x63FF));
+			__m128i nan = _mm_cmpgt_epi16(a, _mm_set1_epi16(0x7C00));
+			__m128i one =	(R==std::round_to_nearest) ? _mm_cmpgt_epi16(a, _mm_set1_epi16(0x37FF+E)) :
+							(R==std::round_toward_infinity) ? _mm_cmpgt_epi16(x, zero) :
+							(R==std::round_toward_neg_infinity) ? _mm_andnot_si128(_mm_cmpeq_epi16(a, zero), s) :
+							zero;
+			__m128i e = _mm_sub_epi16(_mm_set1_epi16(152), _mm_min_epi16(_mm_max_epi16(_mm_srli_epi16(a, 10), _mm_set1_epi16(15)), _mm_set1_epi16(24)));
+			__m128i unit = _mm_packs_epi32(_mm_cvttps_epi32(_mm_castsi128_ps(_mm_slli_epi32(_mm_unpacklo_epi16(e, zero), 23))), 
+				_mm_cvttps_epi32(_mm_castsi128_ps(_mm_slli_epi32(_mm_unpackhi_epi16(e, zero), 23))));
+			__m128i mask = _mm_sub_epi16(unit, _mm_set1_epi16(1));
+			__m128i add =	(R==std::round_to_nearest) ? (E ? _mm_add_epi16(_mm_srli_epi16(unit, 1), _mm_cmpeq_epi16(_mm_and_si128(x, unit), zero)) : 
+															  _mm_srli_epi16(unit, 1)) :
+							(R==std::round_toward_infinity) ? _mm_andnot_si128(s, mask) :
+							(R==std::round_toward_neg_infinity) ? _mm_and_si128(s, mask) :
+							zero;
+			__m128i mid = _mm_andnot_si128(_mm_or_si128(low, high), _mm_andnot_si128(mask, _mm_add_epi16(x, add)));
+			inexact = _mm_or_si128(inexact, _mm_or_si128(low, _mm_andnot_si128(_mm_or_si128(high, _mm_cmpeq_epi16(_mm_and_si128(x, mask), zero)), 
+				_mm_set1_epi16(-1))));
+			invalid = _mm_or_si128(invalid, _mm_and_si128(nan, _mm_cmpeq_epi16(_mm_and_si128(x, _mm_set1_epi16(0x200)), zero)));
+			return _mm_or_si128(mid, _mm_or_si128(
+				_mm_and_si128(low, _mm_or_si128(_mm_and_si128(x, _mm_set1_epi16(static_cast<short>(0x8000))), _mm_and_si128(one, _mm_set1_epi16(0x3C00)))), 
+				_mm_and_si128(high, _mm_or_si128(x, _mm_and_si128(nan, _mm_set1_epi16(0x200))))));
+		}
+	#endif
+
+		/// Round arrays to integral values.
+		/// This rounds 8 values at a time with 16-bit [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) integer operations if available 
+		/// and computes the remaining elements with the scalar function. The vectorized implementation is not used if 
+		/// exceptions set `errno` or throw C++ exceptions, since those would happen at a different point than for the scalar 
+		/// function.
+		/// \tparam R rounding mode to use
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \tparam I `true` to raise INEXACT exception (if inexact), `false` to never raise it
+		/// \tparam F scalar function rounding the same way
+		/// \param x array of values
+		/// \param out array to store results at
+		/// \param n number of elements
+		/// \exception FE_INVALID for signaling NaNs
+		/// \exception FE_INEXACT if values had to be rounded and \a I is `true`
+		template<std::float_round_style R,bool E,bool I,half(*F)(half)> void integral_array(const half *x, half *out, std::size_t n)
+		{
+			std::size_t i = 0;
+		#if HALF_ENABLE_SSE2_INTRINSICS && !HALF_ERRHANDLING_ERRNO && !HALF_ERRHANDLING_THROWS
+			if(sizeof(half) == sizeof(uint16))
+			{
+				__m128i inexact = _mm_setzero_si128(), invalid = inexact;
+				for(; i+8<=n; i+=8)
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out+i), 
+						sse2_integral<R,E>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i)), inexact, invalid));
+				raise(FE_INVALID, _mm_movemask_epi8(invalid) != 0);
+				raise(FE_INEXACT, I && _mm_movemask_epi8(inexact) != 0);
+			}
+		#endif
+			for(; i<n; ++i)
+				out[i] = F(x[i]);
+		}
+
+		/// Round arrays to saturated integers.
+		/// This rounds 8 values at a time to integral values like integral_array() and converts them to integers exactly via 
+		/// single-precision with [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available and \a T is a signed 16-bit or 32-bit 
+		/// integer type. Results that are not representable in \a T are saturated.
+		/// \tparam R rounding mode to use
+		/// \tparam E `true` for round to even, `false` for round away from zero
+		/// \tparam I `true` to raise INEXACT exception (if inexact), `false` to never raise it
+		/// \tparam F scalar function rounding the same way
+		/// \tparam T signed integer type to convert to
+		/// \param x array of values
+		/// \param out array to store results at
+		/// \param n number of elements
+		/// \exception FE_INVALID for NaNs, infinities and values not representable in \a T
+		/// \exception FE_INEXACT if values had to be rounded and \a I is `true`
+		template<std::float_round_style R,bool E,bool I,long(*F)(half),typename T> void integral_array(const half *x, T *out, std::size_t n)
+		{
+			std::size_t i = 0;
+		#if HALF_ENABLE_SSE2_INTRINSICS && !HALF_ERRHANDLING_ERRNO && !HALF_ERRHANDLING_THROWS
+			if(sizeof(half) == sizeof(uint16) && std::numeric_limits<T>::is_signed && 
+				((sizeof(T) == 2 && std::numeric_limits<T>::digits == 15) || (sizeof(T) == 4 && std::numeric_limits<T>::digits == 31)))
+			{
+				__m128i zero = _mm_setzero_si128(), inexact = zero, invalid = zero, snan = zero;
+				for(; i+8<=n; i+=8)
+				{
+					__m128i h = sse2_integral<R,E>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i)), inexact, snan);
+					__m128i a = _mm_and_si128(h, _mm_set1_epi16(0x7FFF)), s = _mm_srai_epi16(h, 15);
+					__m128i slo = _mm_unpacklo_epi16(s, s), shi = _mm_unpackhi_epi16(s, s);
+					__m128i lo = _mm_cvttps_epi32(_mm_castsi128_ps(_mm_add_epi32(_mm_slli_epi32(_mm_unpacklo_epi16(a, zero), 13), _mm_set1_epi32(112<<23))));
+					__m128i hi = _mm_cvttps_epi32(_mm_castsi128_ps(_mm_add_epi32(_mm_slli_epi32(_mm_unpackhi_epi16(a, zero), 13), _mm_set1_epi32(112<<23))));
+					lo = _mm_sub_epi32(_mm_xor_si128(lo, slo), slo);
+					hi = _mm_sub_epi32(_mm_xor_si128(hi, shi), shi);
+					if(sizeof(T) == 2)
+					{
+						invalid = _mm_or_si128(invalid, _mm_cmpgt_epi16(a, _mm_sub_epi16(_mm_set1_epi16(0x77FF), s)));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(out+i), _mm_packs_epi32(lo, hi));
+					}
+					else
+					{
+						__m128i inf = _mm_cmpgt_epi16(a, _mm_set1_epi16(0x7BFF)), ilo = _mm_unpacklo_epi16(inf, inf), ihi = _mm_unpackhi_epi16(inf, inf);
+						invalid = _mm_or_si128(invalid, inf);
+						lo = _mm_or_si128(_mm_andnot_si128(ilo, lo), _mm_and_si128(ilo, _mm_xor_si128(slo, _mm_set1_epi32(0x7FFFFFFF))));
+						hi = _mm_or_si128(_mm_andnot_si128(ihi, hi), _mm_and_si128(ihi, _mm_xor_si128(shi, _mm_set1_epi32(0x7FFFFFFF))));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(out+i), lo);
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(out+i+4), hi);
+					}
+				}
+				raise(FE_INVALID, _mm_movemask_epi8(invalid) != 0);
+				raise(FE_INEXACT, I && _mm_movemask_epi8(inexact) != 0);
+			}
+		#endif
+			for(; i<n; ++i)
+			{
+				long value = F(x[i]);
+				raise(FE_INVALID, value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max());
+				out[i] = static_cast<T>(std::min<long>(std::max<long>(value, std::numeric_limits<T>::min()), std::numeric_limits<T>::max()));
+			}
+		}
+
+	#if HALF_ENABLE_F16C_INTRINSICS
+		/// Sum rounded to odd single-precision.
+		/// This computes the exact sum of two double-precision values, as obtained from half-precision values and their 
+		/// products, rounded to single-precision with rounding to odd. Rounding this result to half-precision in any mode then 
+		/// gives the correctly rounded sum, since single-precision has more than 2 bits more precision than half-precision. 
+		/// This requires the MXCSR rounding mode to be set to round to nearest.
+		/// \param a first summands, multiples of 2^-48 smaller than 2^33
+		/// \param b second summands, multiples of 2^-48 smaller than 2^33
+		/// \param exact vector to store all bits set for exact sums at
+		/// \return sums rounded to odd
+		inline __m128 f16c_sum_to_odd(__m256d a, __m256d b, __m128 &exact)
+		{
+			__m256d s = _mm256_add_pd(a, b), bb = _mm256_sub_pd(s, a);
+			__m256d e = _mm256_add_pd(_mm256_sub_pd(a, _mm256_sub_pd(s, bb)), _mm256_sub_pd(b, bb));
+			__m128 f = _mm256_cvtpd_ps(s), r = _mm256_cvtpd_ps(_mm256_add_pd(_mm256_sub_pd(s, _mm256_cvtps_pd(f)), e));
+			__m128i fb = _mm_castps_si128(f), rb = _mm_castps_si128(r);
+			exact = _mm_cmpeq_ps(r, _mm_setzero_ps());
+			__m128i adjust = _mm_andnot_si128(_mm_castps_si128(exact), _mm_cmpeq_epi32(_mm_and_si128(fb, _mm_set1_epi32(1)), _mm_setzero_si128()));
+			return _mm_castsi128_ps(_mm_add_epi32(fb, _mm_and_si128(adjust, _mm_or_si128(_mm_srai_epi32(_mm_xor_si128(fb, rb), 31), _mm_set1_epi32(1)))));
+		}
+
+		/// Single-precision fused multiply add on arrays.
+		/// This computes 8 results at once. The products of half-precision values are exact in single-precision and their 
+		/// sums with half-precision values are computed exactly in double-precision with an error term, which is used to 
+		/// round the sums to odd single-precision values that give the correctly rounded result when rounded to half-precision. 
+		/// Lanes with zero, subnormal, infinite, NaN or largest finite results are recomputed with the scalar function.
+		/// \param x first operand array
+		/// \param incx 1 to step through \a x or 0 to broadcast a single value
+		/// \param y second operand array
+		/// \param incy 1 to step through \a y or 0 to broadcast a single value
+		/// \param z third operand array
+		/// \param incz 1 to step through \a z or 0 to broadcast a single value
+		/// \param out array to store results at
+		/// \param n number of elements
+		/// \return number of elements processed
+		/// \exception FE_... according to fma(half,half,half)
+		inline std::size_t f16c_fma(const half *x, std::size_t incx, const half *y, std::size_t incy, const half *z, std::size_t incz, half *out, std::size_t n)
+		{
+			const std::float_round_style R = std::numeric_limits<half>::round_style;
+			const int mode = (R==std::round_to_nearest) ? _MM_FROUND_TO_NEAREST_INT : (R==std::round_toward_infinity) ? _MM_FROUND_TO_POS_INF : 
+				(R==std::round_toward_neg_infinity) ? _MM_FROUND_TO_NEG_INF : _MM_FROUND_TO_ZERO;
+			unsigned int csr = _mm_getcsr();
+			_mm_setcsr(0x1F80);
+			__m256 fx = _mm256_cvtph_ps(_mm_set1_epi16(static_cast<short>(incx ? 0 : *reinterpret_cast<const uint16*>(x))));
+			__m256 fy = _mm256_cvtph_ps(_mm_set1_epi16(static_cast<short>(incy ? 0 : *reinterpret_cast<const uint16*>(y))));
+			__m256 fz = _mm256_cvtph_ps(_mm_set1_epi16(static_cast<short>(incz ? 0 : *reinterpret_cast<const uint16*>(z))));
+			__m128i abs = _mm_set1_epi16(0x7FFF), max = _mm_set1_epi16(0x7BFE), min = _mm_set1_epi16(0x400);
+			int inexact = 0;
+			std::size_t i = 0;
+			for(; i+8<=n; i+=8)
+			{
+				if(incx)
+					fx = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i)));
+				if(incy)
+					fy = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(y+i)));
+				if(incz)
+					fz = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(z+i)));
+				__m256 p = _mm256_mul_ps(fx, fy);
+				__m128 elo, ehi;
+				__m128 lo = f16c_sum_to_odd(_mm256_cvtps_pd(_mm256_castps256_ps128(p)), _mm256_cvtps_pd(_mm256_castps256_ps128(fz)), elo);
+				__m128 hi = f16c_sum_to_odd(_mm256_cvtps_pd(_mm256_extractf128_ps(p, 1)), _mm256_cvtps_pd(_mm256_extractf128_ps(fz, 1)), ehi);
+				__m256 f = _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+				__m128i h = _mm256_cvtps_ph(f, mode), a = _mm_and_si128(h, abs);
+				int exact = _mm256_movemask_ps(_mm256_and_ps(_mm256_insertf128_ps(_mm256_castps128_ps256(elo), ehi, 1), 
+					_mm256_cmp_ps(_mm256_cvtph_ps(h), f, _CMP_EQ_OQ)));
+				if(int rare = _mm_movemask_epi8(_mm_or_si128(_mm_cmpgt_epi16(a, max), _mm_cmpgt_epi16(min, a))))
+				{
+					half r[8];
+				#if HALF_ERRHANDLING_FENV
+					_mm_setcsr(csr);
+				#endif
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(r), h);
+					for(unsigned int j=0; j<8; ++j)
+					{
+						if(rare & (1<<(2*j)))
+						{
+							r[j] = fma(x[incx*(i+j)], y[incy*(i+j)], z[incz*(i+j)]);
+							exact |= 1 << j;
+						}
+					}
+					h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(r));
+				#if HALF_ERRHANDLING_FENV
+					csr = _mm_getcsr();
+					_mm_setcsr(0x1F80);
+				#endif
+				}
+				inexact |= ~exact & 0xFF;
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(out+i), h);
+			}
+			_mm_setcsr(csr);
+			raise(FE_INEXACT, inexact != 0);
+			return i;
+		}
+	#endif
+
+		/// Fused multiply add on arrays.
+		/// This uses the [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) implementation if available under the same conditions as 
+		/// array_op() and computes the remaining elements with the scalar function.
+		/// \param x first operand array
+		/// \param incx 1 to step through \a x or 0 to broadcast a single value
+		/// \param y second operand array
+		/// \param incy 1 to step through \a y or 0 to broadcast a single value
+		/// \param z third operand array
+		/// \param incz 1 to step through \a z or 0 to broadcast a single value
+		/// \param out array to store results at
+		/// \param n number of elements
+		/// \exception FE_... according to fma(half,half,half)
+		inline void array_fma(const half *x, std::size_t incx, const half *y, std::size_t incy, const half *z, std::size_t incz, half *out, std::size_t n)
+		{
+			std::size_t i = 0;
+		#if HALF_ENABLE_F16C_INTRINSICS && !defined(HALF_ARITHMETIC_TYPE) && !HALF_ERRHANDLING_ERRNO && !HALF_ERRHANDLING_THROWS
+			if(sizeof(half) == sizeof(uint16))
+				i = f16c_fma(x, incx, y, incy, z, incz, out, n);
+		#endif
+			for(; i<n; ++i)
+				out[i] = fma(x[incx*i], y[incy*i], z[incz*i]);
+		}
+
+		/// Exact fixed-point sum.
+		/// This stores sums of half-precision values and their products exactly as 128-bit two's complement fixed-point 
+		/// number with 48 fractional bits, which is enough for at least 2^47 products of the largest finite values, together 
+		/// with the infinities and NaNs encountered and the signs of zero addends for the sign of a zero result.
+		struct fixed_sum
+		{
+			/// Default constructor.
+			fixed_sum() : special(0) { limbs[0] = limbs[1] = limbs[2] = limbs[3] = 0; }
+
+			/// Add shifted integer.
+			/// \param lo lower 32 bits of integer
+			/// \param hi upper bits of integer, smaller than 2^21
+			/// \param s number of bits to shift integer left by, at most 64
+			/// \param neg `true` to subtract instead of add
+			void add(uint32 lo, uint32 hi, unsigned int s, bool neg)
+			{
+				unsigned int k = s >> 5, r = s & 31;
+				uint32 v[3] = { (lo<<r) & 0xFFFFFFFF, r ? (((hi<<r)|(lo>>(32-r))) & 0xFFFFFFFF) : hi, r ? (hi>>(32-r)) : 0 };
+				uint32 mask = neg ? 0xFFFFFFFF : 0, c = neg;
+				for(unsigned int j=k; j<4; ++j)
+				{
+					uint32 d = ((j-k<3) ? v[j-k] : 0) ^ mask, t = (limbs[j]+d) & 0xFFFFFFFF, u = (t+c) & 0xFFFFFFFF;
+					c = (t<d) | (u<t);
+					limbs[j] = u;
+				}
+			}
+
+			/// Add shifted integer.
+			/// \param v integral value smaller than 2^53 in magnitude
+			/// \param s number of bits to shift value left by, at most 40
+			void add(double v, unsigned int s)
+			{
+				bool neg = v < 0.0;
+				if(neg)
+					v = -v;
+				uint32 hi = static_cast<uint32>(v/4294967296.0);
+				add(static_cast<uint32>(v-static_cast<double>(hi)*4294967296.0), hi, s, neg);
+			}
+
+			/// Add other sum.
+			/// \param other fixed-point sum to add
+			void add(const fixed_sum &other)
+			{
+				uint32 c = 0;
+				for(unsigned int j=0; j<4; ++j)
+				{
+					uint32 t = (limbs[j]+other.limbs[j]) & 0xFFFFFFFF, u = (t+c) & 0xFFFFFFFF;
+					c = (t<limbs[j]) | (u<t);
+					limbs[j] = u;
+				}
+				special |= other.special;
+			}
+
+			/// Add half-precision value.
+			/// \param x value to add
+			void add_value(half x)
+			{
+				unsigned int abs = x.data_ & 0x7FFF, e = abs >> 10;
+				if(abs >= 0x7C00)
+					special |= (abs>0x7C00) ? ((abs&0x200) ? 4 : 12) : (x.data_>>15) ? 2 : 1;
+				else if(abs)
+				{
+					special |= 48;
+					add((abs&0x3FF)|((e!=0)<<10), 0, e+(e==0)+23, (x.data_>>15)!=0);
+				}
+				else
+					special |= (x.data_>>15) ? 32 : 16;
+			}
+
+			/// Add half-precision values.
+			/// Finite values are accumulated in 32-bit integers for each sign and exponent over blocks of 65536 elements, 
+			/// which are then added to the fixed-point value.
+			/// \param x array of values
+			/// \param n number of elements
+			void add_values(const half *x, std::size_t n)
+			{
+				for(std::size_t i=0; i<n; )
+				{
+					uint32 bins[2][31] = { { 0 } };
+					for(std::size_t end=i+std::min(n-i, static_cast<std::size_t>(65536)); i<end; ++i)
+					{
+						unsigned int abs = x[i].data_ & 0x7FFF, e = abs >> 10;
+						if(abs >= 0x7C00)
+							add_value(x[i]);
+						else
+						{
+							special |= abs ? 48 : (x[i].data_>>15) ? 32 : 16;
+							bins[x[i].data_>>15][e+(e==0)] += (abs&0x3FF) | ((e!=0)<<10);
+						}
+					}
+					for(unsigned int j=1; j<31; ++j)
+					{
+						if(bins[0][j])
+							add(bins[0][j], 0, j+23, false);
+						if(bins[1][j])
+							add(bins[1][j], 0, j+23, true);
+					}
+				}
+			}
+
+			/// Add product of half-precision values.
+			/// \param x first factor
+			/// \param y second factor
+			void add_product(half x, half y)
+			{
+				unsigned int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, sign = (x.data_^y.data_) & 0x8000;
+				if(absx >= 0x7C00 || absy >= 0x7C00)
+				{
+					if(absx > 0x7C00 || absy > 0x7C00)
+						special |= ((absx>0x7C00 && !(absx&0x200)) || (absy>0x7C00 && !(absy&0x200))) ? 12 : 4;
+					else
+						special |= (!absx || !absy) ? 12 : sign ? 2 : 1;
+				}
+				else if(absx && absy)
+				{
+					unsigned int ex = absx >> 10, ey = absy >> 10;
+					uint32 m = static_cast<uint32>((absx&0x3FF)|((ex!=0)<<10)) * ((absy&0x3FF)|((ey!=0)<<10));
+					special |= 48;
+					add(m, 0, ex+(ex==0)+ey+(ey==0)-2, sign!=0);
+				}
+				else
+					special |= sign ? 32 : 16;
+			}
+
+			/// Add products of half-precision arrays.
+			/// Finite products are accumulated in 32-bit integers for each sign and exponent over blocks of 1024 elements, 
+			/// which are then added to the fixed-point value.
+			/// \param x first array
+			/// \param y second array
+			/// \param n number of elements
+			void add_products(const half *x, const half *y, std::size_t n)
+			{
+				for(std::size_t i=0; i<n; )
+				{
+					uint32 bins[2][59] = { { 0 } };
+					for(std::size_t end=i+std::min(n-i, static_cast<std::size_t>(1024)); i<end; ++i)
+					{
+						unsigned int absx = x[i].data_ & 0x7FFF, absy = y[i].data_ & 0x7FFF, sign = (x[i].data_^y[i].data_) >> 15;
+						if(absx >= 0x7C00 || absy >= 0x7C00)
+							add_product(x[i], y[i]);
+						else
+						{
+							unsigned int ex = absx >> 10, ey = absy >> 10;
+							special |= (absx && absy) ? 48 : sign ? 32 : 16;
+							bins[sign][ex+(ex==0)+ey+(ey==0)-2] += static_cast<uint32>((absx&0x3FF)|((ex!=0)<<10)) * ((absy&0x3FF)|((ey!=0)<<10));
+						}
+					}
+					for(unsigned int j=0; j<59; ++j)
+					{
+						if(bins[0][j])
+							add(bins[0][j], 0, j, false);
+						if(bins[1][j])
+							add(bins[1][j], 0, j, true);
+					}
+				}
+			}
+
+			/// Extract most significant bits of magnitude.
+			/// \param m array to store 64 most significant bits at, most significant bit set and most significant word first
+			/// \param s variable to store sticky bit for remaining bits at
+			/// \param sign variable to store half-precision sign bit at
+			/// \return position of most significant bit in fixed-point value, -1 for zero
+			int normalize(uint32 *m, int &s, unsigned int &sign) const
+			{
+				uint32 a[4], c = limbs[3] >> 31, mask = c ? 0xFFFFFFFF : 0;
+				for(unsigned int j=0; j<4; ++j)
+				{
+					a[j] = ((limbs[j]^mask)+c) & 0xFFFFFFFF;
+					c &= a[j] == 0;
+				}
+				sign = mask & 0x8000;
+				int k = 3;
+				for(; k>=0 && !a[k]; --k) ;
+				if(k < 0)
+					return -1;
+				uint32 lo = (k>1) ? a[k-2] : 0;
+				int b = 31;
+				m[0] = a[k];
+				m[1] = (k>0) ? a[k-1] : 0;
+				s = k > 2 && a[0] != 0;
+				for(; !(m[0]>>b); --b) ;
+				if(b < 31)
+				{
+					m[0] = ((m[0]<<(31-b))|(m[1]>>(b+1))) & 0xFFFFFFFF;
+					m[1] = ((m[1]<<(31-b))|(lo>>(b+1))) & 0xFFFFFFFF;
+					lo = (lo<<(31-b)) & 0xFFFFFFFF;
+				}
+				s |= lo != 0;
+				return 32*k + b;
+			}
+
+			/// Sign of zero sum.
+			/// This is negative if all addends were negative zeros or if any addend was not a positive zero when rounding 
+			/// towards negative infinity.
+			/// \tparam R rounding mode to use
+			/// \return half-precision value with sign bit only
+			template<std::float_round_style R> unsigned int zero_sign() const
+			{
+				return ((special&32) && (!(special&16) || R==std::round_toward_neg_infinity)) ? 0x8000 : 0;
+			}
+
+			/// Convert to double-precision.
+			/// \return sum rounded to nearest double-precision value
+			double to_double() const
+			{
+				if(special & 15)
+					return ((special&12) || (special&3)==3) ? std::numeric_limits<double>::quiet_NaN() : 
+						(special&2) ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+				uint32 m[2];
+				int s;
+				unsigned int sign;
+				int exp = normalize(m, s, sign);
+				if(exp < 0)
+					return zero_sign<std::round_to_nearest>() ? -0.0 : 0.0;
+				s |= (m[1]&0x3FF) != 0;
+				double d = static_cast<double>(m[0])*2097152.0 + static_cast<double>((m[1]>>11)+((m[1]>>10)&(s|(m[1]>>11))&1));
+				return std::ldexp(sign ? -d : d, exp-100);
+			}
+
+			/// Convert to half-precision.
+			/// \tparam R rounding mode to use
+			/// \return sum rounded to half-precision
+			/// \exception FE_INVALID for signaling NaN addends, infinity times zero or infinities of different sign
+			/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+			template<std::float_round_style R> half to_half() const
+			{
+				if(special & 15)
+					return half(binary, ((special&8) || (special&3)==3) ? invalid() : (special&4) ? 0x7FFF : (special&2) ? 0xFC00 : 0x7C00);
+				uint32 m[2];
+				int s;
+				unsigned int sign;
+				int exp = normalize(m, s, sign) - 34;
+				if(exp < -34)
+					return half(binary, zero_sign<R>());
+				if(exp > 29)
+					return half(binary, overflow<R>(sign));
+				if(exp < -10)
+					return half(binary, rounded<R,false>(sign, exp==-11, exp<-11 || ((m[0]&0x7FFFFFFF)|m[1]|s)!=0));
+				return half(binary, fixed2half<R,31,false,false,false>(m[0], exp, sign, (m[1]|s)!=0));
+			}
+
+			/// Square root converted to half-precision.
+			/// This requires the sum to be non-negative, like a sum of squares.
+			/// \tparam R rounding mode to use
+			/// \return square root of sum rounded to half-precision
+			/// \exception FE_INVALID for signaling NaN addends
+			/// \exception FE_OVERFLOW, ...INEXACT according to rounding
+			template<std::float_round_style R> half sqrt_to_half() const
+			{
+				if(special & 15)
+				{
+					raise(FE_INVALID, (special&8) != 0);
+					return half(binary, (special&1) ? 0x7C00 : 0x7FFF);
+				}
+				uint32 m[2];
+				int s;
+				unsigned int sign;
+				int exp = normalize(m, s, sign) - 48;
+				if(exp < -48)
+					return half(binary, 0);
+				if(exp > 31)
+					return half(binary, overflow<R>());
+				uint32 r = m[0] >> 1;
+				s |= (m[0]&1) | (m[1]!=0);
+				uint32 mr = sqrt<30>(r, exp);
+				return half(binary, fixed2half<R,15,false,false,false>(mr, exp+14, 0, s|(r!=0)));
+			}
+
+			/// Limbs of fixed-point value in 32-bit units, least significant first.
+			uint32 limbs[4];
+
+			/// Special addends encountered (1 for positive infinity, 2 for negative infinity, 4 for NaN, 8 for invalid 
+			/// operations, 16 for any addend but negative zero, 32 for any addend but positive zero).
+			unsigned int special;
+		};
+
+	#if HALF_ENABLE_F16C_INTRINSICS
+		/// Load and convert half-precision values.
+		/// \param p address of 8 half-precision values
+		/// \return single-precision values
+		inline __m256 f16c_load(const half *p) { return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))); }
+
+		/// Convert and store half-precision values.
+		/// This uses the half-precision rounding mode. Since F16C does not report floating-point exceptions, these are 
+		/// determined from the converted values with exception handling enabled.
+		/// \param p address to store 8 half-precision values at
+		/// \param a single-precision values to store
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline void f16c_store(half *p, __m256 a)
+		{
+			const int R = std::numeric_limits<half>::round_style;
+			__m128i h = _mm256_cvtps_ph(a, 
+				(R==std::round_to_nearest) ? _MM_FROUND_TO_NEAREST_INT :
+				(R==std::round_toward_zero) ? _MM_FROUND_TO_ZERO :
+				(R==std::round_toward_infinity) ? _MM_FROUND_TO_POS_INF :
+				(R==std::round_toward_neg_infinity) ? _MM_FROUND_TO_NEG_INF :
+				_MM_FROUND_CUR_DIRECTION);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(p), h);
+		#if HALF_ERRHANDLING
+			__m256 b = _mm256_cvtph_ps(h), sign = _mm256_set1_ps(-0.0f), inf = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+			__m256 aa = _mm256_andnot_ps(sign, a), ab = _mm256_andnot_ps(sign, b);
+			__m256 over = _mm256_and_ps(_mm256_cmp_ps(aa, inf, _CMP_LT_OQ), _mm256_or_ps(
+				_mm256_cmp_ps(aa, _mm256_set1_ps(65536.0f), _CMP_GE_OQ), _mm256_cmp_ps(ab, inf, _CMP_EQ_OQ)));
+			__m256 under = _mm256_and_ps(_mm256_cmp_ps(ab, _mm256_set1_ps(6.10351562e-5f), _CMP_LT_OQ), 
+				_mm256_cmp_ps(aa, _mm256_setzero_ps(), _CMP_NEQ_OQ));
+			__m256 inexact = _mm256_andnot_ps(over, _mm256_cmp_ps(a, b, _CMP_NEQ_OQ));
+			raise(FE_OVERFLOW, _mm256_movemask_ps(over) != 0);
+			raise(FE_UNDERFLOW, _mm256_movemask_ps(HALF_ERRHANDLING_UNDERFLOW_TO_INEXACT ? 
+				_mm256_and_ps(under, inexact) : under) != 0);
+			raise(FE_INEXACT, _mm256_movemask_ps(_mm256_andnot_ps(under, inexact)) != 0);
+		#endif
+		}
+
+		/// Horizontal single-precision sum.
+		/// \param a vector to reduce
+		/// \return sum of all lanes
+		inline float f16c_hadd(__m256 a)
+		{
+			__m128 b = _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+			b = _mm_add_ps(b, _mm_movehl_ps(b, b));
+			return _mm_cvtss_f32(_mm_add_ss(b, _mm_shuffle_ps(b, b, 1)));
+		}
+
+		/// Single-precision dot product.
+		/// This accumulates 32 products at once in 4 independent vectors of partial sums. The products of half-precision values 
+		/// are exact in single-precision, so only the accumulation is rounded.
+		/// \param x first array
+		/// \param y second array
+		/// \param n number of elements
+		/// \param sum variable to add sum of products to
+		/// \return number of elements processed
+		inline std::size_t f16c_dot(const half *x, const half *y, std::size_t n, float &sum)
+		{
+			__m256 s0 = _mm256_setzero_ps(), s1 = _mm256_setzero_ps(), s2 = _mm256_setzero_ps(), s3 = _mm256_setzero_ps();
+			std::size_t i = 0;
+			for(; i+32<=n; i+=32)
+			{
+				s0 = _mm256_add_ps(s0, _mm256_mul_ps(f16c_load(x+i), f16c_load(y+i)));
+				s1 = _mm256_add_ps(s1, _mm256_mul_ps(f16c_load(x+i+8), f16c_load(y+i+8)));
+				s2 = _mm256_add_ps(s2, _mm256_mul_ps(f16c_load(x+i+16), f16c_load(y+i+16)));
+				s3 = _mm256_add_ps(s3, _mm256_mul_ps(f16c_load(x+i+24), f16c_load(y+i+24)));
+			}
+			for(; i+8<=n; i+=8)
+				s0 = _mm256_add_ps(s0, _mm256_mul_ps(f16c_load(x+i), f16c_load(y+i)));
+			sum += f16c_hadd(_mm256_add_ps(_mm256_add_ps(s0, s1), _mm256_add_ps(s2, s3)));
+			return i;
+		}
+
+		/// Exact dot product.
+		/// This computes 8 products at once, which are exact in single-precision and split into a multiple of 2^-8 and a 
+		/// remainder by adding and subtracting 1.5*2^44 in double-precision. Both parts are accumulated exactly in 
+		/// double-precision for blocks of 1024 products per lane, which keeps them small enough for the sums of all lanes to 
+		/// be exact too, and then added to the fixed-point sum. Vectors with infinite or NaN operands are added with the 
+		/// scalar implementation.
+		/// \param x first array
+		/// \param y second array
+		/// \param n number of elements
+		/// \param sum fixed-point sum to add products to
+		/// \return number of elements processed
+		inline std::size_t f16c_dot(const half *x, const half *y, std::size_t n, fixed_sum &sum)
+		{
+			const __m256d split = _mm256_set1_pd(26388279066624.0);
+			const __m128i abs = _mm_set1_epi16(0x7FFF), max = _mm_set1_epi16(0x7BFF);
+			std::size_t i = 0;
+			while(i+8 <= n)
+			{
+				__m256d h0 = _mm256_setzero_pd(), h1 = _mm256_setzero_pd(), l0 = _mm256_setzero_pd(), l1 = _mm256_setzero_pd();
+				__m256 pos = _mm256_setzero_ps(), neg = _mm256_setzero_ps();
+				for(std::size_t end=i+std::min(n-i, static_cast<std::size_t>(8192)); i+8<=end; i+=8)
+				{
+					__m128i hx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i)), hy = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y+i));
+					if(_mm_movemask_epi8(_mm_or_si128(_mm_cmpgt_epi16(_mm_and_si128(hx, abs), max), _mm_cmpgt_epi16(_mm_and_si128(hy, abs), max))))
+					{
+						for(unsigned int j=0; j<8; ++j)
+							sum.add_product(x[i+j], y[i+j]);
+						continue;
+					}
+					__m256 p = _mm256_mul_ps(_mm256_cvtph_ps(hx), _mm256_cvtph_ps(hy));
+					pos = _mm256_or_ps(pos, _mm256_xor_ps(p, _mm256_set1_ps(-0.0f)));
+					neg = _mm256_or_ps(neg, p);
+					__m256d p0 = _mm256_cvtps_pd(_mm256_castps256_ps128(p)), p1 = _mm256_cvtps_pd(_mm256_extractf128_ps(p, 1));
+					__m256d t0 = _mm256_sub_pd(_mm256_add_pd(p0, split), split), t1 = _mm256_sub_pd(_mm256_add_pd(p1, split), split);
+					h0 = _mm256_add_pd(h0, t0);
+					h1 = _mm256_add_pd(h1, t1);
+					l0 = _mm256_add_pd(l0, _mm256_sub_pd(p0, t0));
+					l1 = _mm256_add_pd(l1, _mm256_sub_pd(p1, t1));
+				}
+				__m256d h = _mm256_add_pd(h0, h1), l = _mm256_add_pd(l0, l1);
+				__m128d hl = _mm_add_pd(_mm256_castpd256_pd128(h), _mm256_extractf128_pd(h, 1));
+				__m128d ll = _mm_add_pd(_mm256_castpd256_pd128(l), _mm256_extractf128_pd(l, 1));
+				sum.add(_mm_cvtsd_f64(_mm_add_sd(hl, _mm_unpackhi_pd(hl, hl)))*256.0, 40);
+				sum.add(_mm_cvtsd_f64(_mm_add_sd(ll, _mm_unpackhi_pd(ll, ll)))*281474976710656.0, 0);
+				sum.special |= (_mm256_testz_si256(_mm256_castps_si256(pos), _mm256_castps_si256(pos)) ? 0 : 16) | 
+					(_mm256_testz_si256(_mm256_castps_si256(neg), _mm256_castps_si256(neg)) ? 0 : 32);
+			}
+			return i;
+		}
+
+		/// Exact sum.
+		/// This converts 16 values at once to double-precision and accumulates them exactly in 4 independent vectors of partial 
+		/// sums for blocks of 8192 values, which keeps them small enough for the sums of all lanes to be exact too, and then 
+		/// adds them to the fixed-point sum. Vectors with infinite or NaN values are added with the scalar implementation.
+		/// \param x array of values
+		/// \param n number of elements
+		/// \param sum fixed-point sum to add values to
+		/// \return number of elements processed
+		inline std::size_t f16c_sum(const half *x, std::size_t n, fixed_sum &sum)
+		{
+			const __m128i abs = _mm_set1_epi16(0x7FFF), max = _mm_set1_epi16(0x7BFF), sign = _mm_set1_epi16(static_cast<short>(0x8000));
+			std::size_t i = 0;
+			while(i+16 <= n)
+			{
+				__m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd(), s2 = _mm256_setzero_pd(), s3 = _mm256_setzero_pd();
+				__m128i pos = _mm_setzero_si128(), neg = _mm_setzero_si128();
+				for(std::size_t end=i+std::min(n-i, static_cast<std::size_t>(8192)); i+16<=end; i+=16)
+				{
+					__m128i h0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i)), h1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i+8));
+					pos = _mm_or_si128(pos, _mm_or_si128(_mm_xor_si128(h0, sign), _mm_xor_si128(h1, sign)));
+					neg = _mm_or_si128(neg, _mm_or_si128(h0, h1));
+					if(_mm_movemask_epi8(_mm_or_si128(_mm_cmpgt_epi16(_mm_and_si128(h0, abs), max), _mm_cmpgt_epi16(_mm_and_si128(h1, abs), max))))
+					{
+						for(unsigned int j=0; j<16; ++j)
+							sum.add_value(x[i+j]);
+						continue;
+					}
+					__m256 f0 = _mm256_cvtph_ps(h0), f1 = _mm256_cvtph_ps(h1);
+					s0 = _mm256_add_pd(s0, _mm256_cvtps_pd(_mm256_castps256_ps128(f0)));
+					s1 = _mm256_add_pd(s1, _mm256_cvtps_pd(_mm256_extractf128_ps(f0, 1)));
+					s2 = _mm256_add_pd(s2, _mm256_cvtps_pd(_mm256_castps256_ps128(f1)));
+					s3 = _mm256_add_pd(s3, _mm256_cvtps_pd(_mm256_extractf128_ps(f1, 1)));
+				}
+				__m256d s = _mm256_add_pd(_mm256_add_pd(s0, s1), _mm256_add_pd(s2, s3));
+				__m128d sl = _mm_add_pd(_mm256_castpd256_pd128(s), _mm256_extractf128_pd(s, 1));
+				sum.add(_mm_cvtsd_f64(_mm_add_sd(sl, _mm_unpackhi_pd(sl, sl)))*16777216.0, 24);
+				sum.special |= (_mm_movemask_epi8(_mm_cmpeq_epi16(pos, _mm_setzero_si128()))!=0xFFFF ? 16 : 0) | 
+					(_mm_movemask_epi8(_mm_cmpeq_epi16(neg, _mm_setzero_si128()))!=0xFFFF ? 32 : 0);
+			}
+			return i;
+		}
+	#elif HALF_ENABLE_SSE2_INTRINSICS
+		/// Convert half-precision to single-precision.
+		/// Normal values and infinities or NaNs only need their exponent adjusted, subnormal values are normalized by an exact 
+		/// single-precision subtraction.
+		/// \param h half-precision values in 32-bit lanes
+		/// \return single-precision values
+		inline __m128 sse2_half2float(__m128i h)
+		{
+			__m128i a = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7FFF)), 13), e = _mm_and_si128(a, _mm_set1_epi32(0x0F800000));
+			__m128i sub = _mm_cmpeq_epi32(e, _mm_setzero_si128());
+			a = _mm_add_epi32(a, _mm_add_epi32(_mm_set1_epi32(0x38000000), _mm_or_si128(_mm_and_si128(_mm_cmpeq_epi32(e, _mm_set1_epi32(0x0F800000)), 
+				_mm_set1_epi32(0x38000000)), _mm_and_si128(sub, _mm_set1_epi32(0x00800000)))));
+			__m128 f = _mm_sub_ps(_mm_castsi128_ps(a), _mm_and_ps(_mm_castsi128_ps(sub), _mm_set1_ps(6.103515625e-05f)));
+			return _mm_or_ps(f, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16)));
+		}
+
+		/// Single-precision dot product.
+		/// This accumulates 16 products at once in 4 independent vectors of partial sums.
+		/// \param x first array
+		/// \param y second array
+		/// \param n number of elements
+		/// \param sum variable to add sum of products to
+		/// \return number of elements processed
+		inline std::size_t sse2_dot(const half *x, const half *y, std::size_t n, float &sum)
+		{
+			__m128 s0 = _mm_setzero_ps(), s1 = _mm_setzero_ps(), s2 = _mm_setzero_ps(), s3 = _mm_setzero_ps();
+			std::size_t i = 0;
+			for(; i+16<=n; i+=16)
+			{
+				s0 = _mm_add_ps(s0, _mm_mul_ps(sse2_half2float(sse2::load(x+i)), sse2_half2float(sse2::load(y+i))));
+				s1 = _mm_add_ps(s1, _mm_mul_ps(sse2_half2float(sse2::load(x+i+4)), sse2_half2float(sse2::load(y+i+4))));
+				s2 = _mm_add_ps(s2, _mm_mul_ps(sse2_half2float(sse2::load(x+i+8)), sse2_half2float(sse2::load(y+i+8))));
+				s3 = _mm_add_ps(s3, _mm_mul_ps(sse2_half2float(sse2::load(x+i+12)), sse2_half2float(sse2::load(y+i+12))));
+			}
+			for(; i+4<=n; i+=4)
+				s0 = _mm_add_ps(s0, _mm_mul_ps(sse2_half2float(sse2::load(x+i)), sse2_half2float(sse2::load(y+i))));
+			s0 = _mm_add_ps(_mm_add_ps(s0, s1), _mm_add_ps(s2, s3));
+			s0 = _mm_add_ps(s0, _mm_movehl_ps(s0, s0));
+			sum += _mm_cvtss_f32(_mm_add_ss(s0, _mm_shuffle_ps(s0, s0, 1)));
+			return i;
+		}
+	#endif
+
+		/// Block sizes for pairwise reductions.
+		enum pairwise_blocking
+		{
+			pairwise_leaf = 256,		///< Largest number of elements to accumulate directly.
+			pairwise_chunk = 65536		///< Number of elements per chunk for parallel reductions.
+		};
+
+		/// Add values to exact sum.
+		/// This uses the [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) implementation if available and adds the remaining values 
+		/// with fixed_sum::add_values().
+		/// Chunks of large arrays are summed in parallel if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled.
+		/// \param x array of values
+		/// \param n number of elements
+		/// \param sum fixed-point sum to add values to
+		inline void accumulate_values(const half *x, std::size_t n, fixed_sum &sum)
+		{
+		#if HALF_ENABLE_OPENMP
+			if(n > pairwise_chunk)
+			{
+				long chunks = static_cast<long>((n+pairwise_chunk-1)/pairwise_chunk);
+				std::vector<fixed_sum> partial(chunks);
+				#pragma omp parallel for schedule(static)
+				for(long c=0; c<chunks; ++c)
+				{
+					std::size_t i = static_cast<std::size_t>(c) * pairwise_chunk;
+					accumulate_values(x+i, std::min<std::size_t>(n-i, pairwise_chunk), partial[c]);
+				}
+				for(long c=0; c<chunks; ++c)
+					sum.add(partial[c]);
+				return;
+			}
+		#endif
+			std::size_t i = 0;
+		#if HALF_ENABLE_F16C_INTRINSICS
+			if(sizeof(half) == sizeof(uint16))
+				i = f16c_sum(x, n, sum);
+		#endif
+			sum.add_values(x+i, n-i);
+		}
+
+		/// Add products to exact sum.
+		/// This uses the [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) implementation if available and adds the remaining products 
+		/// with fixed_sum::add_products().
+		/// Chunks of large arrays are summed in parallel if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled.
+		/// \param x first array
+		/// \param y second array
+		/// \param n number of elements
+		/// \param sum fixed-point sum to add products to
+		inline void accumulate_products(const half *x, const half *y, std::size_t n, fixed_sum &sum)
+		{
+		#if HALF_ENABLE_OPENMP
+			if(n > pairwise_chunk)
+			{
+				long chunks = static_cast<long>((n+pairwise_chunk-1)/pairwise_chunk);
+				std::vector<fixed_sum> partial(chunks);
+				#pragma omp parallel for schedule(static)
+				for(long c=0; c<chunks; ++c)
+				{
+					std::size_t i = static_cast<std::size_t>(c) * pairwise_chunk;
+					accumulate_products(x+i, y+i, std::min<std::size_t>(n-i, pairwise_chunk), partial[c]);
+				}
+				for(long c=0; c<chunks; ++c)
+					sum.add(partial[c]);
+				return;
+			}
+		#endif
+			std::size_t i = 0;
+		#if HALF_ENABLE_F16C_INTRINSICS
+			if(sizeof(half) == sizeof(uint16))
+				i = f16c_dot(x, y, n, sum);
+		#endif
+			sum.add_products(x+i, y+i, n-i);
+		}
+
+		/// Dot product with single-precision accumulation.
+		/// This uses the [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) implementation if 
+		/// available and accumulates the remaining products in 4 alternating partial sums.
+		/// \param x first array
+		/// \param y second array
+		/// \param n number of elements
+		/// \return sum of products
+		inline float dot(const half *x, const half *y, std::size_t n, false_type)
+		{
+			float s[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			std::size_t i = 0;
+			if(sizeof(half) == sizeof(uint16))
+			{
+			#if HALF_ENABLE_F16C_INTRINSICS
+				i = f16c_dot(x, y, n, s[0]);
+			#elif HALF_ENABLE_SSE2_INTRINSICS
+				i = sse2_dot(x, y, n, s[0]);
+			#endif
+			}
+			for(; i<n; ++i)
+				s[i&3] += static_cast<float>(x[i]) * static_cast<float>(y[i]);
+			return (s[0]+s[1]) + (s[2]+s[3]);
+		}
+
+		/// Exact dot product.
+		/// \param x first array
+		/// \param y second array
+		/// \param n number of elements
+		/// \return sum of products rounded to nearest
+		inline double dot(const half *x, const half *y, std::size_t n, true_type)
+		{
+			fixed_sum sum;
+			accumulate_products(x, y, n, sum);
+			return sum.to_double();
+		}
+
+		/// Convert half-precision array to single-precision.
+		/// This uses [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) conversions if 
+		/// available.
+		/// \param x array of values
+		/// \param out array to store single-precision values at
+		/// \param n number of elements
+		inline void half2float_array(const half *x, float *out, std::size_t n)
+		{
+			std::size_t i = 0;
+			if(sizeof(half) == sizeof(uint16))
+			{
+			#if HALF_ENABLE_F16C_INTRINSICS
+				for(; i+8<=n; i+=8)
+					_mm256_storeu_ps(out+i, f16c_load(x+i));
+			#elif HALF_ENABLE_SSE2_INTRINSICS
+				for(; i+4<=n; i+=4)
+					_mm_storeu_ps(out+i, sse2_half2float(sse2::load(x+i)));
+			#endif
+			}
+			for(; i<n; ++i)
+				out[i] = static_cast<float>(x[i]);
+		}
+
+		/// Blocking parameters for matrix multiplication.
+		/// The micro-kernel computes a block of #gemm_mr x #gemm_nr results, which are kept in registers. The operands are 
+		/// packed into blocks of #gemm_mc x #gemm_kc elements from the first matrix, which should fit into the L2 cache, and 
+		/// #gemm_kc x #gemm_nc elements from the second matrix, whose panels of #gemm_kc x #gemm_nr elements should fit into 
+		/// the L1 cache. Each block of the second matrix is used for #gemm_mb rows of results, which are distributed across 
+		/// threads in blocks of #gemm_mb x #gemm_nc.
+		enum gemm_blocking
+		{
+		#if HALF_ENABLE_F16C_INTRINSICS
+			gemm_mr = 16,
+			gemm_nr = 6,
+		#elif HALF_ENABLE_SSE2_INTRINSICS
+			gemm_mr = 8,
+			gemm_nr = 4,
+		#else
+			gemm_mr = 4,
+			gemm_nr = 4,
+		#endif
+			gemm_mb = 384,
+			gemm_mc = 96,
+			gemm_nc = 240,
+			gemm_kc = 256
+		};
+
+	#if HALF_ENABLE_F16C_INTRINSICS
+		/// Load and transpose block of half-precision values.
+		/// \param src address of 8 x 8 block of values
+		/// \param rs distance between rows of source block
+		/// \param dst address to store transposed block of single-precision values at
+		/// \param ds distance between rows of transposed block
+		inline void f16c_transpose8(const half *src, std::size_t rs, float *dst, std::size_t ds)
+		{
+			__m256 r0 = f16c_load(src), r1 = f16c_load(src+rs), r2 = f16c_load(src+2*rs), r3 = f16c_load(src+3*rs);
+			__m256 r4 = f16c_load(src+4*rs), r5 = f16c_load(src+5*rs), r6 = f16c_load(src+6*rs), r7 = f16c_load(src+7*rs);
+			__m256 t0 = _mm256_unpacklo_ps(r0, r1), t1 = _mm256_unpackhi_ps(r0, r1), t2 = _mm256_unpacklo_ps(r2, r3), t3 = _mm256_unpackhi_ps(r2, r3);
+			__m256 t4 = _mm256_unpacklo_ps(r4, r5), t5 = _mm256_unpackhi_ps(r4, r5), t6 = _mm256_unpacklo_ps(r6, r7), t7 = _mm256_unpackhi_ps(r6, r7);
+			r0 = _mm256_shuffle_ps(t0, t2, 0x44); r1 = _mm256_shuffle_ps(t0, t2, 0xEE); r2 = _mm256_shuffle_ps(t1, t3, 0x44); r3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+			r4 = _mm256_shuffle_ps(t4, t6, 0x44); r5 = _mm256_shuffle_ps(t4, t6, 0xEE); r6 = _mm256_shuffle_ps(t5, t7, 0x44); r7 = _mm256_shuffle_ps(t5, t7, 0xEE);
+			_mm256_storeu_ps(dst, _mm256_permute2f128_ps(r0, r4, 0x20));
+			_mm256_storeu_ps(dst+ds, _mm256_permute2f128_ps(r1, r5, 0x20));
+			_mm256_storeu_ps(dst+2*ds, _mm256_permute2f128_ps(r2, r6, 0x20));
+			_mm256_storeu_ps(dst+3*ds, _mm256_permute2f128_ps(r3, r7, 0x20));
+			_mm256_storeu_ps(dst+4*ds, _mm256_permute2f128_ps(r0, r4, 0x31));
+			_mm256_storeu_ps(dst+5*ds, _mm256_permute2f128_ps(r1, r5, 0x31));
+			_mm256_storeu_ps(dst+6*ds, _mm256_permute2f128_ps(r2, r6, 0x31));
+			_mm256_storeu_ps(dst+7*ds, _mm256_permute2f128_ps(r3, r7, 0x31));
+		}
+	#endif
+
+		/// Pack matrix panels for matrix multiplication.
+		/// This converts the elements to single-precision and stores them in panels of \a R rows, each storing the \a R 
+		/// elements of each column contiguously, padding the last panel with zeros. The source matrix is converted along its 
+		/// contiguous dimension if there is one.
+		/// \tparam R number of rows per panel
+		/// \param src source matrix
+		/// \param rs distance between rows of source matrix
+		/// \param cs distance between columns of source matrix
+		/// \param rows number of rows, at most #gemm_kc
+		/// \param cols number of columns, at most #gemm_kc
+		/// \param dst buffer to store panels at
+		template<std::size_t R> void gemm_pack(const half *src, std::size_t rs, std::size_t cs, std::size_t rows, std::size_t cols, float *dst)
+		{
+			float tmp[gemm_kc];
+			std::size_t full = rows / R * R;
+			if(full < rows)
+				std::fill(dst+full*cols, dst+(full+R)*cols, 0.0f);
+			if(rs == 1)
+				for(std::size_t j=0; j<cols; ++j)
+				{
+					half2float_array(src+j*cs, tmp, rows);
+					std::size_t i = 0;
+					for(; i<full; i+=R)
+						for(std::size_t r=0; r<R; ++r)
+							dst[i*cols+j*R+r] = tmp[i+r];
+					for(; i<rows; ++i)
+						dst[full*cols+j*R+i-full] = tmp[i];
+				}
+			else if(cs == 1)
+			{
+				std::size_t i = 0;
+			#if HALF_ENABLE_F16C_INTRINSICS
+				if(R%8 == 0 && sizeof(half) == sizeof(uint16))
+					for(; i+8<=rows; i+=8)
+					{
+						float *d = dst + (i-i%R)*cols + i%R;
+						std::size_t j = 0;
+						for(; j+8<=cols; j+=8)
+							f16c_transpose8(src+i*rs+j, rs, d+j*R, R);
+						for(; j<cols; ++j)
+							for(std::size_t r=0; r<8; ++r)
+								d[j*R+r] = static_cast<float>(src[(i+r)*rs+j]);
+					}
+			#endif
+				for(; i<rows; ++i)
+				{
+					half2float_array(src+i*rs, tmp, cols);
+					for(std::size_t j=0, off=(i-i%R)*cols+i%R; j<cols; ++j)
+						dst[off+j*R] = tmp[j];
+				}
+			}
+			else
+				for(std::size_t i=0; i<rows; ++i)
+					for(std::size_t j=0, off=(i-i%R)*cols+i%R; j<cols; ++j)
+						dst[off+j*R] = static_cast<float>(src[i*rs+j*cs]);
+		}
+
+	#if HALF_ENABLE_F16C_INTRINSICS
+		/// Single-precision multiply-add.
+		/// This uses a fused multiply-add if the FMA instruction set is enabled.
+		/// \param a first factors
+		/// \param b second factors
+		/// \param c summands
+		/// \return \a a * \a b + \a c
+		inline __m256 f16c_madd(__m256 a, __m256 b, __m256 c)
+		{
+		#ifdef __FMA__
+			return _mm256_fmadd_ps(a, b, c);
+		#else
+			return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+		#endif
+		}
+
+		/// Matrix multiplication micro-kernel.
+		/// This accumulates a 16 x 6 block of products in 12 vectors of 8 single-precision values.
+		/// \param kc number of products to accumulate
+		/// \param a panel of 16 rows of first matrix
+		/// \param b panel of 6 columns of second matrix
+		/// \param c block of results to update, stored column by column
+		/// \param ldc distance between columns of results
+		inline void gemm_kernel(std::size_t kc, const float *a, const float *b, float *c, std::size_t ldc)
+		{
+			__m256 c00 = _mm256_loadu_ps(c), c01 = _mm256_loadu_ps(c+8), c10 = _mm256_loadu_ps(c+ldc), c11 = _mm256_loadu_ps(c+ldc+8);
+			__m256 c20 = _mm256_loadu_ps(c+2*ldc), c21 = _mm256_loadu_ps(c+2*ldc+8), c30 = _mm256_loadu_ps(c+3*ldc), c31 = _mm256_loadu_ps(c+3*ldc+8);
+			__m256 c40 = _mm256_loadu_ps(c+4*ldc), c41 = _mm256_loadu_ps(c+4*ldc+8), c50 = _mm256_loadu_ps(c+5*ldc), c51 = _mm256_loadu_ps(c+5*ldc+8);
+			for(std::size_t l=0; l<kc; ++l, a+=16, b+=6)
+			{
+				__m256 a0 = _mm256_loadu_ps(a), a1 = _mm256_loadu_ps(a+8), bj = _mm256_broadcast_ss(b);
+				c00 = f16c_madd(a0, bj, c00);
+				c01 = f16c_madd(a1, bj, c01);
+				bj = _mm256_broadcast_ss(b+1);
+				c10 = f16c_madd(a0, bj, c10);
+				c11 = f16c_madd(a1, bj, c11);
+				bj = _mm256_broadcast_ss(b+2);
+				c20 = f16c_madd(a0, bj, c20);
+				c21 = f16c_madd(a1, bj, c21);
+				bj = _mm256_broadcast_ss(b+3);
+				c30 = f16c_madd(a0, bj, c30);
+				c31 = f16c_madd(a1, bj, c31);
+				bj = _mm256_broadcast_ss(b+4);
+				c40 = f16c_madd(a0, bj, c40);
+				c41 = f16c_madd(a1, bj, c41);
+				bj = _mm256_broadcast_ss(b+5);
+				c50 = f16c_madd(a0, bj, c50);
+				c51 = f16c_madd(a1, bj, c51);
+			}
+			_mm256_storeu_ps(c, c00); _mm256_storeu_ps(c+8, c01); _mm256_storeu_ps(c+ldc, c10); _mm256_storeu_ps(c+ldc+8, c11);
+			_mm256_storeu_ps(c+2*ldc, c20); _mm256_storeu_ps(c+2*ldc+8, c21); _mm256_storeu_ps(c+3*ldc, c30); _mm256_storeu_ps(c+3*ldc+8, c31);
+			_mm256_storeu_ps(c+4*ldc, c40); _mm256_storeu_ps(c+4*ldc+8, c41); _mm256_storeu_ps(c+5*ldc, c50); _mm256_storeu_ps(c+5*ldc+8, c51);
+		}
+
+		/// Store matrix multiplication results.
+		/// This computes 8 results at once.
+		/// \param t accumulated products
+		/// \param m number of results
+		/// \param alpha factor for products
+		/// \param beta factor for previous results
+		/// \param c array of results to update
+		/// \return number of results stored
+		inline std::size_t gemm_store(const float *t, std::size_t m, float alpha, float beta, float *c)
+		{
+			__m256 va = _mm256_set1_ps(alpha), vb = _mm256_set1_ps(beta);
+			std::size_t i = 0;
+			for(; i+8<=m; i+=8)
+				_mm256_storeu_ps(c+i, (beta==0.0f) ? _mm256_mul_ps(va, _mm256_loadu_ps(t+i)) : 
+					_mm256_add_ps(_mm256_mul_ps(va, _mm256_loadu_ps(t+i)), _mm256_mul_ps(vb, _mm256_loadu_ps(c+i))));
+			return i;
+		}
+
+		/// Store matrix multiplication results.
+		/// This computes 8 results at once and rounds them to half-precision with the half-precision rounding mode.
+		/// \param t accumulated products
+		/// \param m number of results
+		/// \param alpha factor for products
+		/// \param beta factor for previous results
+		/// \param c array of results to update
+		/// \return number of results stored
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline std::size_t gemm_store(const float *t, std::size_t m, float alpha, float beta, half *c)
+		{
+			__m256 va = _mm256_set1_ps(alpha), vb = _mm256_set1_ps(beta);
+			std::size_t i = 0;
+			if(sizeof(half) == sizeof(uint16))
+				for(; i+8<=m; i+=8)
+				{
+					__m256 r = _mm256_mul_ps(va, _mm256_loadu_ps(t+i));
+					if(beta != 0.0f)
+						r = _mm256_add_ps(r, _mm256_mul_ps(vb, f16c_load(c+i)));
+					f16c_store(c+i, r);
+				}
+			return i;
+		}
+	#elif HALF_ENABLE_SSE2_INTRINSICS
+		/// Matrix multiplication micro-kernel.
+		/// This accumulates a 8 x 4 block of products in 8 vectors of 4 single-precision values.
+		/// \param kc number of products to accumulate
+		/// \param a panel of 8 rows of first matrix
+		/// \param b panel of 4 columns of second matrix
+		/// \param c block of results to update, stored column by column
+		/// \param ldc distance between columns of results
+		inline void gemm_kernel(std::size_t kc, const float *a, const float *b, float *c, std::size_t ldc)
+		{
+			__m128 c00 = _mm_loadu_ps(c), c01 = _mm_loadu_ps(c+4), c10 = _mm_loadu_ps(c+ldc), c11 = _mm_loadu_ps(c+ldc+4);
+			__m128 c20 = _mm_loadu_ps(c+2*ldc), c21 = _mm_loadu_ps(c+2*ldc+4), c30 = _mm_loadu_ps(c+3*ldc), c31 = _mm_loadu_ps(c+3*ldc+4);
+			for(std::size_t l=0; l<kc; ++l, a+=8, b+=4)
+			{
+				__m128 a0 = _mm_loadu_ps(a), a1 = _mm_loadu_ps(a+4), bj = _mm_load1_ps(b);
+				c00 = _mm_add_ps(c00, _mm_mul_ps(a0, bj));
+				c01 = _mm_add_ps(c01, _mm_mul_ps(a1, bj));
+				bj = _mm_load1_ps(b+1);
+				c10 = _mm_add_ps(c10, _mm_mul_ps(a0, bj));
+				c11 = _mm_add_ps(c11, _mm_mul_ps(a1, bj));
+				bj = _mm_load1_ps(b+2);
+				c20 = _mm_add_ps(c20, _mm_mul_ps(a0, bj));
+				c21 = _mm_add_ps(c21, _mm_mul_ps(a1, bj));
+				bj = _mm_load1_ps(b+3);
+				c30 = _mm_add_ps(c30, _mm_mul_ps(a0, bj));
+				c31 = _mm_add_ps(c31, _mm_mul_ps(a1, bj));
+			}
+			_mm_storeu_ps(c, c00); _mm_storeu_ps(c+4, c01); _mm_storeu_ps(c+ldc, c10); _mm_storeu_ps(c+ldc+4, c11);
+			_mm_storeu_ps(c+2*ldc, c20); _mm_storeu_ps(c+2*ldc+4, c21); _mm_storeu_ps(c+3*ldc, c30); _mm_storeu_ps(c+3*ldc+4, c31);
+		}
+	#else
+		/// Matrix multiplication micro-kernel.
+		/// This accumulates a 4 x 4 block of products.
+		/// \param kc number of products to accumulate
+		/// \param a panel of 4 rows of first matrix
+		/// \param b panel of 4 columns of second matrix
+		/// \param c block of results to update, stored column by column
+		/// \param ldc distance between columns of results
+		inline void gemm_kernel(std::size_t kc, const float *a, const float *b, float *c, std::size_t ldc)
+		{
+			float t[16];
+			for(unsigned int j=0; j<4; ++j)
+				for(unsigned int i=0; i<4; ++i)
+					t[j*4+i] = c[j*ldc+i];
+			for(std::size_t l=0; l<kc; ++l, a+=4, b+=4)
+				for(unsigned int j=0; j<4; ++j)
+					for(unsigned int i=0; i<4; ++i)
+						t[j*4+i] += a[i] * b[j];
+			for(unsigned int j=0; j<4; ++j)
+				for(unsigned int i=0; i<4; ++i)
+					c[j*ldc+i] = t[j*4+i];
+		}
+	#endif
+
+	#if !HALF_ENABLE_F16C_INTRINSICS
+		/// Store matrix multiplication results.
+		/// \param t accumulated products
+		/// \param m number of results
+		/// \param alpha factor for products
+		/// \param beta factor for previous results
+		/// \param c array of results to update
+		/// \return number of results stored
+		template<typename T> std::size_t gemm_store(const float*, std::size_t, float, float, T*) { return 0; }
+	#endif
+
+		/// Matrix multiplication of single block.
+		/// This computes a block of at most #gemm_mb x #gemm_nc results over all products by packing blocks of the operands 
+		/// and accumulating them in single-precision with the micro-kernel, before scaling and storing them.
+		/// \tparam T type of results
+		/// \param m number of rows of results, at most #gemm_mb
+		/// \param n number of columns of results, at most #gemm_nc
+		/// \param k number of products per result
+		/// \param alpha factor for products
+		/// \param a first matrix
+		/// \param rsa distance between rows of first matrix
+		/// \param csa distance between columns of first matrix
+		/// \param b second matrix
+		/// \param rsb distance between rows of second matrix
+		/// \param csb distance between columns of second matrix
+		/// \param beta factor for previous results
+		/// \param c matrix of results
+		/// \param rsc distance between rows of results
+		/// \param csc distance between columns of results
+		/// \param buf buffer for packed operands and accumulated results of gemm_mc*gemm_kc + gemm_kc*gemm_nc + gemm_mb*gemm_nc 
+		/// elements
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding of half-precision results
+		template<typename T> void gemm_block(std::size_t m, std::size_t n, std::size_t k, float alpha, const half *a, std::size_t rsa, std::size_t csa, 
+			const half *b, std::size_t rsb, std::size_t csb, float beta, T *c, std::size_t rsc, std::size_t csc, float *buf)
+		{
+			float *pa = buf, *pb = pa + gemm_mc*gemm_kc, *t = pb + gemm_kc*gemm_nc;
+			std::size_t mp = (m+gemm_mr-1) / gemm_mr * gemm_mr;
+			std::fill(t, t+mp*((n+gemm_nr-1)/gemm_nr*gemm_nr), 0.0f);
+			for(std::size_t p=0; p<k; p+=gemm_kc)
+			{
+				std::size_t kc = std::min(k-p, static_cast<std::size_t>(gemm_kc));
+				gemm_pack<gemm_nr>(b+p*rsb, csb, rsb, n, kc, pb);
+				for(std::size_t ic=0; ic<m; ic+=gemm_mc)
+				{
+					std::size_t mc = std::min(m-ic, static_cast<std::size_t>(gemm_mc));
+					gemm_pack<gemm_mr>(a+ic*rsa+p*csa, rsa, csa, mc, kc, pa);
+					for(std::size_t j=0; j<n; j+=gemm_nr)
+						for(std::size_t i=0; i<mc; i+=gemm_mr)
+							gemm_kernel(kc, pa+i*kc, pb+j*kc, t+j*mp+ic+i, mp);
+				}
+			}
+			for(std::size_t j=0; j<n; ++j)
+			{
+				const float *tj = t + j*mp;
+				T *cj = c + j*csc;
+				std::size_t i = (rsc==1) ? gemm_store(tj, m, alpha, beta, cj) : 0;
+				for(; i<m; ++i)
+					cj[i*rsc] = T((beta==0.0f) ? (alpha*tj[i]) : (alpha*tj[i]+beta*static_cast<float>(cj[i*rsc])));
+			}
+		}
+
+		/// Matrix multiplication.
+		/// This distributes the blocks of results across threads if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled. This is not 
+		/// done for half-precision results if exceptions are enabled, since those would be raised in different threads.
+		/// \tparam T type of results
+		/// \param m number of rows of results
+		/// \param n number of columns of results
+		/// \param k number of products per result
+		/// \param alpha factor for products
+		/// \param a first matrix
+		/// \param rsa distance between rows of first matrix
+		/// \param csa distance between columns of first matrix
+		/// \param b second matrix
+		/// \param rsb distance between rows of second matrix
+		/// \param csb distance between columns of second matrix
+		/// \param beta factor for previous results
+		/// \param c matrix of results
+		/// \param rsc distance between rows of results
+		/// \param csc distance between columns of results
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding of half-precision results
+		template<typename T> void gemm(std::size_t m, std::size_t n, std::size_t k, float alpha, const half *a, std::size_t rsa, std::size_t csa, 
+			const half *b, std::size_t rsb, std::size_t csb, float beta, T *c, std::size_t rsc, std::size_t csc)
+		{
+			if(alpha == 0.0f)
+				k = 0;
+			long mb = static_cast<long>((m+gemm_mb-1)/gemm_mb), blocks = mb * static_cast<long>((n+gemm_nc-1)/gemm_nc);
+		#if HALF_ENABLE_OPENMP && HALF_ERRHANDLING
+			#pragma omp parallel if(blocks > 1 && sizeof(T) == sizeof(float))
+		#elif HALF_ENABLE_OPENMP
+			#pragma omp parallel if(blocks > 1)
+		#endif
+			{
+				std::vector<float> buf(gemm_mc*gemm_kc+gemm_kc*gemm_nc+gemm_mb*gemm_nc);
+			#if HALF_ENABLE_OPENMP
+				#pragma omp for schedule(dynamic)
+			#endif
+				for(long blk=0; blk<blocks; ++blk)
+				{
+					std::size_t i = static_cast<std::size_t>(blk%mb) * gemm_mb, j = static_cast<std::size_t>(blk/mb) * gemm_nc;
+					gemm_block(std::min(m-i, static_cast<std::size_t>(gemm_mb)), std::min(n-j, static_cast<std::size_t>(gemm_nc)), k, alpha, 
+						a+i*rsa, rsa, csa, b+j*csb, rsb, csb, beta, c+i*rsc+j*csc, rsc, csc, &buf[0]);
+				}
+			}
+		}
+
+		/// MurmurHash3 finalizer.
+		/// \param h 32-bit value to hash
+		/// \return hashed value
+		inline uint32 hash_mix(uint32 h)
+		{
+			h ^= h >> 16;
+			h = (h*0x85EBCA6B) & 0xFFFFFFFF;
+			h ^= h >> 13;
+			h = (h*0xC2B2AE35) & 0xFFFFFFFF;
+			return h ^ (h>>16);
+		}
+
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		/// Vectorized MurmurHash3 finalizer.
+		/// This computes hash_mix() for 4 values at once, with the 32-bit multiplications assembled from the even and odd 
+		/// lanes of 64-bit products.
+		/// \param h 32-bit values to hash
+		/// \return hashed values
+		inline __m128i sse2_hash_mix(__m128i h)
+		{
+			h = _mm_xor_si128(h, _mm_srli_epi32(h, 16));
+			for(int j=0; j<2; ++j)
+			{
+				__m128i c = _mm_set1_epi32(static_cast<int>(j ? 0xC2B2AE35 : 0x85EBCA6B));
+				h = _mm_unpacklo_epi32(_mm_shuffle_epi32(_mm_mul_epu32(h, c), 0x08), 
+					_mm_shuffle_epi32(_mm_mul_epu32(_mm_srli_epi64(h, 32), c), 0x08));
+				h = _mm_xor_si128(h, _mm_srli_epi32(h, j ? 16 : 13));
+			}
+			return h;
+		}
+	#endif
+
+	#if HALF_ENABLE_F16C_INTRINSICS
+		/// AVX vector of 8 single-precision values.
+		/// Half-precision values are converted with F16C.
+		struct f16c_float
+		{
+			typedef __m256 type;
+			enum { size = 8 };
+			static type load(const half *p) { return f16c_load(p); }
+			static type load(const float *p) { return _mm256_loadu_ps(p); }
+			static void store(float *p, type a) { _mm256_storeu_ps(p, a); }
+			static type set(float a) { return _mm256_set1_ps(a); }
+			static type zero() { return _mm256_setzero_ps(); }
+			static type add(type a, type b) { return _mm256_add_ps(a, b); }
+			static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+			static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+			static type div(type a, type b) { return _mm256_div_ps(a, b); }
+			static type sqrt(type a) { return _mm256_sqrt_ps(a); }
+			static type less(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+			static type band(type a, type b) { return _mm256_and_ps(a, b); }
+			static type select(type m, type a, type b) { return _mm256_blendv_ps(b, a, m); }
+			static int mask(type a) { return _mm256_movemask_ps(a); }
+			static type madd(type a, type b, type c) { return f16c_madd(a, b, c); }
+			static type abs(type a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+			static float sum(type a) { return f16c_hadd(a); }
+			static float first(type a) { return _mm256_cvtss_f32(a); }
+			static type last(type a) { a = _mm256_permute_ps(a, 0xFF); return _mm256_permute2f128_ps(a, a, 0x11); }
+			static type shift(type a) { a = _mm256_permute_ps(a, 0x93); return _mm256_blend_ps(a, _mm256_permute2f128_ps(a, a, 0x08), 0x11); }
+
+			/// Store rounded to half-precision.
+			/// This uses the half-precision rounding mode.
+			/// \param p address to store 8 half-precision values at
+			/// \param a values to store
+			/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+			static void store(half *p, type a) { f16c_store(p, a); }
+
+			/// Binary exponential.
+			/// This evaluates the polynomial of fast_exp2() for all elements at once.
+			/// \param a exponents
+			/// \return 2 raised to \a a, saturated to [2^-64, 2^64] for finite arguments
+			static type exp2(type a)
+			{
+				a = _mm256_min_ps(_mm256_set1_ps(64.0f), _mm256_max_ps(_mm256_set1_ps(-64.0f), a));
+				type i = _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT|_MM_FROUND_NO_EXC), f = _mm256_sub_ps(a, i);
+				__m256i e = _mm256_cvtps_epi32(i);
+			#if HALF_ENABLE_AVX2_INTRINSICS
+				e = _mm256_slli_epi32(_mm256_add_epi32(e, _mm256_set1_epi32(127)), 23);
+			#else
+				__m128i bias = _mm_set1_epi32(127);
+				e = _mm256_insertf128_si256(_mm256_castsi128_si256(_mm_slli_epi32(_mm_add_epi32(_mm256_castsi256_si128(e), bias), 23)), 
+					_mm_slli_epi32(_mm_add_epi32(_mm256_extractf128_si256(e, 1), bias), 23), 1);
+			#endif
+				type p = madd(f, set(0.00133335581f), set(0.00961812911f));
+				p = madd(p, f, set(0.0555041087f));
+				p = madd(p, f, set(0.240226507f));
+				p = madd(p, f, set(0.693147181f));
+				return _mm256_mul_ps(_mm256_castsi256_ps(e), madd(p, f, set(1.0f)));
+			}
+
+			/// Accurate binary exponential.
+			/// This evaluates a polynomial of degree 6 with a relative error below 2^-28 on the reduced argument, whose 
+			/// integer part is taken from the sum of both parts and whose fraction is computed as `(a-i)+b`, so that a 
+			/// product split into an exact high part and a small correction keeps its full precision.
+			/// \param a high parts of exponents, saturated to [-64, 64]
+			/// \param b low parts of exponents, small compared to the saturation bounds
+			/// \return 2 raised to \a a plus \a b
+			static type exp2(type a, type b)
+			{
+				a = _mm256_min_ps(_mm256_set1_ps(64.0f), _mm256_max_ps(_mm256_set1_ps(-64.0f), a));
+				type i = _mm256_round_ps(_mm256_add_ps(a, b), _MM_FROUND_TO_NEAREST_INT|_MM_FROUND_NO_EXC), f = _mm256_add_ps(_mm256_sub_ps(a, i), b);
+				__m256i e = _mm256_cvtps_epi32(i);
+			#if HALF_ENABLE_AVX2_INTRINSICS
+				e = _mm256_slli_epi32(_mm256_add_epi32(e, _mm256_set1_epi32(127)), 23);
+			#else
+				__m128i bias = _mm_set1_epi32(127);
+				e = _mm256_insertf128_si256(_mm256_castsi128_si256(_mm_slli_epi32(_mm_add_epi32(_mm256_castsi256_si128(e), bias), 23)), 
+					_mm_slli_epi32(_mm_add_epi32(_mm256_extractf128_si256(e, 1), bias), 23), 1);
+			#endif
+				type p = madd(f, set(0.000154614447f), set(0.00134004282f));
+				p = madd(p, f, set(0.00961805668f));
+				p = madd(p, f, set(0.0555032723f));
+				p = madd(p, f, set(0.240226509f));
+				p = madd(p, f, set(0.693147207f));
+				return _mm256_mul_ps(_mm256_castsi256_ps(e), madd(p, f, set(1.0f)));
+			}
+
+			/// Random integers.
+			/// This hashes consecutive counters like hash_mix(), with AVX2 or in two halves with SSE2 if available.
+			/// \param x first counter
+			/// \return lowest 13 bits of hashed counters
+			static type random(uint32 x)
+			{
+			#if HALF_ENABLE_AVX2_INTRINSICS
+				__m256i h = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(x)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+				h = _mm256_xor_si256(h, _mm256_srli_epi32(h, 16));
+				h = _mm256_mullo_epi32(h, _mm256_set1_epi32(static_cast<int>(0x85EBCA6B)));
+				h = _mm256_xor_si256(h, _mm256_srli_epi32(h, 13));
+				h = _mm256_mullo_epi32(h, _mm256_set1_epi32(static_cast<int>(0xC2B2AE35)));
+				h = _mm256_xor_si256(h, _mm256_srli_epi32(h, 16));
+				return _mm256_cvtepi32_ps(_mm256_and_si256(h, _mm256_set1_epi32(0x1FFF)));
+			#elif HALF_ENABLE_SSE2_INTRINSICS
+				__m128i h = _mm_set1_epi32(static_cast<int>(x)), mask = _mm_set1_epi32(0x1FFF);
+				__m128i lo = sse2_hash_mix(_mm_add_epi32(h, _mm_setr_epi32(0, 1, 2, 3))), hi = sse2_hash_mix(_mm_add_epi32(h, _mm_setr_epi32(4, 5, 6, 7)));
+				return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_cvtepi32_ps(_mm_and_si128(lo, mask))), _mm_cvtepi32_ps(_mm_and_si128(hi, mask)), 1);
+			#else
+				float r[8];
+				for(int j=0; j<8; ++j)
+					r[j] = static_cast<float>(hash_mix((x+j)&0xFFFFFFFF)&0x1FFF);
+				return _mm256_loadu_ps(r);
+			#endif
+			}
+
+			/// Inclusive prefix sums.
+			/// This adds the values shifted by 1 and 2 elements within each 128-bit lane and then the last sum of the lower 
+			/// lane to the upper lane.
+			/// \param a values to sum
+			/// \return prefix sums of values
+			static type scan(type a)
+			{
+				a = _mm256_add_ps(a, _mm256_blend_ps(_mm256_permute_ps(a, 0x90), _mm256_setzero_ps(), 0x11));
+				a = _mm256_add_ps(a, _mm256_blend_ps(_mm256_permute_ps(a, 0x40), _mm256_setzero_ps(), 0x33));
+				return _mm256_add_ps(a, _mm256_permute2f128_ps(_mm256_permute_ps(a, 0xFF), a, 0x08));
+			}
+		};
+
+		/// Single-precision vector type for array operations.
+		typedef f16c_float float_vector;
+	#elif HALF_ENABLE_SSE2_INTRINSICS
+		/// SSE vector of 4 single-precision values.
+		/// Half-precision values are converted with SSE2 integer operations.
+		struct sse2_float
+		{
+			typedef __m128 type;
+			enum { size = 4 };
+			static type load(const half *p) { return sse2_half2float(sse2::load(p)); }
+			static type load(const float *p) { return _mm_loadu_ps(p); }
+			static void store(float *p, type a) { _mm_storeu_ps(p, a); }
+			static type set(float a) { return _mm_set1_ps(a); }
+			static type zero() { return _mm_setzero_ps(); }
+			static type add(type a, type b) { return _mm_add_ps(a, b); }
+			static type sub(type a, type b) { return _mm_sub_ps(a, b); }
+			static type mul(type a, type b) { return _mm_mul_ps(a, b); }
+			static type div(type a, type b) { return _mm_div_ps(a, b); }
+			static type sqrt(type a) { return _mm_sqrt_ps(a); }
+			static type less(type a, type b) { return _mm_cmplt_ps(a, b); }
+			static type band(type a, type b) { return _mm_and_ps(a, b); }
+			static type select(type m, type a, type b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+			static int mask(type a) { return _mm_movemask_ps(a); }
+			static type madd(type a, type b, type c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+			static type abs(type a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+			static float sum(type a) { a = _mm_add_ps(a, _mm_movehl_ps(a, a)); return _mm_cvtss_f32(_mm_add_ss(a, _mm_shuffle_ps(a, a, 1))); }
+			static float first(type a) { return _mm_cvtss_f32(a); }
+			static type last(type a) { return _mm_shuffle_ps(a, a, 0xFF); }
+			static type shift(type a) { return _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(a), 4)); }
+			static type scan(type a) { a = _mm_add_ps(a, shift(a)); return _mm_add_ps(a, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(a), 8))); }
+
+			/// Binary exponential.
+			/// This evaluates the polynomial of fast_exp2() for all elements at once.
+			/// \param a exponents
+			/// \return 2 raised to \a a, saturated to [2^-64, 2^64] for finite arguments
+			static type exp2(type a)
+			{
+				a = _mm_min_ps(_mm_set1_ps(64.0f), _mm_max_ps(_mm_set1_ps(-64.0f), a));
+				__m128i e = _mm_cvtps_epi32(a);
+				type f = _mm_sub_ps(a, _mm_cvtepi32_ps(e));
+				type p = madd(f, set(0.00133335581f), set(0.00961812911f));
+				p = madd(p, f, set(0.0555041087f));
+				p = madd(p, f, set(0.240226507f));
+				p = madd(p, f, set(0.693147181f));
+				return _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(e, _mm_set1_epi32(127)), 23)), madd(p, f, set(1.0f)));
+			}
+
+			/// Accurate binary exponential.
+			/// This evaluates a polynomial of degree 6 with a relative error below 2^-28 on the reduced argument, whose 
+			/// integer part is taken from the sum of both parts and whose fraction is computed as `(a-i)+b`, so that a 
+			/// product split into an exact high part and a small correction keeps its full precision.
+			/// \param a high parts of exponents, saturated to [-64, 64]
+			/// \param b low parts of exponents, small compared to the saturation bounds
+			/// \return 2 raised to \a a plus \a b
+			static type exp2(type a, type b)
+			{
+				a = _mm_min_ps(_mm_set1_ps(64.0f), _mm_max_ps(_mm_set1_ps(-64.0f), a));
+				__m128i e = _mm_cvtps_epi32(_mm_add_ps(a, b));
+				type f = _mm_add_ps(_mm_sub_ps(a, _mm_cvtepi32_ps(e)), b);
+				type p = madd(f, set(0.000154614447f), set(0.00134004282f));
+				p = madd(p, f, set(0.00961805668f));
+				p = madd(p, f, set(0.0555032723f));
+				p = madd(p, f, set(0.240226509f));
+				p = madd(p, f, set(0.693147207f));
+				return _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(e, _mm_set1_epi32(127)), 23)), madd(p, f, set(1.0f)));
+			}
+
+			/// Random integers.
+			/// This hashes consecutive counters like hash_mix().
+			/// \param x first counter
+			/// \return lowest 13 bits of hashed counters
+			static type random(uint32 x)
+			{
+				__m128i h = sse2_hash_mix(_mm_add_epi32(_mm_set1_epi32(static_cast<int>(x)), _mm_setr_epi32(0, 1, 2, 3)));
+				return _mm_cvtepi32_ps(_mm_and_si128(h, _mm_set1_epi32(0x1FFF)));
+			}
+
+			/// Store rounded to half-precision.
+			/// SSE2 has no conversion to half-precision, so this converts the values one by one.
+			/// \param p address to store 4 half-precision values at
+			/// \param a values to store
+			/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+			static void store(half *p, type a)
+			{
+				float f[4];
+				_mm_storeu_ps(f, a);
+				for(int j=0; j<4; ++j)
+					p[j] = half(f[j]);
+			}
+		};
+
+		/// Single-precision vector type for array operations.
+		typedef sse2_float float_vector;
+	#endif
+
+		/// Matrix-vector product with contiguous rows.
+		/// This computes 4 dot products of rows with the vector at once, each with 2 independent vectors of partial sums, 
+		/// vectorized with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available.
+		/// \param m number of rows
+		/// \param n number of columns
+		/// \param alpha factor for products
+		/// \param a matrix
+		/// \param lda distance between rows of matrix
+		/// \param x vector of \a n elements
+		/// \param beta factor for previous results
+		/// \param y vector of \a m results to update
+		inline void gemv_rows(std::size_t m, std::size_t n, float alpha, const half *a, std::size_t lda, const float *x, float beta, float *y)
+		{
+			std::size_t i = 0;
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			typedef float_vector V;
+			if(sizeof(half) == sizeof(uint16))
+				for(; i+4<=m; i+=4)
+				{
+					const half *a0 = a + i*lda, *a1 = a0 + lda, *a2 = a1 + lda, *a3 = a2 + lda;
+					V::type s0 = V::zero(), s1 = V::zero(), s2 = V::zero(), s3 = V::zero(), t0 = V::zero(), t1 = V::zero(), t2 = V::zero(), t3 = V::zero();
+					std::size_t j = 0;
+					for(; j+2*V::size<=n; j+=2*V::size)
+					{
+						V::type x0 = V::load(x+j), x1 = V::load(x+j+V::size);
+						s0 = V::madd(V::load(a0+j), x0, s0);
+						t0 = V::madd(V::load(a0+j+V::size), x1, t0);
+						s1 = V::madd(V::load(a1+j), x0, s1);
+						t1 = V::madd(V::load(a1+j+V::size), x1, t1);
+						s2 = V::madd(V::load(a2+j), x0, s2);
+						t2 = V::madd(V::load(a2+j+V::size), x1, t2);
+						s3 = V::madd(V::load(a3+j), x0, s3);
+						t3 = V::madd(V::load(a3+j+V::size), x1, t3);
+					}
+					float r[4] = { V::sum(V::add(s0, t0)), V::sum(V::add(s1, t1)), V::sum(V::add(s2, t2)), V::sum(V::add(s3, t3)) };
+					for(; j<n; ++j)
+					{
+						r[0] += static_cast<float>(a0[j]) * x[j];
+						r[1] += static_cast<float>(a1[j]) * x[j];
+						r[2] += static_cast<float>(a2[j]) * x[j];
+						r[3] += static_cast<float>(a3[j]) * x[j];
+					}
+					for(unsigned int k=0; k<4; ++k)
+						y[i+k] = (beta==0.0f) ? (alpha*r[k]) : (alpha*r[k]+beta*y[i+k]);
+				}
+		#endif
+			for(; i<m; ++i)
+			{
+				float s[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+				for(std::size_t j=0; j<n; ++j)
+					s[j&3] += static_cast<float>(a[i*lda+j]) * x[j];
+				float r = (s[0]+s[1]) + (s[2]+s[3]);
+				y[i] = (beta==0.0f) ? (alpha*r) : (alpha*r+beta*y[i]);
+			}
+		}
+
+		/// Matrix-vector product with contiguous columns.
+		/// This adds 4 scaled columns to the results at once, vectorized with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or 
+		/// [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available.
+		/// \param m number of rows
+		/// \param n number of columns
+		/// \param alpha factor for products
+		/// \param a matrix
+		/// \param lda distance between columns of matrix
+		/// \param x vector of \a n elements
+		/// \param beta factor for previous results
+		/// \param y vector of \a m results to update
+		inline void gemv_cols(std::size_t m, std::size_t n, float alpha, const half *a, std::size_t lda, const float *x, float beta, float *y)
+		{
+			for(std::size_t i=0; i<m; ++i)
+				y[i] = (beta==0.0f) ? 0.0f : (beta*y[i]);
+			std::size_t j = 0;
+			for(; j+4<=n; j+=4)
+			{
+				const half *a0 = a + j*lda, *a1 = a0 + lda, *a2 = a1 + lda, *a3 = a2 + lda;
+				float x0 = alpha * x[j], x1 = alpha * x[j+1], x2 = alpha * x[j+2], x3 = alpha * x[j+3];
+				std::size_t i = 0;
+			#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+				typedef float_vector V;
+				if(sizeof(half) == sizeof(uint16))
+				{
+					V::type v0 = V::set(x0), v1 = V::set(x1), v2 = V::set(x2), v3 = V::set(x3);
+					for(; i+V::size<=m; i+=V::size)
+						V::store(y+i, V::madd(V::load(a3+i), v3, V::madd(V::load(a2+i), v2, 
+							V::madd(V::load(a1+i), v1, V::madd(V::load(a0+i), v0, V::load(y+i))))));
+				}
+			#endif
+				for(; i<m; ++i)
+					y[i] += static_cast<float>(a0[i])*x0 + static_cast<float>(a1[i])*x1 + static_cast<float>(a2[i])*x2 + static_cast<float>(a3[i])*x3;
+			}
+			for(; j<n; ++j)
+			{
+				float xj = alpha * x[j];
+				for(std::size_t i=0; i<m; ++i)
+					y[i] += static_cast<float>(a[j*lda+i]) * xj;
+			}
+		}
+
+		/// Matrix-vector product.
+		/// This distributes blocks of rows across threads if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and the matrix 
+		/// is large enough. Each block of a matrix with contiguous columns is small enough for its results to stay in the L1 
+		/// cache.
+		/// \param rows `true` for contiguous rows, `false` for contiguous columns
+		/// \param m number of rows
+		/// \param n number of columns
+		/// \param alpha factor for products
+		/// \param a matrix
+		/// \param lda distance between rows or columns of matrix
+		/// \param x vector of \a n elements
+		/// \param beta factor for previous results
+		/// \param y vector of \a m results to update
+		inline void gemv(bool rows, std::size_t m, std::size_t n, float alpha, const half *a, std::size_t lda, const float *x, float beta, float *y)
+		{
+			std::size_t block = rows ? 64 : 1024;
+			long blocks = static_cast<long>((m+block-1)/block);
+		#if HALF_ENABLE_OPENMP
+			#pragma omp parallel for schedule(static) if(blocks > 1 && m*n >= 65536)
+		#endif
+			for(long blk=0; blk<blocks; ++blk)
+			{
+				std::size_t i = static_cast<std::size_t>(blk) * block, mb = std::min(m-i, block);
+				if(rows)
+					gemv_rows(mb, n, alpha, a+i*lda, lda, x, beta, y+i);
+				else
+					gemv_cols(mb, n, alpha, a+i, lda, x, beta, y+i);
+			}
+		}
+
+		/// Sum of exponentials.
+		/// This is vectorized with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if 
+		/// available, computing the exponentials like fast_exp2(). Exponentials of 1, which are those of the maximum when it 
+		/// is subtracted, are summed separately, so the other ones do not lose precision by being added to them.
+		/// \param x array of values
+		/// \param n number of elements
+		/// \param shift value to subtract before exponentiation
+		/// \param ones variable to store sum of exponentials that are not smaller than 1 at
+		/// \return sum of exponentials of `x[i]-shift` smaller than 1 in single-precision
+		inline float exp_sum(const half *x, std::size_t n, float shift, float &ones)
+		{
+			float sum = 0.0f;
+			std::size_t i = 0;
+			ones = 0.0f;
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			typedef float_vector V;
+			if(sizeof(half) == sizeof(uint16))
+			{
+				V::type s0 = V::zero(), s1 = V::zero(), o = V::zero(), c = V::set(-shift), l = V::set(1.44269504f), one = V::set(1.0f);
+				for(; i+2*V::size<=n; i+=2*V::size)
+				{
+					V::type e0 = V::exp2(V::mul(V::add(V::load(x+i), c), l)), e1 = V::exp2(V::mul(V::add(V::load(x+i+V::size), c), l));
+					V::type t0 = V::band(V::less(e0, one), e0), t1 = V::band(V::less(e1, one), e1);
+					s0 = V::add(s0, t0);
+					s1 = V::add(s1, t1);
+					o = V::add(o, V::add(V::sub(e0, t0), V::sub(e1, t1)));
+				}
+				sum = V::sum(V::add(s0, s1));
+				ones = V::sum(o);
+			}
+		#endif
+			for(; i<n; ++i)
+			{
+				float e = fast_exp2((static_cast<float>(x[i])-shift)*1.44269504f);
+				if(e < 1.0f)
+					sum += e;
+				else
+					ones += e;
+			}
+			return sum;
+		}
+
+		/// Maximum and sum of exponentials in one pass.
+		/// This computes the maximum with reduce_max() and the sum of exponentials with exp_sum() for each tile of 256 values, 
+		/// which is still in the L1 cache for the second of these, and rescales the running sums whenever the maximum 
+		/// increases, like attention() does for its scores. The sums are thus rounded once more for every tile that raises 
+		/// the maximum, but not at all if the maximum is in the first tile. Exponentials not smaller than 1 are kept separate 
+		/// with respect to the final maximum, like by exp_sum().
+		/// \param x array of values
+		/// \param n number of elements, not 0
+		/// \param max variable to store maximum at
+		/// \param ones variable to store sum of exponentials that are not smaller than 1 at
+		/// \return sum of exponentials of `x[i]-max` smaller than 1 in single-precision
+		/// \exception FE_INVALID if any value is signaling NaN
+		inline float online_exp_sum(const half *x, std::size_t n, float &max, float &ones)
+		{
+			std::size_t tile = std::min(n, static_cast<std::size_t>(256));
+			max = static_cast<float>(reduce_max(x, tile));
+			float sum = exp_sum(x, tile, max, ones);
+			for(std::size_t i=tile; i<n; i+=tile)
+			{
+				std::size_t nt = std::min(n-i, tile);
+				float m = static_cast<float>(reduce_max(x+i, nt)), o;
+				if(m > max)
+				{
+					sum = (max > -std::numeric_limits<float>::infinity()) ? ((sum+ones)*fast_exp2((max-m)*1.44269504f)) : 0.0f;
+					ones = 0.0f;
+					max = m;
+				}
+				sum += exp_sum(x+i, nt, max, o);
+				ones += o;
+			}
+			return sum;
+		}
+
+		/// Scaled exponentials.
+		/// This computes the exponentials like exp_sum() and only rounds the scaled results to half-precision.
+		/// \param x array of values
+		/// \param y array to store results at
+		/// \param n number of elements
+		/// \param shift value to subtract before exponentiation
+		/// \param scale factor for exponentials
+		/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+		inline void exp_scale(const half *x, half *y, std::size_t n, float shift, float scale)
+		{
+			std::size_t i = 0;
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			typedef float_vector V;
+			if(sizeof(half) == sizeof(uint16))
+			{
+				V::type c = V::set(-shift), l = V::set(1.44269504f), f = V::set(scale);
+				for(; i+V::size<=n; i+=V::size)
+					V::store(y+i, V::mul(V::exp2(V::mul(V::add(V::load(x+i), c), l)), f));
+			}
+		#endif
+			for(; i<n; ++i)
+				y[i] = half(scale*fast_exp2((static_cast<float>(x[i])-shift)*1.44269504f));
+		}
+
+		/// Shifted values.
+		/// \param x array of values
+		/// \param y array to store results at
+		/// \param n number of elements
+		/// \param a first value to subtract
+		/// \param b second value to subtract
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline void subtract(const half *x, half *y, std::size_t n, float a, float b)
+		{
+			std::size_t i = 0;
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			typedef float_vector V;
+			if(sizeof(half) == sizeof(uint16))
+			{
+				V::type va = V::set(-a), vb = V::set(-b);
+				for(; i+V::size<=n; i+=V::size)
+					V::store(y+i, V::add(V::add(V::load(x+i), va), vb));
+			}
+		#endif
+			for(; i<n; ++i)
+				y[i] = half((static_cast<float>(x[i])-a)-b);
+		}
+
+		/// Sum of squared deviations.
+		/// This is vectorized with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if 
+		/// available.
+		/// \param x array of values
+		/// \param n number of elements
+		/// \param mean value to subtract before squaring
+		/// \return sum of squares of `x[i]-mean` in single-precision
+		inline float centered_squares(const half *x, std::size_t n, float mean)
+		{
+			float sum = 0.0f;
+			std::size_t i = 0;
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			typedef float_vector V;
+			if(sizeof(half) == sizeof(uint16))
+			{
+				V::type s0 = V::zero(), s1 = V::zero(), c = V::set(mean);
+				for(; i+2*V::size<=n; i+=2*V::size)
+				{
+					V::type d0 = V::sub(V::load(x+i), c), d1 = V::sub(V::load(x+i+V::size), c);
+					s0 = V::madd(d0, d0, s0);
+					s1 = V::madd(d1, d1, s1);
+				}
+				sum = V::sum(V::add(s0, s1));
+			}
+		#endif
+			for(; i<n; ++i)
+			{
+				float d = static_cast<float>(x[i]) - mean;
+				sum += d * d;
+			}
+			return sum;
+		}
+
+		/// Normalize values.
+		/// This computes `y[i] = (x[i]-shift) * scale * gamma[i] + beta[i]` in single-precision, vectorized with 
+		/// [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available.
+		/// \tparam G `true` to multiply by \a gamma, `false` to ignore it
+		/// \tparam B `true` to add \a beta, `false` to ignore it
+		/// \param x array of values
+		/// \param gamma array of factors
+		/// \param beta array of offsets
+		/// \param y array to store results at
+		/// \param n number of elements
+		/// \param shift value to subtract
+		/// \param scale factor for shifted values
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		template<bool G,bool B> void normalize_row(const half *x, const half *gamma, const half *beta, half *y, std::size_t n, float shift, float scale)
+		{
+			std::size_t i = 0;
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			typedef float_vector V;
+			if(sizeof(half) == sizeof(uint16))
+			{
+				V::type c = V::set(shift), f = V::set(scale);
+				for(; i+V::size<=n; i+=V::size)
+				{
+					V::type v = V::mul(V::sub(V::load(x+i), c), f);
+					if(G)
+						v = V::mul(v, V::load(gamma+i));
+					V::store(y+i, B ? V::add(v, V::load(beta+i)) : v);
+				}
+			}
+		#endif
+			for(; i<n; ++i)
+			{
+				float v = (static_cast<float>(x[i])-shift) * scale;
+				if(G)
+					v *= static_cast<float>(gamma[i]);
+				y[i] = half(B ? (v+static_cast<float>(beta[i])) : v);
+			}
+		}
+
+		/// Normalize values with optional factors and offsets.
+		/// \param x array of values
+		/// \param gamma array of factors or null pointer
+		/// \param beta array of offsets or null pointer
+		/// \param y array to store results at
+		/// \param n number of elements
+		/// \param shift value to subtract
+		/// \param scale factor for shifted values
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline void normalize_row(const half *x, const half *gamma, const half *beta, half *y, std::size_t n, float shift, float scale)
+		{
+			if(gamma && beta)
+				normalize_row<true,true>(x, gamma, beta, y, n, shift, scale);
+			else if(gamma)
+				normalize_row<true,false>(x, gamma, beta, y, n, shift, scale);
+			else if(beta)
+				normalize_row<false,true>(x, gamma, beta, y, n, shift, scale);
+			else
+				normalize_row<false,false>(x, gamma, beta, y, n, shift, scale);
+		}
+
+		/// Blocking parameters for convolutions.
+		/// Each block of results covers up to #conv_tile consecutive outputs of one row for up to #conv_channels output 
+		/// channels, for which the input rows under the kernel are converted to single-precision and deinterleaved by stride, 
+		/// so that every kernel tap reads contiguous values.
+		enum conv_blocking
+		{
+			conv_tile = 128,
+			conv_channels = 16
+		};
+
+		/// Multi-channel 2D convolution.
+		/// This computes every output row of every output channel in blocks of #conv_tile values, which are kept in 
+		/// registers while accumulating the products of all kernel taps in single-precision, vectorized with 
+		/// [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available. Blocks are 
+		/// distributed across threads if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and exceptions are disabled.
+		/// \param ci number of input channels
+		/// \param co number of output channels
+		/// \param h number of input rows
+		/// \param w number of input columns
+		/// \param kh number of kernel rows
+		/// \param kw number of kernel columns
+		/// \param sy vertical stride
+		/// \param sx horizontal stride
+		/// \param dy vertical dilation
+		/// \param dx horizontal dilation
+		/// \param py number of zero rows padded at top
+		/// \param px number of zero columns padded at left
+		/// \param ho number of output rows
+		/// \param wo number of output columns
+		/// \param x input channels of \a h x \a w values
+		/// \param f kernels of \a ci x \a kh x \a kw values for each output channel
+		/// \param b array of \a co offsets or null pointer
+		/// \param y output channels of \a ho x \a wo values
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline void convolve(std::size_t ci, std::size_t co, std::size_t h, std::size_t w, std::size_t kh, std::size_t kw, std::size_t sy, 
+			std::size_t sx, std::size_t dy, std::size_t dx, std::size_t py, std::size_t px, std::size_t ho, std::size_t wo, 
+			const half *x, const half *f, const half *b, half *y)
+		{
+			if(!co || !ho || !wo)
+				return;
+			std::size_t taps = ci * kh * kw, plen = conv_tile + ((kw-1)*dx)/sx + 1, rs = sx * plen, cb = (co+conv_channels-1) / conv_channels;
+			std::size_t tiles = (wo+conv_tile-1) / conv_tile;
+			long blocks = static_cast<long>(ho*cb*tiles);
+			std::vector<float> weights(co*taps+1);
+			std::vector<std::size_t> offsets(taps+1);
+			half2float_array(f, &weights[0], co*taps);
+			for(std::size_t c=0,j=0; c<ci*kh; ++c)
+				for(std::size_t k=0; k<kw; ++k,++j)
+					offsets[j] = c*rs + ((k*dx)%sx)*plen + (k*dx)/sx;
+		#if HALF_ENABLE_OPENMP && !HALF_ERRHANDLING
+			#pragma omp parallel if(blocks > 1 && ho*wo*co*taps >= 65536)
+		#endif
+			{
+				std::vector<float> buf(ci*kh*rs+rs);
+				float *tmp = &buf[ci*kh*rs];
+			#if HALF_ENABLE_OPENMP && !HALF_ERRHANDLING
+				#pragma omp for schedule(static)
+			#endif
+				for(long blk=0; blk<blocks; ++blk)
+				{
+					std::size_t oy = static_cast<std::size_t>(blk) / (cb*tiles), c0 = (static_cast<std::size_t>(blk)/tiles%cb) * conv_channels;
+					std::size_t ox = (static_cast<std::size_t>(blk)%tiles) * conv_tile, nt = std::min(wo-ox, static_cast<std::size_t>(conv_tile));
+					std::size_t len = (nt-1)*sx + (kw-1)*dx + 1;
+					long ix = static_cast<long>(ox*sx) - static_cast<long>(px);
+					std::size_t lo = static_cast<std::size_t>(std::max(-ix, 0L));
+					std::size_t hi = static_cast<std::size_t>(std::max(std::min(static_cast<long>(w)-ix, static_cast<long>(len)), static_cast<long>(lo)));
+					for(std::size_t c=0; c<ci; ++c)
+					{
+						for(std::size_t r=0; r<kh; ++r)
+						{
+							float *row = &buf[(c*kh+r)*rs], *in = (sx==1) ? row : tmp;
+							long iy = static_cast<long>(oy*sy+r*dy) - static_cast<long>(py);
+							if(iy < 0 || iy >= static_cast<long>(h) || lo == hi)
+							{
+								std::fill(row, row+rs, 0.0f);
+								continue;
+							}
+							std::fill(in, in+lo, 0.0f);
+							half2float_array(x+(c*h+static_cast<std::size_t>(iy))*w+static_cast<std::size_t>(ix+static_cast<long>(lo)), in+lo, hi-lo);
+							std::fill(in+hi, in+len, 0.0f);
+							if(sx > 1)
+								for(std::size_t t=0; t<len; ++t)
+									row[(t%sx)*plen+t/sx] = in[t];
+						}
+					}
+					for(std::size_t o=c0; o<std::min(c0+conv_channels, co); ++o)
+					{
+						const float *k = &weights[o*taps];
+						float bias = b ? static_cast<float>(b[o]) : 0.0f;
+						half *out = y + (o*ho+oy)*wo + ox;
+						std::size_t i = 0;
+					#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+						typedef float_vector V;
+						if(sizeof(half) == sizeof(uint16))
+						{
+							for(; i+2*V::size<=nt; i+=2*V::size)
+							{
+								V::type a0 = V::set(bias), a1 = a0;
+								for(std::size_t j=0; j<taps; ++j)
+								{
+									const float *p = &buf[offsets[j]+i];
+									V::type v = V::set(k[j]);
+									a0 = V::madd(v, V::load(p), a0);
+									a1 = V::madd(v, V::load(p+V::size), a1);
+								}
+								V::store(out+i, a0);
+								V::store(out+i+V::size, a1);
+							}
+							for(; i+V::size<=nt; i+=V::size)
+							{
+								V::type a = V::set(bias);
+								for(std::size_t j=0; j<taps; ++j)
+									a = V::madd(V::set(k[j]), V::load(&buf[offsets[j]+i]), a);
+								V::store(out+i, a);
+							}
+						}
+					#endif
+						for(; i<nt; ++i)
+						{
+							float a = bias;
+							for(std::size_t j=0; j<taps; ++j)
+								a += k[j] * buf[offsets[j]+i];
+							out[i] = half(a);
+						}
+					}
+				}
+			}
+		}
+
+		/// Scaled conversion to half-precision.
+		/// This is vectorized with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if 
+		/// available.
+		/// \param x array of single-precision values
+		/// \param y array to store results at
+		/// \param n number of elements
+		/// \param scale factor for values
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline void scale_to_half(const float *x, half *y, std::size_t n, float scale)
+		{
+			std::size_t i = 0;
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			typedef float_vector V;
+			if(sizeof(half) == sizeof(uint16))
+			{
+				V::type f = V::set(scale);
+				for(; i+V::size<=n; i+=V::size)
+					V::store(y+i, V::mul(V::load(x+i), f));
+			}
+		#endif
+			for(; i<n; ++i)
+				y[i] = half(x[i]*scale);
+		}
+
+		/// Blocking parameters for attention.
+		/// Each block of #attention_rows queries is kept in single-precision while streaming over the keys and values in 
+		/// tiles of #attention_cols, whose scores fit into the L1 cache together with the converted tiles.
+		enum attention_blocking
+		{
+			attention_rows = 32,
+			attention_cols = 64
+		};
+
+		/// Scaled dot-product attention.
+		/// This computes each block of queries against all tiles of keys, updating the running maximum, sum and weighted 
+		/// values of each query with the scores of each tile in single-precision, vectorized with 
+		/// [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available. Blocks of 
+		/// queries are distributed across threads if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and exceptions are disabled.
+		/// \param heads number of heads
+		/// \param m number of queries per head
+		/// \param n number of keys and values per head
+		/// \param d number of elements per query, key, value and result
+		/// \param q queries
+		/// \param k keys
+		/// \param v values
+		/// \param o array to store results at
+		/// \param scale factor for scores
+		/// \param causal `true` to only attend to keys up to the position of each query, `false` to attend to all keys
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline void attention(std::size_t heads, std::size_t m, std::size_t n, std::size_t d, const half *q, const half *k, const half *v, 
+			half *o, float scale, bool causal)
+		{
+			if(!m || !d)
+				return;
+			std::size_t rb = (m+attention_rows-1) / attention_rows;
+			long blocks = static_cast<long>(heads*rb);
+			scale *= 1.44269504f;
+		#if HALF_ENABLE_OPENMP && !HALF_ERRHANDLING
+			#pragma omp parallel if(blocks > 1 && heads*m*n*d >= 65536)
+		#endif
+			{
+				std::vector<float> buf(2*attention_rows*d+2*attention_cols*d+attention_rows*attention_cols+2*attention_rows+d);
+				float *qf = &buf[0], *acc = qf + attention_rows*d, *kt = acc + attention_rows*d, *vf = kt + attention_cols*d;
+				float *sc = vf + attention_cols*d, *mx = sc + attention_rows*attention_cols, *sum = mx + attention_rows, *tmp = sum + attention_rows;
+			#if HALF_ENABLE_OPENMP && !HALF_ERRHANDLING
+				#pragma omp for schedule(dynamic)
+			#endif
+				for(long blk=0; blk<blocks; ++blk)
+				{
+					std::size_t h = static_cast<std::size_t>(blk) / rb, r0 = (static_cast<std::size_t>(blk)%rb) * attention_rows;
+					std::size_t nr = std::min(m-r0, static_cast<std::size_t>(attention_rows)), end = n;
+					long diag = static_cast<long>(r0+n) - static_cast<long>(m);
+					if(causal)
+						end = static_cast<std::size_t>(std::min(std::max(diag+static_cast<long>(nr), 0L), static_cast<long>(n)));
+					const half *kh = k + h*n*d, *vh = v + h*n*d;
+					half2float_array(q+(h*m+r0)*d, qf, nr*d);
+					std::fill(acc, acc+nr*d, 0.0f);
+					std::fill(mx, mx+nr, -std::numeric_limits<float>::infinity());
+					std::fill(sum, sum+nr, 0.0f);
+					for(std::size_t c0=0; c0<end; c0+=attention_cols)
+					{
+						std::size_t nc = std::min(end-c0, static_cast<std::size_t>(attention_cols));
+						for(std::size_t c=0; c<attention_cols; ++c)
+						{
+							if(c < nc)
+								half2float_array(kh+(c0+c)*d, tmp, d);
+							for(std::size_t t=0; t<d; ++t)
+								kt[t*attention_cols+c] = (c<nc) ? tmp[t] : 0.0f;
+						}
+						half2float_array(vh+c0*d, vf, nc*d);
+						for(std::size_t r=0; r<nr; ++r)
+						{
+							std::size_t cols = nc;
+							if(causal)
+								cols = static_cast<std::size_t>(std::min(std::max(diag+static_cast<long>(r+1)-static_cast<long>(c0), 0L), static_cast<long>(nc)));
+							if(!cols)
+								continue;
+							float *s = sc + r*attention_cols, *a = acc + r*d, max = mx[r], total = 0.0f;
+							const float *qr = qf + r*d;
+							std::size_t c = 0, t = 0;
+						#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+							typedef float_vector V;
+							if(sizeof(half) == sizeof(uint16))
+							{
+								for(; c<cols; c+=V::size)
+								{
+									V::type x = V::zero();
+									for(std::size_t j=0; j<d; ++j)
+										x = V::madd(V::set(qr[j]), V::load(kt+j*attention_cols+c), x);
+									V::store(s+c, V::mul(x, V::set(scale)));
+								}
+								c = cols;
+							}
+						#endif
+							for(; c<cols; ++c)
+							{
+								float x = 0.0f;
+								for(std::size_t j=0; j<d; ++j)
+									x += qr[j] * kt[j*attention_cols+c];
+								s[c] = x * scale;
+							}
+							for(c=0; c<cols; ++c)
+								max = (s[c]>max) ? s[c] : max;
+							float alpha = fast_exp2(mx[r]-max);
+							c = 0;
+						#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+							if(sizeof(half) == sizeof(uint16))
+							{
+								V::type x = V::zero(), shift = V::set(max);
+								for(; c+V::size<=cols; c+=V::size)
+								{
+									V::type p = V::exp2(V::sub(V::load(s+c), shift));
+									V::store(s+c, p);
+									x = V::add(x, p);
+								}
+								total = V::sum(x);
+							}
+						#endif
+							for(; c<cols; ++c)
+								total += s[c] = fast_exp2(s[c]-max);
+							mx[r] = max;
+							sum[r] = sum[r]*alpha + total;
+						#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+							if(sizeof(half) == sizeof(uint16))
+							{
+								for(; t+V::size<=d; t+=V::size)
+								{
+									V::type x = V::mul(V::load(a+t), V::set(alpha));
+									for(c=0; c<cols; ++c)
+										x = V::madd(V::set(s[c]), V::load(vf+c*d+t), x);
+									V::store(a+t, x);
+								}
+							}
+						#endif
+							for(; t<d; ++t)
+							{
+								float x = a[t] * alpha;
+								for(c=0; c<cols; ++c)
+									x += s[c] * vf[c*d+t];
+								a[t] = x;
+							}
+						}
+					}
+					for(std::size_t r=0; r<nr; ++r)
+						scale_to_half(acc+r*d, o+(h*m+r0+r)*d, d, 1.0f/sum[r]);
+				}
+			}
+		}
+
+	#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+		/// Check single-precision approximations for rounding.
+		/// Approximations farther than \a K units in the last place from any half-precision value or midpoint between two 
+		/// round to the same half-precision value as the exact results in every rounding mode, as long as their errors are 
+		/// smaller than that. The nearest of these boundaries is found by adding and subtracting a power of 2 times 1.5 whose 
+		/// unit in the last place is their spacing. Approximations that are zero, infinite, NaN, not larger than 2^-25 or not 
+		/// smaller than 2^15 in magnitude are never safe.
+		/// \tparam V vector type
+		/// \tparam K error bound in units in the last place of single-precision
+		/// \param a single-precision approximations
+		/// \return mask of approximations that round to the correctly rounded results
+		template<typename V,unsigned int K> typename V::type rounding_safe(typename V::type a)
+		{
+			typename V::type m = V::abs(a), p = V::band(m, V::set(std::numeric_limits<float>::infinity()));
+			typename V::type c = V::mul(p, V::set(6144.0f)), min = V::set(0.375f);
+			c = V::select(V::less(c, min), min, c);
+			typename V::type d = V::abs(V::sub(m, V::sub(V::add(m, c), c)));
+			return V::band(V::band(V::less(V::set(2.98023224e-8f), m), V::less(m, V::set(32768.0f))), 
+				V::less(V::mul(p, V::set(static_cast<float>(K)*1.1920929e-7f)), d));
+		}
+	#endif
+
+		/// Sigmoid for array activation.
+		struct sigmoid_op
+		{
+			enum { error = 8 };
+			static half scalar(half x) { return sigmoid(x); }
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			template<typename V> static typename V::type simd(typename V::type x)
+			{
+				typename V::type t = V::exp2(V::mul(x, V::set(-1.44287109375f)), V::mul(x, V::set(0.000176052854f)));
+				return V::div(V::set(1.0f), V::add(t, V::set(1.0f)));
+			}
+		#endif
+		};
+
+		/// SiLU for array activation.
+		struct silu_op
+		{
+			enum { error = 8 };
+			static half scalar(half x) { return silu(x); }
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			template<typename V> static typename V::type simd(typename V::type x)
+			{
+				typename V::type t = V::exp2(V::mul(x, V::set(-1.44287109375f)), V::mul(x, V::set(0.000176052854f)));
+				return V::div(x, V::add(t, V::set(1.0f)));
+			}
+		#endif
+		};
+
+		/// GELU for array activation.
+		/// The complementary error function uses the approximation of erfc() from Numerical Recipes, whose exponent is 
+		/// added to the exactly split square of the argument, and is only evaluated for arguments smaller than 6 in magnitude.
+		struct gelu_op
+		{
+			enum { error = 16 };
+			static half scalar(half x) { return gelu(x); }
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			template<typename V> static typename V::type simd(typename V::type x)
+			{
+				typename V::type a = V::abs(x), t = V::div(V::set(1.0f), V::madd(a, V::set(0.353553391f), V::set(1.0f)));
+				typename V::type p = V::madd(t, V::set(0.17087277f), V::set(-0.82215223f));
+				p = V::madd(p, t, V::set(1.48851587f));
+				p = V::madd(p, t, V::set(-1.13520398f));
+				p = V::madd(p, t, V::set(0.27886807f));
+				p = V::madd(p, t, V::set(-0.18628806f));
+				p = V::madd(p, t, V::set(0.09678418f));
+				p = V::madd(p, t, V::set(0.37409196f));
+				p = V::madd(p, t, V::set(1.00002368f));
+				p = V::madd(p, t, V::set(-1.26551223f));
+				typename V::type u = V::mul(V::mul(x, x), V::set(-0.5f)), c = V::set(98304.0f);
+				typename V::type uh = V::sub(V::add(u, c), c), ul = V::sub(u, uh);
+				typename V::type l = V::madd(ul, V::set(1.44269504f), V::mul(uh, V::set(-0.000176052854f)));
+				typename V::type h = V::mul(V::mul(t, V::set(0.5f)), V::exp2(V::mul(uh, V::set(1.44287109375f)), V::madd(p, V::set(1.44269504f), l)));
+				typename V::type r = V::mul(x, V::select(V::less(x, V::zero()), h, V::sub(V::set(1.0f), h)));
+				return V::band(V::less(a, V::set(6.0f)), r);
+			}
+		#endif
+		};
+
+		/// Activation function for array.
+		/// The single-precision approximations of \a F are vectorized with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or 
+		/// [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available and only rounded if rounding_safe() for the error bound of 
+		/// \a F. All other elements are computed with the exact scalar function, so the results are always correctly rounded. 
+		/// If exceptions are enabled, subnormal results are computed with the scalar function as well, since all other 
+		/// safely rounded results just raise FE_INEXACT. Chunks of large arrays are computed in parallel if 
+		/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and exceptions are disabled.
+		/// \tparam F activation function
+		/// \param x array of values
+		/// \param y array to store results at
+		/// \param n number of elements
+		/// \exception FE_... according to \a F
+		template<typename F> void activation(const half *x, half *y, std::size_t n)
+		{
+		#if HALF_ENABLE_OPENMP && !HALF_ERRHANDLING
+			if(n > pairwise_chunk)
+			{
+				long chunks = static_cast<long>((n+pairwise_chunk-1)/pairwise_chunk);
+				#pragma omp parallel for schedule(static)
+				for(long c=0; c<chunks; ++c)
+				{
+					std::size_t i = static_cast<std::size_t>(c) * pairwise_chunk;
+					activation<F>(x+i, y+i, std::min<std::size_t>(n-i, pairwise_chunk));
+				}
+				return;
+			}
+		#endif
+			std::size_t i = 0;
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			typedef float_vector V;
+			if(sizeof(half) == sizeof(uint16))
+			{
+				for(; i+V::size<=n; i+=V::size)
+				{
+					V::type v = F::template simd<V>(V::load(x+i)), ok = rounding_safe<V,F::error>(v);
+				#if HALF_ERRHANDLING
+					ok = V::band(ok, V::less(V::set(6.10351562e-5f), V::abs(v)));
+				#endif
+					int safe = V::mask(ok);
+					raise(FE_INEXACT, safe != 0);
+					if(safe == (1<<V::size)-1)
+						V::store(y+i, v);
+					else
+					{
+						half h[V::size];
+						V::store(h, v);
+						for(int j=0; j<V::size; ++j)
+							if(!((safe>>j)&1))
+								h[j] = F::scalar(x[i+j]);
+						std::copy(h, h+V::size, y+i);
+					}
+				}
+			}
+		#endif
+			for(; i<n; ++i)
+				y[i] = F::scalar(x[i]);
+		}
+
+		/// Rectified linear unit for array.
+		/// This clears all negative values, which are those with the sign bit set that are not NaN, and quiets NaNs in 
+		/// 8 elements at once with [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available. Chunks of large arrays are 
+		/// computed in parallel if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and exceptions are disabled.
+		/// \param x array of values
+		/// \param y array to store results at
+		/// \param n number of elements
+		/// \exception FE_INVALID for signaling NaNs
+		inline void rectify(const half *x, half *y, std::size_t n)
+		{
+			std::size_t i = 0;
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			if(sizeof(half) == sizeof(uint16))
+			{
+				long blocks = static_cast<long>(n/8);
+				__m128i abs = _mm_set1_epi16(0x7FFF), inf = _mm_set1_epi16(0x7C00), quiet = _mm_set1_epi16(0x200);
+			#if HALF_ENABLE_OPENMP && !HALF_ERRHANDLING
+				#pragma omp parallel for schedule(static) if(n > pairwise_chunk)
+			#endif
+				for(long b=0; b<blocks; ++b)
+				{
+					__m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x+8*b));
+					__m128i nan = _mm_cmpgt_epi16(_mm_and_si128(h, abs), inf);
+					__m128i neg = _mm_andnot_si128(nan, _mm_cmplt_epi16(h, _mm_setzero_si128()));
+				#if HALF_ERRHANDLING
+					raise(FE_INVALID, _mm_movemask_epi8(_mm_andnot_si128(_mm_cmpeq_epi16(_mm_and_si128(h, quiet), quiet), nan)) != 0);
+				#endif
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(y+8*b), _mm_or_si128(_mm_andnot_si128(neg, h), _mm_and_si128(nan, quiet)));
+				}
+				i = 8 * static_cast<std::size_t>(blocks);
+			}
+		#endif
+			for(; i<n; ++i)
+				y[i] = relu(x[i]);
+		}
+
+		/// Rounding of single-precision weights to half-precision.
+		/// Stochastic rounding takes its random bits from hash_mix() of the element index offset by the hashed seed, so the 
+		/// results only depend on the seed and the position of each weight and not on how the array is split into vectors or 
+		/// across threads.
+		struct weight_rounder
+		{
+			/// Constructor.
+			/// \param s `true` for stochastic rounding, `false` for rounding like the conversion to half-precision
+			/// \param seed seed for random bits
+			weight_rounder(bool s, unsigned long seed) : stochastic(s), key(hash_mix(static_cast<uint32>(seed)&0xFFFFFFFF)) {}
+
+			/// Counter for element.
+			/// \param i index of element
+			/// \return counter to hash for random bits
+			uint32 counter(std::size_t i) const { return (static_cast<uint32>(i)+key) & 0xFFFFFFFF; }
+
+			/// Round weight.
+			/// Finite values are rounded stochastically by adding random bits below the last place of the half-precision 
+			/// result and rounding toward zero, or by comparing random bits to the discarded part for subnormal results.
+			/// \param value single-precision weight
+			/// \param i index of weight
+			/// \return rounded half-precision weight
+			/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+			half operator()(float value, std::size_t i) const
+			{
+				if(!stochastic)
+					return half(value);
+				bits<float>::type fbits;
+				std::memcpy(&fbits, &value, sizeof(float));
+				unsigned int sign = static_cast<unsigned int>(fbits>>16) & 0x8000;
+				fbits &= 0x7FFFFFFF;
+				if(fbits >= 0x7F800000)
+					return half(value);
+				uint32 r = hash_mix(counter(i));
+				if(fbits >= 0x38800000)
+				{
+					bits<float>::type up = fbits + (r&0x1FFF);
+					return half(binary, rounded<std::round_toward_zero,false>(sign|((up>=0x47800000) ? 0x7C00 : 
+						static_cast<unsigned int>((up>>13)-0x1C000)), 0, (fbits&0x1FFF)!=0));
+				}
+				unsigned int e = static_cast<unsigned int>(fbits>>23), shift = 126 - (e ? e : 1);
+				bits<float>::type m = e ? ((fbits&0x7FFFFF)|0x800000) : fbits, one = 1;
+				unsigned int k = (shift<32) ? static_cast<unsigned int>((m+(r&((one<<shift)-1)))>>shift) : 
+					static_cast<unsigned int>(shift<56 && r<(m>>(shift-32)));
+				return half(binary, rounded<std::round_toward_zero,false>(sign|k, 0, ((shift<32) ? (m&((one<<shift)-1)) : m)!=0));
+			}
+
+			/// Whether to round stochastically.
+			bool stochastic;
+
+			/// Hashed seed.
+			uint32 key;
+		};
+
+		/// Stochastic gradient descent update.
+		/// This computes `w -= lr * (g + decay*w)`.
+		struct sgd_kernel
+		{
+			/// Update single weight.
+			/// \param i index of weight
+			/// \return updated weight
+			float update(std::size_t i) const { return w[i] -= lr * (w[i]*decay+static_cast<float>(g[i])); }
+
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			/// Update vector of weights.
+			/// \tparam V float vector traits
+			/// \param i index of first weight
+			/// \return updated weights
+			template<typename V> typename V::type simd(std::size_t i) const
+			{
+				typename V::type x = V::load(w+i);
+				x = V::madd(V::madd(x, V::set(decay), V::load(g+i)), V::set(-lr), x);
+				V::store(w+i, x);
+				return x;
+			}
+		#endif
+
+			/// Gradients.
+			const half *g;
+
+			/// Master weights.
+			float *w;
+
+			/// Learning rate.
+			float lr;
+
+			/// Weight decay.
+			float decay;
+		};
+
+		/// Stochastic gradient descent with momentum update.
+		/// This computes `d = g + decay*w`, `v = mu*v + d` and `w -= lr * v`, or `w -= lr * (d + mu*v)` for Nesterov momentum.
+		struct momentum_kernel
+		{
+			/// Update single weight.
+			/// \param i index of weight
+			/// \return updated weight
+			float update(std::size_t i) const
+			{
+				float d = w[i]*decay + static_cast<float>(g[i]), u = v[i] = v[i]*mu + d;
+				return w[i] -= lr * (nesterov ? (u*mu+d) : u);
+			}
+
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			/// Update vector of weights.
+			/// \tparam V float vector traits
+			/// \param i index of first weight
+			/// \return updated weights
+			template<typename V> typename V::type simd(std::size_t i) const
+			{
+				typename V::type x = V::load(w+i), d = V::madd(x, V::set(decay), V::load(g+i)), u = V::madd(V::load(v+i), V::set(mu), d);
+				V::store(v+i, u);
+				if(nesterov)
+					u = V::madd(u, V::set(mu), d);
+				x = V::madd(u, V::set(-lr), x);
+				V::store(w+i, x);
+				return x;
+			}
+		#endif
+
+			/// Gradients.
+			const half *g;
+
+			/// Master weights.
+			float *w;
+
+			/// Velocities.
+			float *v;
+
+			/// Learning rate.
+			float lr;
+
+			/// Momentum.
+			float mu;
+
+			/// Weight decay.
+			float decay;
+
+			/// Whether to use Nesterov momentum.
+			bool nesterov;
+		};
+
+		/// Adam update with decoupled weight decay.
+		/// This computes `m = beta1*m + (1-beta1)*g`, `v = beta2*v + (1-beta2)*g^2` and 
+		/// `w = keep*w - step*m / (scale*sqrt(v) + eps)`, with the bias corrections of the step count folded into `step` and 
+		/// `scale`.
+		struct adam_kernel
+		{
+			/// Update single weight.
+			/// \param i index of weight
+			/// \return updated weight
+			float update(std::size_t i) const
+			{
+				float x = static_cast<float>(g[i]), a = m[i] = beta1*m[i] + c1*x, b = v[i] = beta2*v[i] + c2*(x*x);
+				return w[i] = w[i]*keep - step*a/(std::sqrt(b)*scale+eps);
+			}
+
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			/// Update vector of weights.
+			/// \tparam V float vector traits
+			/// \param i index of first weight
+			/// \return updated weights
+			template<typename V> typename V::type simd(std::size_t i) const
+			{
+				typename V::type x = V::load(g+i), a = V::madd(V::load(m+i), V::set(beta1), V::mul(V::set(c1), x));
+				typename V::type b = V::madd(V::load(v+i), V::set(beta2), V::mul(V::set(c2), V::mul(x, x)));
+				V::store(m+i, a);
+				V::store(v+i, b);
+				x = V::sub(V::mul(V::load(w+i), V::set(keep)), V::div(V::mul(V::set(step), a), V::madd(V::sqrt(b), V::set(scale), V::set(eps))));
+				V::store(w+i, x);
+				return x;
+			}
+		#endif
+
+			/// Gradients.
+			const half *g;
+
+			/// Master weights.
+			float *w;
+
+			/// First moments.
+			float *m;
+
+			/// Second moments.
+			float *v;
+
+			/// Decay rates of first and second moments.
+			float beta1, beta2;
+
+			/// Complements of decay rates.
+			float c1, c2;
+
+			/// Factor for weights.
+			float keep;
+
+			/// Bias-corrected learning rate.
+			float step;
+
+			/// Bias correction of square roots of second moments.
+			float scale;
+
+			/// Term added to denominator.
+			float eps;
+		};
+
+		/// Optimizer step.
+		/// This updates the master weights with the kernel, vectorized with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or 
+		/// [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available, and rounds them to their half-precision copies in the same 
+		/// pass. Stochastically rounded vectors take the random bits as multiples of the last place of single-precision 
+		/// below that of half-precision with the sign of the weights, so adding them and clearing the lower bits is exact. 
+		/// Weights outside the normal half-precision range are rounded one by one. Chunks of large arrays are updated in 
+		/// parallel if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and exceptions are disabled.
+		/// \tparam K optimizer kernel
+		/// \param kernel optimizer kernel
+		/// \param rounder rounding of weights
+		/// \param h array to store rounded weights at
+		/// \param i index of first weight
+		/// \param n index after last weight
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		template<typename K> void optimize(const K &kernel, const weight_rounder &rounder, half *h, std::size_t i, std::size_t n)
+		{
+		#if HALF_ENABLE_OPENMP && !HALF_ERRHANDLING
+			if(n-i > pairwise_chunk)
+			{
+				long chunks = static_cast<long>((n-i+pairwise_chunk-1)/pairwise_chunk);
+				#pragma omp parallel for schedule(static)
+				for(long c=0; c<chunks; ++c)
+				{
+					std::size_t j = i + static_cast<std::size_t>(c)*pairwise_chunk;
+					optimize(kernel, rounder, h, j, std::min<std::size_t>(n, j+pairwise_chunk));
+				}
+				return;
+			}
+		#endif
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			typedef float_vector V;
+			if(sizeof(half) == sizeof(uint16))
+			{
+				if(!rounder.stochastic)
+					for(; i+V::size<=n; i+=V::size)
+						V::store(h+i, kernel.template simd<V>(i));
+				else
+				{
+					bits<float>::type mask = 0xFFFFE000;
+					float f[2] = { -std::numeric_limits<float>::infinity() };
+					std::memcpy(f+1, &mask, sizeof(float));
+					V::type exp = V::set(f[0]), upper = V::set(f[1]), lo = V::set(6.10351562e-5f), hi = V::set(65504.0f);
+					for(; i+V::size<=n; i+=V::size)
+					{
+						V::type w = kernel.template simd<V>(i), a = V::abs(w), normal = V::band(V::less(lo, a), V::less(a, hi));
+						V::type d = V::mul(V::random(rounder.counter(i)), V::mul(V::band(w, exp), V::set(1.1920929e-7f)));
+					#if HALF_ERRHANDLING
+						raise(FE_INEXACT, V::mask(V::band(normal, V::less(V::abs(V::band(w, upper)), a))) != 0);
+					#endif
+						V::store(h+i, V::band(normal, V::band(V::add(w, d), upper)));
+						int safe = V::mask(normal);
+						if(safe != (1<<V::size)-1)
+							for(int j=0; j<V::size; ++j)
+								if(!((safe>>j)&1))
+									h[i+j] = rounder(kernel.w[i+j], i+j);
+					}
+				}
+			}
+		#endif
+			for(; i<n; ++i)
+				h[i] = rounder(kernel.update(i), i);
+		}
+
+		/// Check for infinities and NaNs.
+		/// This compares the exponents of 32 values at a time with 16-bit [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) integer 
+		/// operations if available and stops after the first block with a non-finite value. Chunks of large arrays are 
+		/// checked in parallel if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled.
+		/// \param bits bit representations of half-precision values
+		/// \param n number of elements
+		/// \retval true if all values are finite
+		/// \retval false if any value is infinite or NaN
+		inline bool all_finite(const uint16 *bits, std::size_t n)
+		{
+		#if HALF_ENABLE_OPENMP
+			if(n > pairwise_chunk)
+			{
+				long chunks = static_cast<long>((n+pairwise_chunk-1)/pairwise_chunk);
+				int finite = 1;
+				#pragma omp parallel for schedule(static) reduction(&:finite)
+				for(long c=0; c<chunks; ++c)
+				{
+					std::size_t i = static_cast<std::size_t>(c) * pairwise_chunk;
+					if(finite)
+						finite = all_finite(bits+i, std::min<std::size_t>(n-i, pairwise_chunk));
+				}
+				return finite != 0;
+			}
+		#endif
+			std::size_t i = 0;
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			__m128i inf = _mm_set1_epi16(0x7C00);
+			for(; i+32<=n; i+=32)
+			{
+				const __m128i *p = reinterpret_cast<const __m128i*>(bits+i);
+				__m128i a = _mm_cmpeq_epi16(_mm_and_si128(_mm_loadu_si128(p), inf), inf);
+				__m128i b = _mm_cmpeq_epi16(_mm_and_si128(_mm_loadu_si128(p+1), inf), inf);
+				__m128i c = _mm_cmpeq_epi16(_mm_and_si128(_mm_loadu_si128(p+2), inf), inf);
+				__m128i d = _mm_cmpeq_epi16(_mm_and_si128(_mm_loadu_si128(p+3), inf), inf);
+				if(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))))
+					return false;
+			}
+		#endif
+			for(; i<n; ++i)
+				if((bits[i]&0x7C00) == 0x7C00)
+					return false;
+			return true;
+		}
+
+		/// Scaling with check for infinities and NaNs.
+		/// This multiplies the values by the factor in single-precision, vectorized with 
+		/// [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available, and checks 
+		/// the exponents of each block of 8 rounded results right after storing them. Chunks of large arrays are scaled in 
+		/// parallel if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and exceptions are disabled.
+		/// \param scale factor for values
+		/// \param x array of values
+		/// \param y array to store results at
+		/// \param n number of elements
+		/// \retval true if all results are finite
+		/// \retval false if any result is infinite or NaN
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline bool unscale(float scale, const half *x, half *y, std::size_t n)
+		{
+		#if HALF_ENABLE_OPENMP && !HALF_ERRHANDLING
+			if(n > pairwise_chunk)
+			{
+				long chunks = static_cast<long>((n+pairwise_chunk-1)/pairwise_chunk);
+				int finite = 1;
+				#pragma omp parallel for schedule(static) reduction(&:finite)
+				for(long c=0; c<chunks; ++c)
+				{
+					std::size_t i = static_cast<std::size_t>(c) * pairwise_chunk;
+					finite &= unscale(scale, x+i, y+i, std::min<std::size_t>(n-i, pairwise_chunk));
+				}
+				return finite != 0;
+			}
+		#endif
+			std::size_t i = 0;
+			bool finite = true;
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			typedef float_vector V;
+			if(sizeof(half) == sizeof(uint16))
+			{
+				V::type s = V::set(scale);
+				__m128i inf = _mm_set1_epi16(0x7C00), hit = _mm_setzero_si128();
+				for(; i+8<=n; i+=8)
+				{
+					for(int j=0; j<8; j+=V::size)
+						V::store(y+i+j, V::mul(V::load(x+i+j), s));
+					hit = _mm_or_si128(hit, _mm_cmpeq_epi16(_mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(y+i)), inf), inf));
+				}
+				finite = _mm_movemask_epi8(hit) == 0;
+			}
+		#endif
+			for(; i<n; ++i)
+			{
+				y[i] = half(static_cast<float>(x[i])*scale);
+				finite = finite && half_float::isfinite(y[i]);
+			}
+			return finite;
+		}
+
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		/// Check for NaNs.
+		/// \param x 8 half-precision values
+		/// \return all ones for NaNs, zero else
+		inline __m128i sse2_isnan(__m128i x) { return _mm_cmpgt_epi16(_mm_and_si128(x, _mm_set1_epi16(0x7FFF)), _mm_set1_epi16(0x7C00)); }
+
+		/// Compute comparison keys.
+		/// \param x 8 half-precision values
+		/// \return keys of non-NaN values to compare as signed 16-bit integers, equal for positive and negative zero
+		inline __m128i sse2_order(__m128i x)
+		{
+			__m128i s = _mm_srai_epi16(x, 15);
+			return _mm_sub_epi16(_mm_xor_si128(_mm_and_si128(x, _mm_set1_epi16(0x7FFF)), s), s);
+		}
+
+		/// Sum of unsigned 16-bit integers.
+		/// \param x 8 unsigned 16-bit integers
+		/// \return sum of all 8 integers
+		inline std::size_t sse2_sum16(__m128i x)
+		{
+			__m128i s = _mm_add_epi32(_mm_unpacklo_epi16(x, _mm_setzero_si128()), _mm_unpackhi_epi16(x, _mm_setzero_si128()));
+			s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+			s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+			return static_cast<std::size_t>(_mm_cvtsi128_si32(s));
+		}
+	#endif
+
+		/// Test policy for isfinite() on arrays.
+		struct isfinite_test
+		{
+			/// Test value.
+			/// \param x value to test
+			/// \return result of test
+			static bool scalar(half x) { return half_float::isfinite(x); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Test values.
+			/// \param x 8 half-precision values
+			/// \return all ones for values passing the test, zero else
+			static __m128i sse2(__m128i x) { return _mm_cmplt_epi16(_mm_and_si128(x, _mm_set1_epi16(0x7FFF)), _mm_set1_epi16(0x7C00)); }
+		#endif
+		};
+
+		/// Test policy for isinf() on arrays.
+		struct isinf_test
+		{
+			/// Test value.
+			/// \param x value to test
+			/// \return result of test
+			static bool scalar(half x) { return half_float::isinf(x); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Test values.
+			/// \param x 8 half-precision values
+			/// \return all ones for values passing the test, zero else
+			static __m128i sse2(__m128i x) { return _mm_cmpeq_epi16(_mm_and_si128(x, _mm_set1_epi16(0x7FFF)), _mm_set1_epi16(0x7C00)); }
+		#endif
+		};
+
+		/// Test policy for isnan() on arrays.
+		struct isnan_test
+		{
+			/// Test value.
+			/// \param x value to test
+			/// \return result of test
+			static bool scalar(half x) { return half_float::isnan(x); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Test values.
+			/// \param x 8 half-precision values
+			/// \return all ones for values passing the test, zero else
+			static __m128i sse2(__m128i x) { return sse2_isnan(x); }
+		#endif
+		};
+
+		/// Test policy for isnormal() on arrays.
+		struct isnormal_test
+		{
+			/// Test value.
+			/// \param x value to test
+			/// \return result of test
+			static bool scalar(half x) { return half_float::isnormal(x); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Test values.
+			/// \param x 8 half-precision values
+			/// \return all ones for values passing the test, zero else
+			static __m128i sse2(__m128i x)
+			{
+				__m128i a = _mm_and_si128(x, _mm_set1_epi16(0x7FFF));
+				return _mm_and_si128(_mm_cmpgt_epi16(a, _mm_set1_epi16(0x3FF)), _mm_cmplt_epi16(a, _mm_set1_epi16(0x7C00)));
+			}
+		#endif
+		};
+
+		/// Test policy for signbit() on arrays.
+		struct signbit_test
+		{
+			/// Test value.
+			/// \param x value to test
+			/// \return result of test
+			static bool scalar(half x) { return half_float::signbit(x); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Test values.
+			/// \param x 8 half-precision values
+			/// \return all ones for values passing the test, zero else
+			static __m128i sse2(__m128i x) { return _mm_srai_epi16(x, 15); }
+		#endif
+		};
+
+		/// Comparison policy for isgreater() on arrays.
+		struct isgreater_test
+		{
+			/// Compare values.
+			/// \param x first operand
+			/// \param y second operand
+			/// \return result of comparison
+			static bool scalar(half x, half y) { return half_float::isgreater(x, y); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Compare values.
+			/// \param x 8 half-precision first operands
+			/// \param y 8 half-precision second operands
+			/// \return all ones for true comparisons, zero else
+			static __m128i sse2(__m128i x, __m128i y)
+			{
+				return _mm_andnot_si128(_mm_or_si128(sse2_isnan(x), sse2_isnan(y)), _mm_cmpgt_epi16(sse2_order(x), sse2_order(y)));
+			}
+		#endif
+		};
+
+		/// Comparison policy for isgreaterequal() on arrays.
+		struct isgreaterequal_test
+		{
+			/// Compare values.
+			/// \param x first operand
+			/// \param y second operand
+			/// \return result of comparison
+			static bool scalar(half x, half y) { return half_float::isgreaterequal(x, y); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Compare values.
+			/// \param x 8 half-precision first operands
+			/// \param y 8 half-precision second operands
+			/// \return all ones for true comparisons, zero else
+			static __m128i sse2(__m128i x, __m128i y)
+			{
+				return _mm_andnot_si128(_mm_or_si128(_mm_or_si128(sse2_isnan(x), sse2_isnan(y)), 
+					_mm_cmplt_epi16(sse2_order(x), sse2_order(y))), _mm_set1_epi16(-1));
+			}
+		#endif
+		};
+
+		/// Comparison policy for isless() on arrays.
+		struct isless_test
+		{
+			/// Compare values.
+			/// \param x first operand
+			/// \param y second operand
+			/// \return result of comparison
+			static bool scalar(half x, half y) { return half_float::isless(x, y); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Compare values.
+			/// \param x 8 half-precision first operands
+			/// \param y 8 half-precision second operands
+			/// \return all ones for true comparisons, zero else
+			static __m128i sse2(__m128i x, __m128i y)
+			{
+				return _mm_andnot_si128(_mm_or_si128(sse2_isnan(x), sse2_isnan(y)), _mm_cmplt_epi16(sse2_order(x), sse2_order(y)));
+			}
+		#endif
+		};
+
+		/// Comparison policy for islessequal() on arrays.
+		struct islessequal_test
+		{
+			/// Compare values.
+			/// \param x first operand
+			/// \param y second operand
+			/// \return result of comparison
+			static bool scalar(half x, half y) { return half_float::islessequal(x, y); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Compare values.
+			/// \param x 8 half-precision first operands
+			/// \param y 8 half-precision second operands
+			/// \return all ones for true comparisons, zero else
+			static __m128i sse2(__m128i x, __m128i y)
+			{
+				return _mm_andnot_si128(_mm_or_si128(_mm_or_si128(sse2_isnan(x), sse2_isnan(y)), 
+					_mm_cmpgt_epi16(sse2_order(x), sse2_order(y))), _mm_set1_epi16(-1));
+			}
+		#endif
+		};
+
+		/// Comparison policy for islessgreater() on arrays.
+		struct islessgreater_test
+		{
+			/// Compare values.
+			/// \param x first operand
+			/// \param y second operand
+			/// \return result of comparison
+			static bool scalar(half x, half y) { return half_float::islessgreater(x, y); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Compare values.
+			/// \param x 8 half-precision first operands
+			/// \param y 8 half-precision second operands
+			/// \return all ones for true comparisons, zero else
+			static __m128i sse2(__m128i x, __m128i y)
+			{
+				return _mm_andnot_si128(_mm_or_si128(_mm_or_si128(sse2_isnan(x), sse2_isnan(y)), 
+					_mm_cmpeq_epi16(sse2_order(x), sse2_order(y))), _mm_set1_epi16(-1));
+			}
+		#endif
+		};
+
+		/// Comparison policy for isunordered() on arrays.
+		struct isunordered_test
+		{
+			/// Compare values.
+			/// \param x first operand
+			/// \param y second operand
+			/// \return result of comparison
+			static bool scalar(half x, half y) { return half_float::isunordered(x, y); }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Compare values.
+			/// \param x 8 half-precision first operands
+			/// \param y 8 half-precision second operands
+			/// \return all ones for true comparisons, zero else
+			static __m128i sse2(__m128i x, __m128i y) { return _mm_or_si128(sse2_isnan(x), sse2_isnan(y)); }
+		#endif
+		};
+
+		/// Test array elements.
+		/// This tests 16 values at a time with 16-bit [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) integer operations if 
+		/// available and packs the results into bytes. Chunks of large arrays are tested in parallel if 
+		/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled.
+		/// \tparam T test policy
+		/// \param x array of values
+		/// \param r array to store results at
+		/// \param n number of elements
+		template<typename T> void test_array(const half *x, bool *r, std::size_t n)
+		{
+		#if HALF_ENABLE_OPENMP
+			if(n > pairwise_chunk)
+			{
+				long chunks = static_cast<long>((n+pairwise_chunk-1)/pairwise_chunk);
+				#pragma omp parallel for schedule(static)
+				for(long c=0; c<chunks; ++c)
+				{
+					std::size_t i = static_cast<std::size_t>(c) * pairwise_chunk;
+					test_array<T>(x+i, r+i, std::min<std::size_t>(n-i, pairwise_chunk));
+				}
+				return;
+			}
+		#endif
+			std::size_t i = 0;
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			if(sizeof(half) == sizeof(uint16) && sizeof(bool) == 1)
+			{
+				for(; i+16<=n; i+=16)
+				{
+					const __m128i *p = reinterpret_cast<const __m128i*>(x+i);
+					__m128i m = _mm_packs_epi16(T::sse2(_mm_loadu_si128(p)), T::sse2(_mm_loadu_si128(p+1)));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(r+i), _mm_and_si128(m, _mm_set1_epi8(1)));
+				}
+			}
+		#endif
+			for(; i<n; ++i)
+				r[i] = T::scalar(x[i]);
+		}
+
+		/// Compare array elements.
+		/// This compares 16 pairs of values at a time with 16-bit [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) integer operations 
+		/// if available and packs the results into bytes. Chunks of large arrays are compared in parallel if 
+		/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled.
+		/// \tparam T comparison policy
+		/// \param x array of first operands
+		/// \param y array of second operands
+		/// \param incy increment between second operands, 0 or 1
+		/// \param r array to store results at
+		/// \param n number of elements
+		template<typename T> void compare_array(const half *x, const half *y, std::size_t incy, bool *r, std::size_t n)
+		{
+		#if HALF_ENABLE_OPENMP
+			if(n > pairwise_chunk)
+			{
+				long chunks = static_cast<long>((n+pairwise_chunk-1)/pairwise_chunk);
+				#pragma omp parallel for schedule(static)
+				for(long c=0; c<chunks; ++c)
+				{
+					std::size_t i = static_cast<std::size_t>(c) * pairwise_chunk;
+					compare_array<T>(x+i, y+i*incy, incy, r+i, std::min<std::size_t>(n-i, pairwise_chunk));
+				}
+				return;
+			}
+		#endif
+			std::size_t i = 0;
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			if(sizeof(half) == sizeof(uint16) && sizeof(bool) == 1 && n >= 16)
+			{
+				__m128i sy = _mm_set1_epi16(static_cast<short>(*reinterpret_cast<const uint16*>(y)));
+				for(; i+16<=n; i+=16)
+				{
+					const __m128i *p = reinterpret_cast<const __m128i*>(x+i), *q = reinterpret_cast<const __m128i*>(y+i);
+					__m128i m = _mm_packs_epi16(
+						T::sse2(_mm_loadu_si128(p), incy ? _mm_loadu_si128(q) : sy), 
+						T::sse2(_mm_loadu_si128(p+1), incy ? _mm_loadu_si128(q+1) : sy));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(r+i), _mm_and_si128(m, _mm_set1_epi8(1)));
+				}
+			}
+		#endif
+			if(incy)
+				for(; i<n; ++i)
+					r[i] = T::scalar(x[i], y[i]);
+			else
+				for(half b=*y; i<n; ++i)
+					r[i] = T::scalar(x[i], b);
+		}
+
+		/// Classify array elements.
+		/// This classifies 8 values at a time with 16-bit [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) integer operations if 
+		/// available and the classification macros fit into 16 bits. Chunks of large arrays are classified in parallel if 
+		/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled.
+		/// \param x array of values
+		/// \param r array to store classes at
+		/// \param n number of elements
+		inline void classify(const half *x, int *r, std::size_t n)
+		{
+		#if HALF_ENABLE_OPENMP
+			if(n > pairwise_chunk)
+			{
+				long chunks = static_cast<long>((n+pairwise_chunk-1)/pairwise_chunk);
+				#pragma omp parallel for schedule(static)
+				for(long c=0; c<chunks; ++c)
+				{
+					std::size_t i = static_cast<std::size_t>(c) * pairwise_chunk;
+					classify(x+i, r+i, std::min<std::size_t>(n-i, pairwise_chunk));
+				}
+				return;
+			}
+		#endif
+			std::size_t i = 0;
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			if(sizeof(half) == sizeof(uint16) && sizeof(int) == 4 && FP_ZERO == static_cast<short>(FP_ZERO) && 
+				FP_SUBNORMAL == static_cast<short>(FP_SUBNORMAL) && FP_NORMAL == static_cast<short>(FP_NORMAL) && 
+				FP_INFINITE == static_cast<short>(FP_INFINITE) && FP_NAN == static_cast<short>(FP_NAN))
+			{
+				__m128i zero = _mm_set1_epi16(static_cast<short>(FP_ZERO)), subnormal = _mm_set1_epi16(static_cast<short>(FP_SUBNORMAL));
+				__m128i normal = _mm_set1_epi16(static_cast<short>(FP_NORMAL)), inf = _mm_set1_epi16(static_cast<short>(FP_INFINITE));
+				__m128i nan = _mm_set1_epi16(static_cast<short>(FP_NAN));
+				for(; i+8<=n; i+=8)
+				{
+					__m128i a = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i)), _mm_set1_epi16(0x7FFF));
+					__m128i low = _mm_cmplt_epi16(a, _mm_set1_epi16(0x400)), z = _mm_cmpeq_epi16(a, _mm_setzero_si128());
+					__m128i big = _mm_cmpgt_epi16(a, _mm_set1_epi16(0x7BFF)), q = _mm_cmpgt_epi16(a, _mm_set1_epi16(0x7C00));
+					__m128i c = _mm_or_si128(_mm_andnot_si128(_mm_or_si128(low, big), normal), _mm_andnot_si128(z, _mm_and_si128(low, subnormal)));
+					c = _mm_or_si128(c, _mm_or_si128(_mm_and_si128(z, zero), _mm_andnot_si128(q, _mm_and_si128(big, inf))));
+					c = _mm_or_si128(c, _mm_and_si128(q, nan));
+					__m128i s = _mm_srai_epi16(c, 15);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(r+i), _mm_unpacklo_epi16(c, s));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(r+i+4), _mm_unpackhi_epi16(c, s));
+				}
+			}
+		#endif
+			for(; i<n; ++i)
+				r[i] = half_float::fpclassify(x[i]);
+		}
+
+		/// Count values per class.
+		/// This counts 8 values at a time in 16-bit [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) integer counters if available, 
+		/// which are added to the totals after at most 65535 iterations. Chunks of large arrays are counted in parallel if 
+		/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled.
+		/// \param bits bit representations of half-precision values
+		/// \param n number of elements
+		/// \param counts counts to add zeros, subnormals, infinities, NaNs and negative values to
+		inline void count_classes(const uint16 *bits, std::size_t n, class_counts &counts)
+		{
+		#if HALF_ENABLE_OPENMP
+			if(n > pairwise_chunk)
+			{
+				long chunks = static_cast<long>((n+pairwise_chunk-1)/pairwise_chunk);
+				std::size_t zero = 0, subnormal = 0, infinite = 0, nan = 0, negative = 0;
+				#pragma omp parallel for schedule(static) reduction(+:zero,subnormal,infinite,nan,negative)
+				for(long c=0; c<chunks; ++c)
+				{
+					std::size_t i = static_cast<std::size_t>(c) * pairwise_chunk;
+					class_counts part = { 0, 0, 0, 0, 0, 0 };
+					count_classes(bits+i, std::min<std::size_t>(n-i, pairwise_chunk), part);
+					zero += part.zero;
+					subnormal += part.subnormal;
+					infinite += part.infinite;
+					nan += part.nan;
+					negative += part.negative;
+				}
+				counts.zero += zero;
+				counts.subnormal += subnormal;
+				counts.infinite += infinite;
+				counts.nan += nan;
+				counts.negative += negative;
+				return;
+			}
+		#endif
+			std::size_t i = 0;
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			while(i+8 <= n)
+			{
+				std::size_t end = i + std::min<std::size_t>((n-i)&~static_cast<std::size_t>(7), 65535*8);
+				__m128i zero = _mm_setzero_si128(), low = zero, inf = zero, nan = zero, sign = zero;
+				for(; i<end; i+=8)
+				{
+					__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bits+i)), a = _mm_and_si128(x, _mm_set1_epi16(0x7FFF));
+					zero = _mm_sub_epi16(zero, _mm_cmpeq_epi16(a, _mm_setzero_si128()));
+					low = _mm_sub_epi16(low, _mm_cmplt_epi16(a, _mm_set1_epi16(0x400)));
+					inf = _mm_sub_epi16(inf, _mm_cmpeq_epi16(a, _mm_set1_epi16(0x7C00)));
+					nan = _mm_sub_epi16(nan, _mm_cmpgt_epi16(a, _mm_set1_epi16(0x7C00)));
+					sign = _mm_sub_epi16(sign, _mm_srai_epi16(x, 15));
+				}
+				std::size_t zeros = sse2_sum16(zero);
+				counts.zero += zeros;
+				counts.subnormal += sse2_sum16(low) - zeros;
+				counts.infinite += sse2_sum16(inf);
+				counts.nan += sse2_sum16(nan);
+				counts.negative += sse2_sum16(sign);
+			}
+		#endif
+			for(; i<n; ++i)
+			{
+				unsigned int mag = bits[i] & 0x7FFF;
+				counts.zero += mag == 0;
+				counts.subnormal += mag != 0 && mag < 0x400;
+				counts.infinite += mag == 0x7C00;
+				counts.nan += mag > 0x7C00;
+				counts.negative += bits[i] >> 15;
+			}
+		}
+
+		/// Scaled addition of single-precision results.
+		/// This is vectorized with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if 
+		/// available.
+		/// \param alpha factor for values
+		/// \param x array of values
+		/// \param y array of results to update
+		/// \param n number of elements
+		inline void axpy(float alpha, const half *x, float *y, std::size_t n)
+		{
+			std::size_t i = 0;
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			typedef float_vector V;
+			if(sizeof(half) == sizeof(uint16))
+			{
+				V::type a = V::set(alpha);
+				for(; i+2*V::size<=n; i+=2*V::size)
+				{
+					V::store(y+i, V::madd(V::load(x+i), a, V::load(y+i)));
+					V::store(y+i+V::size, V::madd(V::load(x+i+V::size), a, V::load(y+i+V::size)));
+				}
+			}
+		#endif
+			for(; i<n; ++i)
+				y[i] += alpha * static_cast<float>(x[i]);
+		}
+
+		/// Sum with single-precision accumulation.
+		/// This is vectorized with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if 
+		/// available and accumulates the remaining values in 4 alternating partial sums, so the order of additions only 
+		/// depends on the number of elements.
+		/// \tparam M `true` to sum magnitudes, `false` to sum values
+		/// \param x array of values
+		/// \param n number of elements
+		/// \return sum of values or magnitudes
+		template<bool M> float float_sum(const half *x, std::size_t n)
+		{
+			float s[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+			std::size_t i = 0;
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			typedef float_vector V;
+			if(sizeof(half) == sizeof(uint16))
+			{
+				V::type s0 = V::zero(), s1 = V::zero();
+				for(; i+2*V::size<=n; i+=2*V::size)
+				{
+					V::type a = V::load(x+i), b = V::load(x+i+V::size);
+					s0 = V::add(s0, M ? V::abs(a) : a);
+					s1 = V::add(s1, M ? V::abs(b) : b);
+				}
+				s[0] = V::sum(V::add(s0, s1));
+			}
+		#endif
+			for(; i<n; ++i)
+				s[i&3] += M ? std::abs(static_cast<float>(x[i])) : static_cast<float>(x[i]);
+			return (s[0]+s[1]) + (s[2]+s[3]);
+		}
+
+		/// Sum with single-precision accumulation.
+		/// \param x array of values
+		/// \param n number of elements
+		/// \return sum of values
+		inline float sum(const half *x, std::size_t n, false_type) { return float_sum<false>(x, n); }
+
+		/// Exact sum.
+		/// \param x array of values
+		/// \param n number of elements
+		/// \return sum of values rounded to nearest
+		inline double sum(const half *x, std::size_t n, true_type)
+		{
+			fixed_sum sum;
+			accumulate_values(x, n, sum);
+			return sum.to_double();
+		}
+
+		/// Partial sums of values or magnitudes.
+		/// \tparam M `true` to sum magnitudes, `false` to sum values
+		template<bool M> struct sum_kernel
+		{
+			/// Sum part of array.
+			/// \param i index of first element
+			/// \param n number of elements
+			/// \return partial sum
+			float operator()(std::size_t i, std::size_t n) const { return float_sum<M>(x+i, n); }
+
+			/// Array of values.
+			const half *x;
+		};
+
+		/// Partial dot products.
+		struct dot_kernel
+		{
+			/// Dot product of part of arrays.
+			/// \param i index of first element
+			/// \param n number of elements
+			/// \return partial dot product
+			float operator()(std::size_t i, std::size_t n) const { return dot(x+i, y+i, n, false_type()); }
+
+			/// First array.
+			const half *x;
+
+			/// Second array.
+			const half *y;
+		};
+
+		/// Pairwise reduction.
+		/// This splits the range in halves at multiples of #pairwise_leaf elements until the parts are small enough to be 
+		/// accumulated directly and adds the partial sums in single-precision.
+		/// \tparam K kernel for partial sums
+		/// \param kernel kernel for partial sums
+		/// \param i index of first element
+		/// \param n number of elements
+		/// \return sum
+		template<typename K> float pairwise(const K &kernel, std::size_t i, std::size_t n)
+		{
+			if(n <= pairwise_leaf)
+				return kernel(i, n);
+			std::size_t h = ((n/(2*pairwise_leaf))+((n%(2*pairwise_leaf))!=0)) * pairwise_leaf;
+			return pairwise(kernel, i, h) + pairwise(kernel, i+h, n-h);
+		}
+
+		/// Pairwise sum of single-precision values.
+		/// \param x array of values
+		/// \param n number of elements, at least 1
+		/// \return sum of values
+		inline float pairwise(const float *x, std::size_t n)
+		{
+			return (n==1) ? x[0] : (pairwise(x, n/2)+pairwise(x+n/2, n-n/2));
+		}
+
+		/// Deterministic parallel reduction.
+		/// This reduces chunks of #pairwise_chunk elements with pairwise() and then adds the partial sums pairwise, so the 
+		/// order of additions only depends on the number of elements. The chunks are distributed across threads if 
+		/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled, which does not change the result.
+		/// \tparam K kernel for partial sums
+		/// \param kernel kernel for partial sums
+		/// \param n number of elements
+		/// \return sum
+		template<typename K> float parallel_pairwise(const K &kernel, std::size_t n)
+		{
+			if(n <= pairwise_chunk)
+				return pairwise(kernel, 0, n);
+			long chunks = static_cast<long>((n+pairwise_chunk-1)/pairwise_chunk);
+			std::vector<float> partial(chunks);
+		#if HALF_ENABLE_OPENMP
+			#pragma omp parallel for schedule(static)
+		#endif
+			for(long c=0; c<chunks; ++c)
+			{
+				std::size_t i = static_cast<std::size_t>(c) * pairwise_chunk;
+				partial[c] = pairwise(kernel, i, std::min<std::size_t>(n-i, pairwise_chunk));
+			}
+			return pairwise(&partial[0], partial.size());
+		}
+
+		/// Pairwise sum.
+		/// \param x array of values
+		/// \param n number of elements
+		/// \return sum of values
+		inline float sum(const half *x, std::size_t n, pairwise_type)
+		{
+			sum_kernel<false> kernel = { x };
+			return parallel_pairwise(kernel, n);
+		}
+
+		/// Pairwise dot product.
+		/// \param x first array
+		/// \param y second array
+		/// \param n number of elements
+		/// \return sum of products
+		inline float dot(const half *x, const half *y, std::size_t n, pairwise_type)
+		{
+			dot_kernel kernel = { x, y };
+			return parallel_pairwise(kernel, n);
+		}
+
+		/// Pairwise sum of magnitudes.
+		/// \param x array of values
+		/// \param n number of elements
+		/// \return sum of magnitudes
+		inline float asum(const half *x, std::size_t n, pairwise_type)
+		{
+			sum_kernel<true> kernel = { x };
+			return parallel_pairwise(kernel, n);
+		}
+
+		/// Sum of magnitudes with single-precision accumulation.
+		/// \param x array of values
+		/// \param n number of elements
+		/// \return sum of magnitudes
+		inline float asum(const half *x, std::size_t n, false_type) { return float_sum<true>(x, n); }
+
+		/// Add magnitudes to exact sum.
+		/// \param x array of values
+		/// \param n number of elements
+		/// \param sum fixed-point sum to add magnitudes to
+		inline void accumulate_magnitudes(const half *x, std::size_t n, fixed_sum &sum)
+		{
+			half buf[1024];
+			for(std::size_t i=0; i<n; i+=1024)
+			{
+				std::size_t count = std::min<std::size_t>(n-i, 1024);
+				for(std::size_t j=0; j<count; ++j)
+					buf[j] = half_float::abs(x[i+j]);
+				accumulate_values(buf, count, sum);
+			}
+		}
+
+		/// Exact sum of magnitudes.
+		/// \param x array of values
+		/// \param n number of elements
+		/// \return sum of magnitudes rounded to nearest
+		inline double asum(const half *x, std::size_t n, true_type)
+		{
+			fixed_sum sum;
+			accumulate_magnitudes(x, n, sum);
+			return sum.to_double();
+		}
+
+		/// Search keys for extreme magnitudes.
+		/// This orders values by magnitude, with NaNs above all other values when searching the maximum and below all other 
+		/// values when searching the minimum.
+		/// \tparam M `true` for maximum, `false` for minimum
+		template<bool M> struct magnitude_key
+		{
+			/// Whether to search the maximum.
+			static const bool maximum = M;
+
+			/// Compute search key.
+			/// \param bits bit representation of half-precision value
+			/// \return key to compare as signed 16-bit integer
+			static int scalar(unsigned int bits)
+			{
+				int abs = bits & 0x7FFF;
+				return M ? std::min(abs, 0x7C01) : (abs>0x7C00) ? -1 : abs;
+			}
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Compute search keys.
+			/// \param x 8 half-precision values
+			/// \return keys as signed 16-bit integers
+			static __m128i sse2(__m128i x)
+			{
+				__m128i abs = _mm_and_si128(x, _mm_set1_epi16(0x7FFF));
+				return M ? _mm_min_epi16(abs, _mm_set1_epi16(0x7C01)) : _mm_or_si128(abs, _mm_cmpgt_epi16(abs, _mm_set1_epi16(0x7C00)));
+			}
+		#endif
+		};
+
+		/// Search keys for extreme values.
+		/// This turns the sign-magnitude representation into two's complement, which orders values like fmin() and fmax(), 
+		/// with negative zero below positive zero, and maps NaNs to the key that loses every comparison, so they are ignored.
+		/// \tparam M `true` for maximum, `false` for minimum
+		template<bool M> struct value_key
+		{
+			/// Whether to search the maximum.
+			static const bool maximum = M;
+
+			/// Compute search key.
+			/// \param bits bit representation of half-precision value
+			/// \return key to compare as signed 16-bit integer
+			static int scalar(unsigned int bits)
+			{
+				return ((bits&0x7FFF) > 0x7C00) ? (M ? -0x8000 : 0x7FFF) : (bits&0x8000) ? -1-static_cast<int>(bits&0x7FFF) : static_cast<int>(bits);
+			}
+
+			/// Convert search key back to value.
+			/// \param key key of non-NaN value
+			/// \return bit representation of half-precision value
+			static unsigned int value(int key) { return (key<0) ? (0x8000|(-1-key)) : key; }
+
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			/// Compute search keys.
+			/// \param x 8 half-precision values
+			/// \return keys as signed 16-bit integers
+			static __m128i sse2(__m128i x)
+			{
+				__m128i key = _mm_xor_si128(x, _mm_and_si128(_mm_srai_epi16(x, 15), _mm_set1_epi16(0x7FFF)));
+				__m128i nan = _mm_cmpgt_epi16(_mm_and_si128(x, _mm_set1_epi16(0x7FFF)), _mm_set1_epi16(0x7C00));
+				return _mm_or_si128(_mm_andnot_si128(nan, key), _mm_and_si128(nan, _mm_set1_epi16(static_cast<short>(M ? 0x8000 : 0x7FFF))));
+			}
+		#endif
+		};
+
+		/// Extreme search key.
+		/// This uses 16-bit [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) integer operations if available.
+		/// \tparam K search key policy
+		/// \param bits bit representations of half-precision values
+		/// \param n number of elements
+		/// \param snan variable to set to true if there are signaling NaNs, or 0 to not check for them
+		/// \return largest or smallest key
+		template<typename K> int extreme_key(const uint16 *bits, std::size_t n, bool *snan)
+		{
+			int best = K::maximum ? -0x8000 : 0x7FFF;
+			unsigned int signal = 0;
+			std::size_t i = 0;
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			if(n >= 8)
+			{
+				__m128i b = _mm_set1_epi16(static_cast<short>(best)), s = _mm_setzero_si128();
+				for(; i+8<=n; i+=8)
+				{
+					__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bits+i)), k = K::sse2(x);
+					b = K::maximum ? _mm_max_epi16(b, k) : _mm_min_epi16(b, k);
+					if(snan)
+						s = _mm_or_si128(s, _mm_andnot_si128(x, _mm_cmpgt_epi16(_mm_and_si128(x, _mm_set1_epi16(0x7FFF)), _mm_set1_epi16(0x7C00))));
+				}
+				b = K::maximum ? _mm_max_epi16(b, _mm_srli_si128(b, 8)) : _mm_min_epi16(b, _mm_srli_si128(b, 8));
+				b = K::maximum ? _mm_max_epi16(b, _mm_srli_si128(b, 4)) : _mm_min_epi16(b, _mm_srli_si128(b, 4));
+				b = K::maximum ? _mm_max_epi16(b, _mm_srli_si128(b, 2)) : _mm_min_epi16(b, _mm_srli_si128(b, 2));
+				best = static_cast<short>(_mm_cvtsi128_si32(b));
+				signal = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(s, _mm_set1_epi16(0x200)), _mm_setzero_si128())) != 0xFFFF;
+			}
+		#endif
+			for(; i<n; ++i)
+			{
+				int k = K::scalar(bits[i]);
+				best = K::maximum ? std::max(best, k) : std::min(best, k);
+				if(snan)
+					signal |= (bits[i]&0x7FFF) > 0x7C00 && !(bits[i]&0x200);
+			}
+			if(snan)
+				*snan = signal != 0;
+			return best;
+		}
+
+		/// Search for first occurrence of key.
+		/// This uses 16-bit [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) integer comparisons if available.
+		/// \tparam K search key policy
+		/// \param bits bit representations of half-precision values
+		/// \param n number of elements
+		/// \param key key to search, must occur in array
+		/// \return index of first element with key
+		template<typename K> std::size_t find_key(const uint16 *bits, std::size_t n, int key)
+		{
+			std::size_t i = 0;
+		#if HALF_ENABLE_SSE2_INTRINSICS
+			__m128i b = _mm_set1_epi16(static_cast<short>(key));
+			for(; i+8<=n; i+=8)
+			{
+				if(int hit = _mm_movemask_epi8(_mm_cmpeq_epi16(K::sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bits+i))), b)))
+				{
+					for(; !(hit&1); hit>>=2)
+						++i;
+					return i;
+				}
+			}
+		#endif
+			for(; i<n && K::scalar(bits[i])!=key; ++i) ;
+			return i;
+		}
+
+		/// Index of extreme magnitude.
+		/// \tparam M `true` for maximum, `false` for minimum
+		/// \param x array of values
+		/// \param n number of elements
+		/// \return index of first element with extreme magnitude or first NaN
+		template<bool M> std::size_t magnitude_index(const half *x, std::size_t n)
+		{
+			if(!n)
+				return 0;
+			if(sizeof(half) == sizeof(uint16))
+			{
+				const uint16 *bits = reinterpret_cast<const uint16*>(x);
+				return find_key<magnitude_key<M> >(bits, n, extreme_key<magnitude_key<M> >(bits, n, 0));
+			}
+			std::size_t k = 0;
+			for(std::size_t i=0; i<n; ++i)
+			{
+				if(half_float::isnan(x[i]))
+					return i;
+				if(M ? (half_float::abs(x[i])>half_float::abs(x[k])) : (half_float::abs(x[i])<half_float::abs(x[k])))
+					k = i;
+			}
+			return k;
+		}
+
+		/// Index of extreme value.
+		/// \tparam M `true` for maximum, `false` for minimum
+		/// \param x array of values
+		/// \param n number of elements
+		/// \return index of first element with extreme value ignoring NaNs, 0 if all are NaN
+		template<bool M> std::size_t value_index(const half *x, std::size_t n)
+		{
+			if(!n)
+				return 0;
+			if(sizeof(half) == sizeof(uint16))
+			{
+				const uint16 *bits = reinterpret_cast<const uint16*>(x);
+				int key = extreme_key<value_key<M> >(bits, n, 0);
+				return (key==(M ? -0x8000 : 0x7FFF)) ? 0 : find_key<value_key<M> >(bits, n, key);
+			}
+			std::size_t k = 0;
+			for(std::size_t i=1; i<n; ++i)
+				if(!half_float::isnan(x[i]) && (half_float::isnan(x[k]) || (M ? (x[i]>x[k] || (x[i]==x[k] && signbit(x[k]) && !signbit(x[i]))) : 
+					(x[i]<x[k] || (x[i]==x[k] && signbit(x[i]) && !signbit(x[k]))))))
+					k = i;
+			return k;
+		}
+
+		/// Extreme value.
+		/// \tparam M `true` for maximum, `false` for minimum
+		/// \param bits bit representations of half-precision values
+		/// \param n number of elements
+		/// \return largest or smallest value ignoring NaNs, quiet NaN if all are NaN
+		/// \exception FE_INVALID if any value is signaling NaN
+		template<bool M> unsigned int extreme_value(const uint16 *bits, std::size_t n)
+		{
+		#if HALF_ERRHANDLING
+			bool snan = false;
+			int key = extreme_key<value_key<M> >(bits, n, &snan);
+			raise(FE_INVALID, snan);
+		#else
+			int key = extreme_key<value_key<M> >(bits, n, 0);
+		#endif
+			return (key==(M ? -0x8000 : 0x7FFF)) ? 0x7FFF : value_key<M>::value(key);
+		}
+
+		/// Prefix sums with single-precision carry.
+		/// This computes the prefix sums of whole vectors in registers and adds them to the carry, vectorized with 
+		/// [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available. So consecutive 
+		/// vectors only depend on each other through a single addition to the carry.
+		/// \tparam I `true` for inclusive, `false` for exclusive prefix sums
+		/// \tparam T type of results
+		/// \param x array of values
+		/// \param y array to store prefix sums at
+		/// \param n number of elements
+		/// \param carry sum of preceding values
+		/// \return sum of preceding values and all elements
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding of half-precision results
+		template<bool I,typename T> float scan_block(const half *x, T *y, std::size_t n, float carry)
+		{
+			std::size_t i = 0;
+		#if HALF_ENABLE_F16C_INTRINSICS || HALF_ENABLE_SSE2_INTRINSICS
+			typedef float_vector V;
+			if(sizeof(half) == sizeof(uint16))
+			{
+				V::type c = V::set(carry);
+				for(; i+V::size<=n; i+=V::size)
+				{
+					V::type s = V::scan(V::load(x+i));
+					V::store(y+i, V::add(I ? s : V::shift(s), c));
+					c = V::add(c, V::last(s));
+				}
+				carry = V::first(c);
+			}
+		#endif
+			for(; i<n; ++i)
+			{
+				float s = carry + static_cast<float>(x[i]);
+				y[i] = T(I ? s : carry);
+				carry = s;
+			}
+			return carry;
+		}
+
+		/// Round exact sum to half-precision.
+		/// \param sum fixed-point sum
+		/// \param y variable to store correctly rounded sum at
+		/// \exception FE_INVALID for signaling NaN addends or infinities of different sign
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline void store_sum(const fixed_sum &sum, half &y) { y = sum.to_half<std::numeric_limits<half>::round_style>(); }
+
+		/// Round exact sum to single-precision.
+		/// \param sum fixed-point sum
+		/// \param y variable to store sum rounded to double-precision and then to single-precision at
+		inline void store_sum(const fixed_sum &sum, float &y) { y = static_cast<float>(sum.to_double()); }
+
+		/// Round exact sum to half-precision.
+		/// \param sum exact sum
+		/// \param y variable to store correctly rounded sum at
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline void store_sum(double sum, half &y) { y = half_cast<half>(sum); }
+
+		/// Round exact sum to single-precision.
+		/// \param sum exact sum
+		/// \param y variable to store correctly rounded sum at
+		inline void store_sum(double sum, float &y) { y = static_cast<float>(sum); }
+
+		/// Prefix sums with exact carry.
+		/// Since half-precision values are multiples of 2^-24, their sums are exact in double-precision as long as they are 
+		/// smaller than 2^29 in magnitude. So blocks of finite values are summed in double-precision while the carry is small 
+		/// enough, which only differs from the fixed-point sum in the sign of zero sums when rounding towards negative 
+		/// infinity. The fixed-point sum is used otherwise and for the first value, since the sign of an empty sum would differ.
+		/// \tparam I `true` for inclusive, `false` for exclusive prefix sums
+		/// \tparam T type of results
+		/// \param x array of values
+		/// \param y array to store rounded prefix sums at
+		/// \param n number of elements
+		/// \param carry exact sum of preceding values, to add all elements to
+		/// \exception FE_INVALID for signaling NaN values or infinities of different sign
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding of half-precision results
+		template<bool I,typename T> void scan_block(const half *x, T *y, std::size_t n, fixed_sum &carry)
+		{
+			for(std::size_t i=0; i<n; )
+			{
+				std::size_t m = (carry.special&48) ? std::min<std::size_t>(n-i, 2048) : 1, j = 0;
+				if(std::numeric_limits<half>::round_style != std::round_toward_neg_infinity && (carry.special&48) && !(carry.special&15))
+				{
+					double c = carry.to_double();
+					if(std::abs(c) < 268435456.0)
+					{
+						std::size_t k = 0;
+						for(; k<m && isfinite(x[i+k]); ++k) ;
+						accumulate_values(x+i, k, carry);
+						for(; j<k; ++j)
+						{
+							double s = c + static_cast<double>(x[i+j]);
+							store_sum(I ? s : c, y[i+j]);
+							c = s;
+						}
+					}
+				}
+				for(; j<m; ++j)
+				{
+					half h = x[i+j];
+					if(!I)
+						store_sum(carry, y[i+j]);
+					carry.add_value(h);
+					if(I)
+						store_sum(carry, y[i+j]);
+				}
+				i += m;
+			}
+		}
+
+		/// Prefix sums with single-precision accumulation.
+		/// Without [OpenMP](\ref HALF_ENABLE_OPENMP) this scans the array in a single pass. Otherwise arrays of more than 
+		/// #pairwise_chunk elements are scanned in two parallel passes over chunks of this size. The first sums the chunks, 
+		/// whose prefix sums are then the carries for scanning the chunks in the second pass. Since the chunks do not depend 
+		/// on the number of threads, neither do the results. Half-precision results are only computed in parallel if 
+		/// exceptions are disabled, since those would otherwise be raised in different threads.
+		/// \tparam I `true` for inclusive, `false` for exclusive prefix sums
+		/// \tparam T type of results
+		/// \param x array of values
+		/// \param y array to store prefix sums at
+		/// \param n number of elements
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding of half-precision results
+		template<bool I,typename T> void scan(const half *x, T *y, std::size_t n, false_type)
+		{
+		#if HALF_ENABLE_OPENMP
+			if(n > pairwise_chunk)
+			{
+				long chunks = static_cast<long>((n+pairwise_chunk-1)/pairwise_chunk);
+				std::vector<float> carry(chunks);
+				#pragma omp parallel for schedule(static)
+				for(long c=1; c<chunks; ++c)
+					carry[c] = float_sum<false>(x+static_cast<std::size_t>(c-1)*pairwise_chunk, pairwise_chunk);
+				for(long c=1; c<chunks; ++c)
+					carry[c] += carry[c-1];
+			#if HALF_ERRHANDLING
+				#pragma omp parallel for schedule(static) if(sizeof(T) == sizeof(float))
+			#else
+				#pragma omp parallel for schedule(static)
+			#endif
+				for(long c=0; c<chunks; ++c)
+				{
+					std::size_t i = static_cast<std::size_t>(c) * pairwise_chunk;
+					scan_block<I>(x+i, y+i, std::min<std::size_t>(n-i, pairwise_chunk), carry[c]);
+				}
+				return;
+			}
+		#endif
+			scan_block<I>(x, y, n, 0.0f);
+		}
+
+		/// Prefix sums with exact accumulation.
+		/// This is computed in two parallel passes like with single-precision accumulation, but the results are the same as 
+		/// for a single pass.
+		/// \tparam I `true` for inclusive, `false` for exclusive prefix sums
+		/// \tparam T type of results
+		/// \param x array of values
+		/// \param y array to store rounded prefix sums at
+		/// \param n number of elements
+		/// \exception FE_INVALID for signaling NaN values or infinities of different sign
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding of half-precision results
+		template<bool I,typename T> void scan(const half *x, T *y, std::size_t n, true_type)
+		{
+		#if HALF_ENABLE_OPENMP
+			if(n > pairwise_chunk)
+			{
+				long chunks = static_cast<long>((n+pairwise_chunk-1)/pairwise_chunk);
+				std::vector<fixed_sum> carry(chunks);
+				#pragma omp parallel for schedule(static)
+				for(long c=1; c<chunks; ++c)
+					accumulate_values(x+static_cast<std::size_t>(c-1)*pairwise_chunk, pairwise_chunk, carry[c]);
+				for(long c=1; c<chunks; ++c)
+					carry[c].add(carry[c-1]);
+			#if HALF_ERRHANDLING
+				#pragma omp parallel for schedule(static) if(sizeof(T) == sizeof(float))
+			#else
+				#pragma omp parallel for schedule(static)
+			#endif
+				for(long c=0; c<chunks; ++c)
+				{
+					std::size_t i = static_cast<std::size_t>(c) * pairwise_chunk;
+					scan_block<I>(x+i, y+i, std::min<std::size_t>(n-i, pairwise_chunk), carry[c]);
+				}
+				return;
+			}
+		#endif
+			fixed_sum carry;
+			scan_block<I>(x, y, n, carry);
+		}
+	}
+
+	/// \anchor arrays
+	/// \name Array arithmetic
+	/// \{
+
+	/// Addition of arrays.
+	/// This computes the same results and exceptions as operator+(half,half) for each element, but vectorized if 
+	/// [F16C](\ref HALF_ENABLE_F16C_INTRINSICS), [AVX2](\ref HALF_ENABLE_AVX2_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) 
+	/// intrinsics are enabled. Output may alias any of the inputs.
+	/// \param x array of left operands
+	/// \param y array of right operands
+	/// \param out array to store sums at
+	/// \param n number of elements
+	/// \exception FE_... according to operator+(half,half)
+	inline void add(const half *x, const half *y, half *out, std::size_t n) { detail::array_op<detail::add_op>(x, 1, y, 1, out, n); }
+
+	/// Addition of array and scalar.
+	/// \param x array of left operands
+	/// \param y right operand
+	/// \param out array to store sums at
+	/// \param n number of elements
+	/// \exception FE_... according to operator+(half,half)
+	inline void add(const half *x, half y, half *out, std::size_t n) { detail::array_op<detail::add_op>(x, 1, &y, 0, out, n); }
+
+	/// Addition of scalar and array.
+	/// \param x left operand
+	/// \param y array of right operands
+	/// \param out array to store sums at
+	/// \param n number of elements
+	/// \exception FE_... according to operator+(half,half)
+	inline void add(half x, const half *y, half *out, std::size_t n) { detail::array_op<detail::add_op>(&x, 0, y, 1, out, n); }
+
+	/// Subtraction of arrays.
+	/// This computes the same results and exceptions as operator-(half,half) for each element, but vectorized if 
+	/// [F16C](\ref HALF_ENABLE_F16C_INTRINSICS), [AVX2](\ref HALF_ENABLE_AVX2_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) 
+	/// intrinsics are enabled. Output may alias any of the inputs.
+	/// \param x array of left operands
+	/// \param y array of right operands
+	/// \param out array to store differences at
+	/// \param n number of elements
+	/// \exception FE_... according to operator-(half,half)
+	inline void sub(const half *x, const half *y, half *out, std::size_t n) { detail::array_op<detail::sub_op>(x, 1, y, 1, out, n); }
+
+	/// Subtraction of array and scalar.
+	/// \param x array of left operands
+	/// \param y right operand
+	/// \param out array to store differences at
+	/// \param n number of elements
+	/// \exception FE_... according to operator-(half,half)
+	inline void sub(const half *x, half y, half *out, std::size_t n) { detail::array_op<detail::sub_op>(x, 1, &y, 0, out, n); }
+
+	/// Subtraction of scalar and array.
+	/// \param x left operand
+	/// \param y array of right operands
+	/// \param out array to store differences at
+	/// \param n number of elements
+	/// \exception FE_... according to operator-(half,half)
+	inline void sub(half x, const half *y, half *out, std::size_t n) { detail::array_op<detail::sub_op>(&x, 0, y, 1, out, n); }
+
+	/// Multiplication of arrays.
+	/// This computes the same results and exceptions as operator*(half,half) for each element, but vectorized if 
+	/// [F16C](\ref HALF_ENABLE_F16C_INTRINSICS), [AVX2](\ref HALF_ENABLE_AVX2_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) 
+	/// intrinsics are enabled. Output may alias any of the inputs.
+	/// \param x array of left operands
+	/// \param y array of right operands
+	/// \param out array to store products at
+	/// \param n number of elements
+	/// \exception FE_... according to operator*(half,half)
+	inline void mul(const half *x, const half *y, half *out, std::size_t n) { detail::array_op<detail::mul_op>(x, 1, y, 1, out, n); }
+
+	/// Multiplication of array and scalar.
+	/// \param x array of left operands
+	/// \param y right operand
+	/// \param out array to store products at
+	/// \param n number of elements
+	/// \exception FE_... according to operator*(half,half)
+	inline void mul(const half *x, half y, half *out, std::size_t n) { detail::array_op<detail::mul_op>(x, 1, &y, 0, out, n); }
+
+	/// Multiplication of scalar and array.
+	/// \param x left operand
+	/// \param y array of right operands
+	/// \param out array to store products at
+	/// \param n number of elements
+	/// \exception FE_... according to operator*(half,half)
+	inline void mul(half x, const half *y, half *out, std::size_t n) { detail::array_op<detail::mul_op>(&x, 0, y, 1, out, n); }
+
+	/// Division of arrays.
+	/// This computes the same results and exceptions as operator/(half,half) for each element, but vectorized if 
+	/// [F16C](\ref HALF_ENABLE_F16C_INTRINSICS), [AVX2](\ref HALF_ENABLE_AVX2_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) 
+	/// intrinsics are enabled. Output may alias any of the inputs.
+	/// \param x array of dividends
+	/// \param y array of divisors
+	/// \param out array to store quotients at
+	/// \param n number of elements
+	/// \exception FE_... according to operator/(half,half)
+	inline void div(const half *x, const half *y, half *out, std::size_t n) { detail::array_op<detail::div_op>(x, 1, y, 1, out, n); }
+
+	/// Division of array and scalar.
+	/// \param x array of dividends
+	/// \param y divisor
+	/// \param out array to store quotients at
+	/// \param n number of elements
+	/// \exception FE_... according to operator/(half,half)
+	inline void div(const half *x, half y, half *out, std::size_t n) { detail::array_op<detail::div_op>(x, 1, &y, 0, out, n); }
+
+	/// Division of scalar and array.
+	/// \param x dividend
+	/// \param y array of divisors
+	/// \param out array to store quotients at
+	/// \param n number of elements
+	/// \exception FE_... according to operator/(half,half)
+	inline void div(half x, const half *y, half *out, std::size_t n) { detail::array_op<detail::div_op>(&x, 0, y, 1, out, n); }
+
+	/// Fused multiply add of arrays.
+	/// This computes the same results and exceptions as fma(half,half,half) for each element, but vectorized if 
+	/// [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) intrinsics are enabled. Output may alias any of the inputs. This has its own 
+	/// name so that `half_float::fma` still names a single function.
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param z array of third operands
+	/// \param out array to store results at
+	/// \param n number of elements
+	/// \exception FE_... according to fma(half,half,half)
+	inline void fma_array(const half *x, const half *y, const half *z, half *out, std::size_t n) { detail::array_fma(x, 1, y, 1, z, 1, out, n); }
+
+	/// Fused multiply add of arrays with scalar factor.
+	/// \param x array of first operands
+	/// \param y second operand
+	/// \param z array of third operands
+	/// \param out array to store results at
+	/// \param n number of elements
+	/// \exception FE_... according to fma(half,half,half)
+	inline void fma_array(const half *x, half y, const half *z, half *out, std::size_t n) { detail::array_fma(x, 1, &y, 0, z, 1, out, n); }
+
+	/// Fused multiply add of arrays with scalar addend.
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param z third operand
+	/// \param out array to store results at
+	/// \param n number of elements
+	/// \exception FE_... according to fma(half,half,half)
+	inline void fma_array(const half *x, const half *y, half z, half *out, std::size_t n) { detail::array_fma(x, 1, y, 1, &z, 0, out, n); }
+
+	/// Scaled addition of arrays.
+	/// This computes `y = alpha * x + y` in the manner of the BLAS `axpy` functions, with each element rounded once like 
+	/// fma(half,half,half), vectorized if [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) intrinsics are enabled.
+	/// \param alpha factor for values
+	/// \param x array of values
+	/// \param y array of results to update
+	/// \param n number of elements
+	/// \exception FE_... according to fma(half,half,half)
+	inline void axpy(half alpha, const half *x, half *y, std::size_t n) { detail::array_fma(&alpha, 0, x, 1, y, 1, y, n); }
+
+	/// Scaled addition to single-precision array.
+	/// This computes `y = alpha * x + y` in single-precision, vectorized if [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or 
+	/// [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) intrinsics are enabled, which allows accumulating many updates without 
+	/// rounding each one to half-precision.
+	/// \param alpha factor for values
+	/// \param x array of values
+	/// \param y array of single-precision results to update
+	/// \param n number of elements
+	inline void axpy(float alpha, const half *x, float *y, std::size_t n) { detail::axpy(alpha, x, y, n); }
+
+	/// Scaling of array.
+	/// This computes `x = alpha * x` in the manner of the BLAS `scal` functions, with the same results and exceptions as 
+	/// mul().
+	/// \param alpha factor for values
+	/// \param x array of values to scale
+	/// \param n number of elements
+	/// \exception FE_... according to operator*(half,half)
+	inline void scal(half alpha, half *x, std::size_t n) { detail::array_op<detail::mul_op>(&alpha, 0, x, 1, x, n); }
+	/// \}
+
+	/// \name Array rounding
+	/// \{
+
+	/// Nearest integers not less than array values.
+	/// This computes the same results and exceptions as ceil(half) for each element, but rounds 8 values at a time directly 
+	/// on their bit representations with 16-bit [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) integer operations if available. 
+	/// The same holds for all the other rounding functions on arrays, which are named after the scalar functions with an 
+	/// `_array` suffix. Output may alias the input.
+	/// \param x array of values
+	/// \param out array to store results at
+	/// \param n number of elements
+	/// \exception FE_INVALID for signaling NaNs
+	/// \exception FE_INEXACT if values had to be rounded
+	inline void ceil_array(const half *x, half *out, std::size_t n) { detail::integral_array<std::round_toward_infinity,true,true,ceil>(x, out, n); }
+
+	/// Nearest integers not greater than array values.
+	/// \param x array of values
+	/// \param out array to store results of floor(half) at
+	/// \param n number of elements
+	/// \exception FE_INVALID for signaling NaNs
+	/// \exception FE_INEXACT if values had to be rounded
+	inline void floor_array(const half *x, half *out, std::size_t n) { detail::integral_array<std::round_toward_neg_infinity,true,true,floor>(x, out, n); }
+
+	/// Nearest integers not greater in magnitude than array values.
+	/// \param x array of values
+	/// \param out array to store results of trunc(half) at
+	/// \param n number of elements
+	/// \exception FE_INVALID for signaling NaNs
+	/// \exception FE_INEXACT if values had to be rounded
+	inline void trunc_array(const half *x, half *out, std::size_t n) { detail::integral_array<std::round_toward_zero,true,true,trunc>(x, out, n); }
+
+	/// Nearest integers of array values, rounded away from zero in half-way cases.
+	/// \param x array of values
+	/// \param out array to store results of round(half) at
+	/// \param n number of elements
+	/// \exception FE_INVALID for signaling NaNs
+	/// \exception FE_INEXACT if values had to be rounded
+	inline void round_array(const half *x, half *out, std::size_t n) { detail::integral_array<std::round_to_nearest,false,true,round>(x, out, n); }
+
+	/// Nearest integers of array values using half's internal rounding mode.
+	/// \param x array of values
+	/// \param out array to store results of rint(half) at
+	/// \param n number of elements
+	/// \exception FE_INVALID for signaling NaNs
+	/// \exception FE_INEXACT if values had to be rounded
+	inline void rint_array(const half *x, half *out, std::size_t n) { detail::integral_array<std::numeric_limits<half>::round_style,true,true,rint>(x, out, n); }
+
+	/// Nearest integers of array values using half's internal rounding mode without raising FE_INEXACT.
+	/// \param x array of values
+	/// \param out array to store results of nearbyint(half) at
+	/// \param n number of elements
+	/// \exception FE_INVALID for signaling NaNs
+	inline void nearbyint_array(const half *x, half *out, std::size_t n) { detail::integral_array<std::numeric_limits<half>::round_style,true,false,nearbyint>(x, out, n); }
+
+	/// Nearest 16-bit integers of array values, rounded away from zero in half-way cases.
+	/// This computes the same as lround(half) for each element, but saturates the results to the range of `short`. The 
+	/// values are rounded like for round() on arrays and converted exactly via single-precision with 
+	/// [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available. The same holds for the other conversions of arrays to 
+	/// integers.
+	/// \param x array of values
+	/// \param out array to store results at
+	/// \param n number of elements
+	/// \exception FE_INVALID for NaNs, infinities and values not representable as `short`
+	inline void lround_array(const half *x, short *out, std::size_t n) { detail::integral_array<std::round_to_nearest,false,false,lround>(x, out, n); }
+
+	/// Nearest 32-bit integers of array values, rounded away from zero in half-way cases.
+	/// \param x array of values
+	/// \param out array to store results of lround(half), saturated to the range of `int`, at
+	/// \param n number of elements
+	/// \exception FE_INVALID for NaNs and infinities
+	inline void lround_array(const half *x, int *out, std::size_t n) { detail::integral_array<std::round_to_nearest,false,false,lround>(x, out, n); }
+
+	/// Nearest 16-bit integers of array values using half's internal rounding mode.
+	/// \param x array of values
+	/// \param out array to store results of lrint(half), saturated to the range of `short`, at
+	/// \param n number of elements
+	/// \exception FE_INVALID for NaNs, infinities and values not representable as `short`
+	/// \exception FE_INEXACT if values had to be rounded
+	inline void lrint_array(const half *x, short *out, std::size_t n) { detail::integral_array<std::numeric_limits<half>::round_style,true,true,lrint>(x, out, n); }
+
+	/// Nearest 32-bit integers of array values using half's internal rounding mode.
+	/// \param x array of values
+	/// \param out array to store results of lrint(half), saturated to the range of `int`, at
+	/// \param n number of elements
+	/// \exception FE_INVALID for NaNs and infinities
+	/// \exception FE_INEXACT if values had to be rounded
+	inline void lrint_array(const half *x, int *out, std::size_t n) { detail::integral_array<std::numeric_limits<half>::round_style,true,true,lrint>(x, out, n); }
+	/// \}
+
+	/// Exact accumulator.
+	/// This accumulates sums of half-precision values and their products exactly in a wide fixed-point format, which can 
+	/// represent every such sum of up to 2^47 terms, and rounds the result only once when it is requested. The result is 
+	/// thus independent of the order of accumulation and accumulators for different parts of the input can be combined 
+	/// without any loss of accuracy. Array accumulation is vectorized if [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) intrinsics 
+	/// are enabled.
+	///
+	/// Infinite and NaN terms are remembered and make the result infinite or NaN, like a plain sum would. The sign of a zero 
+	/// result follows the rules of IEEE addition too, i.e. it is negative only if all terms were negative zeros or when 
+	/// rounding towards negative infinity and not all terms were positive zeros.
+	class exact_accumulator
+	{
+	public:
+		/// Default constructor.
+		/// This initializes the accumulator to an empty sum, which is positive zero.
+		exact_accumulator() {}
+
+		/// Add value.
+		/// \param x value to add
+		/// \return reference to this accumulator
+		exact_accumulator& operator+=(half x) { sum_.add_value(x); return *this; }
+
+		/// Subtract value.
+		/// \param x value to subtract
+		/// \return reference to this accumulator
+		exact_accumulator& operator-=(half x) { sum_.add_value(-x); return *this; }
+
+		/// Add other accumulator.
+		/// \param other accumulator whose sum to add
+		/// \return reference to this accumulator
+		exact_accumulator& operator+=(const exact_accumulator &other) { sum_.add(other.sum_); return *this; }
+
+		/// Add product.
+		/// \param x first factor
+		/// \param y second factor
+		void add_product(half x, half y) { sum_.add_product(x, y); }
+
+		/// Add array of values.
+		/// \param x array of values
+		/// \param n number of elements
+		void add(const half *x, std::size_t n) { detail::accumulate_values(x, n, sum_); }
+
+		/// Add products of arrays.
+		/// \param x first array
+		/// \param y second array
+		/// \param n number of elements
+		void add_products(const half *x, const half *y, std::size_t n) { detail::accumulate_products(x, y, n, sum_); }
+
+		/// Get rounded sum.
+		/// \return accumulated sum correctly rounded to half-precision
+		/// \exception FE_INVALID for signaling NaN terms, infinity times zero or infinite terms of different sign
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		half value() const { return sum_.to_half<std::numeric_limits<half>::round_style>(); }
+
+		/// Get sum in double-precision.
+		/// \return accumulated sum rounded to nearest double-precision value
+		double to_double() const { return sum_.to_double(); }
+
+	private:
+		/// Fixed-point sum.
+		detail::fixed_sum sum_;
+	};
+
+	/// \name Array reductions
+	/// \{
+
+	/// Dot product with selectable accumulation.
+	/// For `accumulate_float` the products, which are exact in single-precision, are accumulated in single-precision with 
+	/// several partial sums in an unspecified order, vectorized if [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or 
+	/// [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) intrinsics are enabled. For `accumulate_exact` the products are accumulated 
+	/// exactly in fixed-point and the result is the exact dot product rounded to the nearest double-precision value, 
+	/// independent of the order of elements and vectorized if [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) intrinsics are 
+	/// enabled. For `accumulate_pairwise` blocks of products are accumulated like for `accumulate_float` and their sums are 
+	/// added in a fixed tree that only depends on the number of elements, so the result is reproducible even though chunks 
+	/// of large arrays are computed in parallel if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled, which it also does for 
+	/// `accumulate_exact`. The result is NaN if any product is NaN or if there are infinite products of different sign.
+	/// \tparam A accumulation policy
+	/// \param x first array
+	/// \param y second array
+	/// \param n number of elements
+	/// \return sum of products as double-precision for `accumulate_exact` or single-precision otherwise
+	template<accumulation A> typename detail::conditional<A==accumulate_exact,double,float>::type dot(const half *x, const half *y, std::size_t n)
+	{
+		return detail::dot(x, y, n, typename detail::accumulation_type<A>::type());
+	}
+
+	/// Dot product.
+	/// This accumulates the products in single-precision, like `dot<accumulate_float>(x, y, n)`.
+	/// \param x first array
+	/// \param y second array
+	/// \param n number of elements
+	/// \return sum of products
+	inline float dot(const half *x, const half *y, std::size_t n) { return dot<accumulate_float>(x, y, n); }
+
+	/// Sum with selectable accumulation.
+	/// For `accumulate_float` the values are accumulated in single-precision with several partial sums in an unspecified 
+	/// order, vectorized if [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) intrinsics 
+	/// are enabled. For `accumulate_exact` they are accumulated exactly and the result is rounded to the nearest 
+	/// double-precision value, use exact_sum() for a correctly rounded half-precision result instead. For 
+	/// `accumulate_pairwise` the values are added like by pairwise_sum().
+	/// \tparam A accumulation policy
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return sum as double-precision for `accumulate_exact` or single-precision otherwise
+	template<accumulation A> typename detail::conditional<A==accumulate_exact,double,float>::type sum(const half *x, std::size_t n)
+	{
+		return detail::sum(x, n, typename detail::accumulation_type<A>::type());
+	}
+
+	/// Sum.
+	/// This accumulates the values in single-precision, like `sum<accumulate_float>(x, n)`.
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return sum of values
+	inline float sum(const half *x, std::size_t n) { return sum<accumulate_float>(x, n); }
+
+	/// Pairwise sum.
+	/// This recursively splits the array into halves and adds their sums in single-precision, like 
+	/// `sum<accumulate_pairwise>(x, n)`. So the rounding error only grows logarithmically with the number of elements 
+	/// rather than linearly and the order of additions only depends on the number of elements, even when large arrays are 
+	/// summed in parallel with [OpenMP](\ref HALF_ENABLE_OPENMP).
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return sum of values
+	inline float pairwise_sum(const half *x, std::size_t n) { return sum<accumulate_pairwise>(x, n); }
+
+	/// Sum of magnitudes with selectable accumulation.
+	/// This computes the sum of absolute values in the manner of the BLAS `asum` functions. For `accumulate_float` the 
+	/// magnitudes are accumulated in single-precision with several partial sums in an unspecified order, vectorized if 
+	/// [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) intrinsics are enabled. For 
+	/// `accumulate_exact` they are accumulated exactly and the result is rounded to the nearest double-precision value. 
+	/// For `accumulate_pairwise` they are added in a fixed tree like by pairwise_sum().
+	/// \tparam A accumulation policy
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return sum of magnitudes as double-precision for `accumulate_exact` or single-precision otherwise
+	template<accumulation A> typename detail::conditional<A==accumulate_exact,double,float>::type asum(const half *x, std::size_t n)
+	{
+		return detail::asum(x, n, typename detail::accumulation_type<A>::type());
+	}
+
+	/// Sum of magnitudes.
+	/// This accumulates the magnitudes in single-precision, like `asum<accumulate_float>(x, n)`.
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return sum of magnitudes
+	inline float asum(const half *x, std::size_t n) { return asum<accumulate_float>(x, n); }
+
+	/// Euclidean norm with selectable accumulation.
+	/// This computes the square root of the sum of squares like dot() of the array with itself. Since the squares of 
+	/// half-precision values are exact in single-precision and far from its overflow and underflow thresholds, this cannot 
+	/// overflow or lose small values and needs no scaling, unlike the BLAS `nrm2` functions.
+	/// \tparam A accumulation policy
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return norm as double-precision for `accumulate_exact` or single-precision otherwise
+	template<accumulation A> typename detail::conditional<A==accumulate_exact,double,float>::type nrm2(const half *x, std::size_t n)
+	{
+		return std::sqrt(detail::dot(x, x, n, typename detail::accumulation_type<A>::type()));
+	}
+
+	/// Euclidean norm.
+	/// This accumulates the squares in single-precision, like `nrm2<accumulate_float>(x, n)`.
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return norm
+	inline float nrm2(const half *x, std::size_t n) { return nrm2<accumulate_float>(x, n); }
+
+	/// Index of largest magnitude.
+	/// This searches the array in the manner of the BLAS `iamax` functions, but with a zero-based result, using 16-bit 
+	/// [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) integer comparisons if available.
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return index of first NaN if any, else of first element with largest absolute value, 0 if \a n is 0
+	inline std::size_t iamax(const half *x, std::size_t n) { return detail::magnitude_index<true>(x, n); }
+
+	/// Index of smallest magnitude.
+	/// This searches the array like iamax(), but for the smallest absolute value.
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return index of first NaN if any, else of first element with smallest absolute value, 0 if \a n is 0
+	inline std::size_t iamin(const half *x, std::size_t n) { return detail::magnitude_index<false>(x, n); }
+
+	/// Minimum of array.
+	/// This computes the same result as folding the array with fmin(), ignoring NaNs and considering negative zero smaller 
+	/// than positive zero, but directly on the bit representations with 16-bit [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) 
+	/// integer operations if available. Unlike fmin() signaling NaNs are ignored as well, they only raise an exception.
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return smallest value, quiet NaN if all values are NaN or \a n is 0
+	/// \exception FE_INVALID if any value is signaling NaN
+	inline half reduce_min(const half *x, std::size_t n)
+	{
+		if(sizeof(half) == sizeof(detail::uint16))
+			return half(detail::binary, detail::extreme_value<false>(reinterpret_cast<const detail::uint16*>(x), n));
+		half r = std::numeric_limits<half>::quiet_NaN();
+		for(std::size_t i=0; i<n; ++i)
+			r = fmin(r, x[i]);
+		return r;
+	}
+
+	/// Maximum of array.
+	/// This computes the same result as folding the array with fmax() like reduce_min().
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return largest value, quiet NaN if all values are NaN or \a n is 0
+	/// \exception FE_INVALID if any value is signaling NaN
+	inline half reduce_max(const half *x, std::size_t n)
+	{
+		if(sizeof(half) == sizeof(detail::uint16))
+			return half(detail::binary, detail::extreme_value<true>(reinterpret_cast<const detail::uint16*>(x), n));
+		half r = std::numeric_limits<half>::quiet_NaN();
+		for(std::size_t i=0; i<n; ++i)
+			r = fmax(r, x[i]);
+		return r;
+	}
+
+	/// Index of minimum.
+	/// This searches the value computed by reduce_min() with 16-bit [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) integer 
+	/// comparisons if available.
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return index of first occurrence of smallest value, 0 if all values are NaN or \a n is 0
+	inline std::size_t argmin(const half *x, std::size_t n) { return detail::value_index<false>(x, n); }
+
+	/// Index of maximum.
+	/// This searches the value computed by reduce_max() like argmin().
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return index of first occurrence of largest value, 0 if all values are NaN or \a n is 0
+	inline std::size_t argmax(const half *x, std::size_t n) { return detail::value_index<true>(x, n); }
+
+	/// Correctly rounded sum.
+	/// This accumulates the values exactly with an exact_accumulator and rounds only the final result, so it is independent of 
+	/// the order of elements and vectorized if [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) intrinsics are enabled.
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return sum of values correctly rounded to half-precision
+	/// \exception FE_INVALID for signaling NaN values or infinities of different sign
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half exact_sum(const half *x, std::size_t n)
+	{
+		exact_accumulator sum;
+		sum.add(x, n);
+		return sum.value();
+	}
+
+	/// Correctly rounded dot product.
+	/// This accumulates the products exactly with an exact_accumulator and rounds only the final result, so it is independent 
+	/// of the order of elements and vectorized if [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) intrinsics are enabled.
+	/// \param x first array
+	/// \param y second array
+	/// \param n number of elements
+	/// \return sum of products correctly rounded to half-precision
+	/// \exception FE_INVALID for signaling NaN operands, infinity times zero or infinite products of different sign
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half exact_dot(const half *x, const half *y, std::size_t n)
+	{
+		exact_accumulator sum;
+		sum.add_products(x, y, n);
+		return sum.value();
+	}
+
+	/// Correctly rounded sum of magnitudes.
+	/// This accumulates the absolute values exactly and rounds only the final result like exact_sum().
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return sum of magnitudes correctly rounded to half-precision
+	/// \exception FE_INVALID for signaling NaN values
+	/// \exception FE_OVERFLOW, ...INEXACT according to rounding
+	inline half exact_asum(const half *x, std::size_t n)
+	{
+		detail::fixed_sum sum;
+		detail::accumulate_magnitudes(x, n, sum);
+		return sum.to_half<std::numeric_limits<half>::round_style>();
+	}
+
+	/// Correctly rounded Euclidean norm.
+	/// This accumulates the squares exactly and rounds only the final square root, like hypot() does for two values. So 
+	/// the result can only overflow if the norm itself is not representable.
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return norm correctly rounded to half-precision
+	/// \exception FE_INVALID for signaling NaN values
+	/// \exception FE_OVERFLOW, ...INEXACT according to rounding
+	inline half exact_nrm2(const half *x, std::size_t n)
+	{
+		detail::fixed_sum sum;
+		detail::accumulate_products(x, x, n, sum);
+		return sum.sqrt_to_half<std::numeric_limits<half>::round_style>();
+	}
+	/// \}
+
+	/// \name Array classification
+	/// \{
+
+	/// Check array for finite numbers.
+	/// This computes the same as isfinite(half) for each element, but on blocks of values with 16-bit 
+	/// [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) integer operations if available. Chunks of large arrays are checked in 
+	/// parallel if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled. The same holds for all the other classifications and 
+	/// comparisons of arrays, which are named after the scalar functions with an `_array` suffix.
+	/// \param x array of values
+	/// \param r array to store results at
+	/// \param n number of elements
+	inline void isfinite_array(const half *x, bool *r, std::size_t n) { detail::test_array<detail::isfinite_test>(x, r, n); }
+
+	/// Check array for infinities.
+	/// \param x array of values
+	/// \param r array to store results of isinf(half) at
+	/// \param n number of elements
+	inline void isinf_array(const half *x, bool *r, std::size_t n) { detail::test_array<detail::isinf_test>(x, r, n); }
+
+	/// Check array for NaNs.
+	/// \param x array of values
+	/// \param r array to store results of isnan(half) at
+	/// \param n number of elements
+	inline void isnan_array(const half *x, bool *r, std::size_t n) { detail::test_array<detail::isnan_test>(x, r, n); }
+
+	/// Check array for normal numbers.
+	/// \param x array of values
+	/// \param r array to store results of isnormal(half) at
+	/// \param n number of elements
+	inline void isnormal_array(const half *x, bool *r, std::size_t n) { detail::test_array<detail::isnormal_test>(x, r, n); }
+
+	/// Check signs of array.
+	/// \param x array of values
+	/// \param r array to store results of signbit(half) at
+	/// \param n number of elements
+	inline void signbit_array(const half *x, bool *r, std::size_t n) { detail::test_array<detail::signbit_test>(x, r, n); }
+
+	/// Classify array.
+	/// \param x array of values
+	/// \param r array to store results of fpclassify(half) at
+	/// \param n number of elements
+	inline void fpclassify_array(const half *x, int *r, std::size_t n) { detail::classify(x, r, n); }
+
+	/// Count values per class.
+	/// This classifies all values in a single pass, vectorized with 16-bit [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) 
+	/// integer operations if available and with chunks of large arrays counted in parallel if 
+	/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled. This is meant for validating data, where all_finite() only tells if 
+	/// there are any infinities or NaNs at all.
+	/// \param x array of values
+	/// \param n number of elements
+	/// \return numbers of values in each class according to fpclassify(half) and of values with signbit(half) set
+	inline class_counts count_classes(const half *x, std::size_t n)
+	{
+		class_counts counts = { 0, 0, 0, 0, 0, 0 };
+		if(sizeof(half) == sizeof(detail::uint16))
+			detail::count_classes(reinterpret_cast<const detail::uint16*>(x), n, counts);
+		else
+			for(std::size_t i=0; i<n; ++i)
+			{
+				switch(fpclassify(x[i]))
+				{
+					case FP_ZERO: ++counts.zero; break;
+					case FP_SUBNORMAL: ++counts.subnormal; break;
+					case FP_INFINITE: ++counts.infinite; break;
+					case FP_NAN: ++counts.nan; break;
+				}
+				counts.negative += signbit(x[i]);
+			}
+		counts.normal = n - counts.zero - counts.subnormal - counts.infinite - counts.nan;
+		return counts;
+	}
+
+	/// Quiet comparison of arrays for greater than.
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param r array to store results of isgreater(half,half) at
+	/// \param n number of elements
+	inline void isgreater_array(const half *x, const half *y, bool *r, std::size_t n) { detail::compare_array<detail::isgreater_test>(x, y, 1, r, n); }
+
+	/// Quiet comparison of array and scalar for greater than.
+	/// Comparisons of scalar and array are covered by the mirrored comparison, in this case isless().
+	/// \param x array of first operands
+	/// \param y second operand
+	/// \param r array to store results of isgreater(half,half) at
+	/// \param n number of elements
+	inline void isgreater_array(const half *x, half y, bool *r, std::size_t n) { detail::compare_array<detail::isgreater_test>(x, &y, 0, r, n); }
+
+	/// Quiet comparison of arrays for greater equal.
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param r array to store results of isgreaterequal(half,half) at
+	/// \param n number of elements
+	inline void isgreaterequal_array(const half *x, const half *y, bool *r, std::size_t n) { detail::compare_array<detail::isgreaterequal_test>(x, y, 1, r, n); }
+
+	/// Quiet comparison of array and scalar for greater equal.
+	/// \param x array of first operands
+	/// \param y second operand
+	/// \param r array to store results of isgreaterequal(half,half) at
+	/// \param n number of elements
+	inline void isgreaterequal_array(const half *x, half y, bool *r, std::size_t n) { detail::compare_array<detail::isgreaterequal_test>(x, &y, 0, r, n); }
+
+	/// Quiet comparison of arrays for less than.
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param r array to store results of isless(half,half) at
+	/// \param n number of elements
+	inline void isless_array(const half *x, const half *y, bool *r, std::size_t n) { detail::compare_array<detail::isless_test>(x, y, 1, r, n); }
+
+	/// Quiet comparison of array and scalar for less than.
+	/// \param x array of first operands
+	/// \param y second operand
+	/// \param r array to store results of isless(half,half) at
+	/// \param n number of elements
+	inline void isless_array(const half *x, half y, bool *r, std::size_t n) { detail::compare_array<detail::isless_test>(x, &y, 0, r, n); }
+
+	/// Quiet comparison of arrays for less equal.
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param r array to store results of islessequal(half,half) at
+	/// \param n number of elements
+	inline void islessequal_array(const half *x, const half *y, bool *r, std::size_t n) { detail::compare_array<detail::islessequal_test>(x, y, 1, r, n); }
+
+	/// Quiet comparison of array and scalar for less equal.
+	/// \param x array of first operands
+	/// \param y second operand
+	/// \param r array to store results of islessequal(half,half) at
+	/// \param n number of elements
+	inline void islessequal_array(const half *x, half y, bool *r, std::size_t n) { detail::compare_array<detail::islessequal_test>(x, &y, 0, r, n); }
+
+	/// Quiet comparison of arrays for less or greater.
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param r array to store results of islessgreater(half,half) at
+	/// \param n number of elements
+	inline void islessgreater_array(const half *x, const half *y, bool *r, std::size_t n) { detail::compare_array<detail::islessgreater_test>(x, y, 1, r, n); }
+
+	/// Quiet comparison of array and scalar for less or greater.
+	/// \param x array of first operands
+	/// \param y second operand
+	/// \param r array to store results of islessgreater(half,half) at
+	/// \param n number of elements
+	inline void islessgreater_array(const half *x, half y, bool *r, std::size_t n) { detail::compare_array<detail::islessgreater_test>(x, &y, 0, r, n); }
+
+	/// Quiet check of arrays for unordered values.
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param r array to store results of isunordered(half,half) at
+	/// \param n number of elements
+	inline void isunordered_array(const half *x, const half *y, bool *r, std::size_t n) { detail::compare_array<detail::isunordered_test>(x, y, 1, r, n); }
+
+	/// Quiet check of array and scalar for unordered values.
+	/// \param x array of first operands
+	/// \param y second operand
+	/// \param r array to store results of isunordered(half,half) at
+	/// \param n number of elements
+	inline void isunordered_array(const half *x, half y, bool *r, std::size_t n) { detail::compare_array<detail::isunordered_test>(x, &y, 0, r, n); }
+	/// \}
+
+	/// \name Prefix sums
+	/// \{
+
+	/// Inclusive prefix sums with selectable accumulation.
+	/// This computes `y[i] = x[0] + ... + x[i]` for all elements. For `accumulate_float` and `accumulate_pairwise` the 
+	/// running sum is kept in single-precision and vectors of values are scanned in registers if 
+	/// [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) intrinsics are enabled, so the 
+	/// results are only rounded to half-precision when stored. For `accumulate_exact` the running sum is kept exactly in 
+	/// fixed-point and each result is correctly rounded. Large arrays are scanned in two passes over chunks of fixed size 
+	/// if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled, with results that do not depend on the number of threads. The 
+	/// arrays may be the same.
+	/// \tparam A accumulation policy
+	/// \param x array of values
+	/// \param y array to store prefix sums at
+	/// \param n number of elements
+	/// \exception FE_INVALID for signaling NaN values or infinities of different sign with `accumulate_exact`
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<accumulation A> void inclusive_scan(const half *x, half *y, std::size_t n)
+	{
+		detail::scan<true>(x, y, n, detail::bool_type<A==accumulate_exact>());
+	}
+
+	/// Inclusive prefix sums in single-precision with selectable accumulation.
+	/// This works like the half-precision version, but stores the running sums in single-precision, which for 
+	/// `accumulate_exact` are the exact sums rounded to double-precision and then to single-precision.
+	/// \tparam A accumulation policy
+	/// \param x array of values
+	/// \param y array to store prefix sums at
+	/// \param n number of elements
+	template<accumulation A> void inclusive_scan(const half *x, float *y, std::size_t n)
+	{
+		detail::scan<true>(x, y, n, detail::bool_type<A==accumulate_exact>());
+	}
+
+	/// Inclusive prefix sums.
+	/// This keeps the running sum in single-precision, like `inclusive_scan<accumulate_float>(x, y, n)`.
+	/// \param x array of values
+	/// \param y array to store prefix sums at
+	/// \param n number of elements
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void inclusive_scan(const half *x, half *y, std::size_t n) { inclusive_scan<accumulate_float>(x, y, n); }
+
+	/// Inclusive prefix sums in single-precision.
+	/// This keeps the running sum in single-precision, like `inclusive_scan<accumulate_float>(x, y, n)`.
+	/// \param x array of values
+	/// \param y array to store prefix sums at
+	/// \param n number of elements
+	inline void inclusive_scan(const half *x, float *y, std::size_t n) { inclusive_scan<accumulate_float>(x, y, n); }
+
+	/// Exclusive prefix sums with selectable accumulation.
+	/// This computes `y[i] = x[0] + ... + x[i-1]` for all elements, starting with a positive zero. The running sum is kept 
+	/// like for inclusive_scan(). The arrays may be the same.
+	/// \tparam A accumulation policy
+	/// \param x array of values
+	/// \param y array to store prefix sums at
+	/// \param n number of elements
+	/// \exception FE_INVALID for signaling NaN values or infinities of different sign with `accumulate_exact`
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<accumulation A> void exclusive_scan(const half *x, half *y, std::size_t n)
+	{
+		detail::scan<false>(x, y, n, detail::bool_type<A==accumulate_exact>());
+	}
+
+	/// Exclusive prefix sums in single-precision with selectable accumulation.
+	/// This works like the half-precision version, but stores the running sums in single-precision, which for 
+	/// `accumulate_exact` are the exact sums rounded to double-precision and then to single-precision.
+	/// \tparam A accumulation policy
+	/// \param x array of values
+	/// \param y array to store prefix sums at
+	/// \param n number of elements
+	template<accumulation A> void exclusive_scan(const half *x, float *y, std::size_t n)
+	{
+		detail::scan<false>(x, y, n, detail::bool_type<A==accumulate_exact>());
+	}
+
+	/// Exclusive prefix sums.
+	/// This keeps the running sum in single-precision, like `exclusive_scan<accumulate_float>(x, y, n)`.
+	/// \param x array of values
+	/// \param y array to store prefix sums at
+	/// \param n number of elements
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void exclusive_scan(const half *x, half *y, std::size_t n) { exclusive_scan<accumulate_float>(x, y, n); }
+
+	/// Exclusive prefix sums in single-precision.
+	/// This keeps the running sum in single-precision, like `exclusive_scan<accumulate_float>(x, y, n)`.
+	/// \param x array of values
+	/// \param y array to store prefix sums at
+	/// \param n number of elements
+	inline void exclusive_scan(const half *x, float *y, std::size_t n) { exclusive_scan<accumulate_float>(x, y, n); }
+	/// \}
+
+	/// \name Matrix operations
+	/// \{
+
+	/// General matrix multiplication.
+	/// This computes `C = alpha * op(A) * op(B) + beta * C` for an m x k matrix `op(A)` and a k x n matrix `op(B)` of 
+	/// half-precision values, with `op(X)` being either `X` or its transpose, in the manner of the BLAS `sgemm` function. The 
+	/// operands are packed into cache-sized blocks and converted to single-precision, vectorized with 
+	/// [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available, and the products 
+	/// are accumulated in single-precision in an unspecified order. Blocks of results are computed in parallel if 
+	/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled. If \a alpha is 0, the operands are not accessed and if \a beta is 0, 
+	/// the previous results are not accessed, so they do not propagate NaNs.
+	/// \param layout storage order of all matrices
+	/// \param transa whether to use transpose of \a a
+	/// \param transb whether to use transpose of \a b
+	/// \param m number of rows of `op(A)` and \a c
+	/// \param n number of columns of `op(B)` and \a c
+	/// \param k number of columns of `op(A)` and rows of `op(B)`
+	/// \param alpha factor for products
+	/// \param a first matrix
+	/// \param lda leading dimension of \a a
+	/// \param b second matrix
+	/// \param ldb leading dimension of \a b
+	/// \param beta factor for previous results
+	/// \param c matrix of single-precision results
+	/// \param ldc leading dimension of \a c
+	inline void gemm(matrix_layout layout, matrix_transpose transa, matrix_transpose transb, std::size_t m, std::size_t n, std::size_t k, 
+		float alpha, const half *a, std::size_t lda, const half *b, std::size_t ldb, float beta, float *c, std::size_t ldc)
+	{
+		bool ca = (layout==column_major) != (transa==transpose), cb = (layout==column_major) != (transb==transpose);
+		detail::gemm(m, n, k, alpha, a, ca ? 1 : lda, ca ? lda : 1, b, cb ? 1 : ldb, cb ? ldb : 1, beta, c, 
+			(layout==column_major) ? 1 : ldc, (layout==column_major) ? ldc : 1);
+	}
+
+	/// General matrix multiplication.
+	/// This computes `C = alpha * op(A) * op(B) + beta * C` like gemm() with single-precision results, but rounds the 
+	/// single-precision results to half-precision.
+	/// \param layout storage order of all matrices
+	/// \param transa whether to use transpose of \a a
+	/// \param transb whether to use transpose of \a b
+	/// \param m number of rows of `op(A)` and \a c
+	/// \param n number of columns of `op(B)` and \a c
+	/// \param k number of columns of `op(A)` and rows of `op(B)`
+	/// \param alpha factor for products
+	/// \param a first matrix
+	/// \param lda leading dimension of \a a
+	/// \param b second matrix
+	/// \param ldb leading dimension of \a b
+	/// \param beta factor for previous results
+	/// \param c matrix of half-precision results
+	/// \param ldc leading dimension of \a c
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void gemm(matrix_layout layout, matrix_transpose transa, matrix_transpose transb, std::size_t m, std::size_t n, std::size_t k, 
+		float alpha, const half *a, std::size_t lda, const half *b, std::size_t ldb, float beta, half *c, std::size_t ldc)
+	{
+		bool ca = (layout==column_major) != (transa==transpose), cb = (layout==column_major) != (transb==transpose);
+		detail::gemm(m, n, k, alpha, a, ca ? 1 : lda, ca ? lda : 1, b, cb ? 1 : ldb, cb ? ldb : 1, beta, c, 
+			(layout==column_major) ? 1 : ldc, (layout==column_major) ? ldc : 1);
+	}
+
+	/// General matrix-vector multiplication.
+	/// This computes `y = alpha * op(A) * x + beta * y` for an m x n matrix `A` of half-precision values and vectors of 
+	/// single-precision values, with `op(A)` being either `A` or its transpose, in the manner of the BLAS `sgemv` function. 
+	/// The matrix is read exactly once and converted to single-precision on the fly, vectorized with 
+	/// [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available, and the products 
+	/// are accumulated in single-precision in an unspecified order. Blocks of results are computed in parallel if 
+	/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled. If \a beta is 0, the previous results are not accessed, so they do not 
+	/// propagate NaNs.
+	/// \param layout storage order of matrix
+	/// \param trans whether to use transpose of \a a
+	/// \param m number of rows of \a a
+	/// \param n number of columns of \a a
+	/// \param alpha factor for products
+	/// \param a matrix
+	/// \param lda leading dimension of \a a
+	/// \param x vector of \a n elements, or \a m elements if transposed
+	/// \param beta factor for previous results
+	/// \param y vector of \a m results, or \a n results if transposed
+	inline void gemv(matrix_layout layout, matrix_transpose trans, std::size_t m, std::size_t n, 
+		float alpha, const half *a, std::size_t lda, const float *x, float beta, float *y)
+	{
+		if(trans == transpose)
+			std::swap(m, n);
+		detail::gemv((layout==row_major) != (trans==transpose), m, n, alpha, a, lda, x, beta, y);
+	}
+	/// \}
+
+	/// \name Neural network operations
+	/// \{
+
+	/// Softmax.
+	/// This computes `y[i] = exp(x[i]) / (exp(x[0]) + ... + exp(x[n-1]))` without overflow by subtracting the maximum 
+	/// before exponentiation. The maximum and the sum of exponentials are found in a single pass over the array, which 
+	/// rescales the sum whenever the maximum increases (i.e. online softmax). The exponentials are computed and summed in 
+	/// single-precision like by fast::exp(), vectorized with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or 
+	/// [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available, and recomputed in a second pass for the normalized results 
+	/// instead of being stored, so only the final results are rounded to half-precision. The results are NaN if any value 
+	/// is NaN or if the maximum is infinite. The arrays may be the same.
+	/// \param x array of values
+	/// \param y array to store probabilities at
+	/// \param n number of elements
+	/// \exception FE_INVALID if any value is signaling NaN
+	/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+	inline void softmax(const half *x, half *y, std::size_t n)
+	{
+		if(!n)
+			return;
+		float max, ones, sum = detail::online_exp_sum(x, n, max, ones);
+		detail::exp_scale(x, y, n, max, 1.0f/(ones+sum));
+	}
+
+	/// Row-wise softmax.
+	/// This computes softmax() for each row of a matrix, with rows distributed across threads if 
+	/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and exceptions are disabled.
+	/// \param x matrix of values with contiguous rows
+	/// \param y matrix to store probabilities at
+	/// \param m number of rows
+	/// \param n number of elements per row
+	/// \exception FE_INVALID if any value is signaling NaN
+	/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+	inline void softmax(const half *x, half *y, std::size_t m, std::size_t n)
+	{
+	#if HALF_ENABLE_OPENMP && !HALF_ERRHANDLING
+		#pragma omp parallel for schedule(static) if(m > 1 && m*n >= 65536)
+	#endif
+		for(long i=0; i<static_cast<long>(m); ++i)
+			softmax(x+i*n, y+i*n, n);
+	}
+
+	/// Logarithm of softmax.
+	/// This computes `y[i] = x[i] - log(exp(x[0]) + ... + exp(x[n-1]))` with the sum computed like for softmax(), which 
+	/// is more accurate than taking the logarithm of softmax() and does not underflow for small probabilities. The 
+	/// exponentials of all values but the maximum are summed separately from the latter's, so the logarithm is accurate 
+	/// even when the maximum dominates the sum. The results are NaN if any value is NaN or if the maximum is infinite. The 
+	/// arrays may be the same.
+	/// \param x array of values
+	/// \param y array to store logarithms of probabilities at
+	/// \param n number of elements
+	/// \exception FE_INVALID if any value is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void log_softmax(const half *x, half *y, std::size_t n)
+	{
+		if(!n)
+			return;
+		float max, ones, sum = detail::online_exp_sum(x, n, max, ones);
+		detail::subtract(x, y, n, max, static_cast<float>(std::log(1.0+static_cast<double>((ones-1.0f)+sum))));
+	}
+
+	/// Row-wise logarithm of softmax.
+	/// This computes log_softmax() for each row of a matrix, with rows distributed across threads if 
+	/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and exceptions are disabled.
+	/// \param x matrix of values with contiguous rows
+	/// \param y matrix to store logarithms of probabilities at
+	/// \param m number of rows
+	/// \param n number of elements per row
+	/// \exception FE_INVALID if any value is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void log_softmax(const half *x, half *y, std::size_t m, std::size_t n)
+	{
+	#if HALF_ENABLE_OPENMP && !HALF_ERRHANDLING
+		#pragma omp parallel for schedule(static) if(m > 1 && m*n >= 65536)
+	#endif
+		for(long i=0; i<static_cast<long>(m); ++i)
+			log_softmax(x+i*n, y+i*n, n);
+	}
+
+	/// Layer normalization.
+	/// This computes `y[i] = (x[i]-mean) / sqrt(var+eps) * gamma[i] + beta[i]` for each row of a matrix, with the mean 
+	/// and biased variance of the row. These are computed in separate passes over the row in single-precision, vectorized 
+	/// with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available, which 
+	/// avoids the cancellation of computing the variance from the mean of squares. A third pass over the row, which is in 
+	/// cache by then, normalizes, scales and shifts the values in single-precision and only rounds the final results to 
+	/// half-precision. Rows are distributed across threads if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and exceptions 
+	/// are disabled. The matrices may be the same.
+	/// \param x matrix of values with contiguous rows
+	/// \param gamma array of \a n factors, or null pointer to not scale
+	/// \param beta array of \a n offsets, or null pointer to not shift
+	/// \param y matrix to store results at
+	/// \param m number of rows
+	/// \param n number of elements per row
+	/// \param eps value to add to variance
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void layer_norm(const half *x, const half *gamma, const half *beta, half *y, std::size_t m, std::size_t n, float eps)
+	{
+		if(!n)
+			return;
+	#if HALF_ENABLE_OPENMP && !HALF_ERRHANDLING
+		#pragma omp parallel for schedule(static) if(m > 1 && m*n >= 65536)
+	#endif
+		for(long i=0; i<static_cast<long>(m); ++i)
+		{
+			const half *xi = x + i*n;
+			float mean = detail::float_sum<false>(xi, n) / static_cast<float>(n);
+			detail::normalize_row(xi, gamma, beta, y+i*n, n, mean, 1.0f/std::sqrt(detail::centered_squares(xi, n, mean)/static_cast<float>(n)+eps));
+		}
+	}
+
+	/// Root mean square normalization.
+	/// This computes `y[i] = x[i] / sqrt(mean(x^2)+eps) * gamma[i]` for each row of a matrix. The mean of squares, which 
+	/// are exact in single-precision, is accumulated like by dot() and the values are then scaled in a second pass over the 
+	/// row, which is in cache by then, only rounding the final results to half-precision. Rows are distributed across 
+	/// threads if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and exceptions are disabled. The matrices may be the same.
+	/// \param x matrix of values with contiguous rows
+	/// \param gamma array of \a n factors, or null pointer to not scale
+	/// \param y matrix to store results at
+	/// \param m number of rows
+	/// \param n number of elements per row
+	/// \param eps value to add to mean of squares
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void rms_norm(const half *x, const half *gamma, half *y, std::size_t m, std::size_t n, float eps)
+	{
+		if(!n)
+			return;
+	#if HALF_ENABLE_OPENMP && !HALF_ERRHANDLING
+		#pragma omp parallel for schedule(static) if(m > 1 && m*n >= 65536)
+	#endif
+		for(long i=0; i<static_cast<long>(m); ++i)
+		{
+			const half *xi = x + i*n;
+			float scale = 1.0f / std::sqrt(detail::dot(xi, xi, n, detail::false_type())/static_cast<float>(n)+eps);
+			detail::normalize_row(xi, gamma, static_cast<const half*>(0), y+i*n, n, 0.0f, scale);
+		}
+	}
+
+	/// Scaled dot-product attention.
+	/// This computes `o = softmax(scale * q * k^T) * v` for each head without materializing the matrix of scores. Each block 
+	/// of queries is converted to single-precision once and then streamed over tiles of keys and values, keeping a running 
+	/// maximum, sum and weighted sum of values for each query that are rescaled whenever a tile raises the maximum (i.e. 
+	/// online softmax), so only a tile of scores is held at any time. The scores, exponentials and weighted sums are 
+	/// computed in single-precision like by softmax(), vectorized with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or 
+	/// [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available, and only the final results are rounded to half-precision. With 
+	/// causal masking, query `i` only attends to keys up to `i+n-m`, aligning the last query with the last key. Queries 
+	/// without any keys to attend to have NaN results. Blocks of queries of all heads are distributed across threads if 
+	/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and exceptions are disabled. The results must not overlap the inputs.
+	/// \param heads number of heads
+	/// \param m number of queries per head
+	/// \param n number of keys and values per head
+	/// \param d number of elements per query, key, value and result
+	/// \param q \a heads matrices of \a m x \a d queries in row-major order
+	/// \param k \a heads matrices of \a n x \a d keys in row-major order
+	/// \param v \a heads matrices of \a n x \a d values in row-major order
+	/// \param o \a heads matrices of \a m x \a d results in row-major order
+	/// \param scale factor for dot products of queries and keys, usually `1/sqrt(d)`
+	/// \param causal `true` to mask keys after the position of each query, `false` to attend to all keys
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void attention(std::size_t heads, std::size_t m, std::size_t n, std::size_t d, const half *q, const half *k, const half *v, 
+		half *o, float scale, bool causal)
+	{
+		detail::attention(heads, m, n, d, q, k, v, o, scale, causal);
+	}
+
+	/// Size of convolution results.
+	/// \param padding padding of input
+	/// \param n number of input values along dimension
+	/// \param k number of kernel values along dimension
+	/// \param stride distance between consecutive kernel positions, at least 1
+	/// \param dilation distance between consecutive kernel taps, at least 1
+	/// \return number of results along dimension
+	inline std::size_t convolution_size(convolution_padding padding, std::size_t n, std::size_t k, std::size_t stride, std::size_t dilation)
+	{
+		std::size_t span = (k-1)*dilation + 1;
+		if(padding == same_padding)
+			return (n+stride-1) / stride;
+		return (n>=span) ? ((n-span)/stride+1) : 0;
+	}
+
+	/// Multi-channel 1D convolution.
+	/// This computes `y[o][i] = b[o] + sum(f[o][c][k] * x[c][i*stride+k*dilation-pad])` for each output channel `o` in the 
+	/// manner of a convolutional network layer (i.e. without flipping the kernel), where values outside the input are 0. 
+	/// Each block of consecutive results is kept in registers while the products of all kernel taps are accumulated 
+	/// in single-precision, vectorized with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or 
+	/// [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available, with the inputs converted to single-precision once per block 
+	/// and only the final results rounded to half-precision. Blocks of results are computed in parallel if 
+	/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and exceptions are disabled. The input and output must not overlap.
+	/// \param padding padding of input
+	/// \param ci number of input channels
+	/// \param co number of output channels
+	/// \param n number of values per input channel
+	/// \param k number of kernel taps
+	/// \param stride distance between consecutive kernel positions, at least 1
+	/// \param dilation distance between consecutive kernel taps, at least 1
+	/// \param x \a ci input channels of \a n values each
+	/// \param f \a co kernels of \a ci x \a k values each
+	/// \param b array of \a co offsets, or null pointer to not shift
+	/// \param y \a co output channels of `convolution_size(padding, n, k, stride, dilation)` values each
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void conv1d(convolution_padding padding, std::size_t ci, std::size_t co, std::size_t n, std::size_t k, 
+		std::size_t stride, std::size_t dilation, const half *x, const half *f, const half *b, half *y)
+	{
+		std::size_t m = convolution_size(padding, n, k, stride, dilation), span = (k-1)*dilation + 1;
+		std::size_t pad = (padding==same_padding && m && (m-1)*stride+span > n) ? (((m-1)*stride+span-n)/2) : 0;
+		detail::convolve(ci, co, 1, n, 1, k, 1, stride, 1, dilation, 0, pad, 1, m, x, f, b, y);
+	}
+
+	/// Multi-channel 2D convolution.
+	/// This computes `y[o][i][j] = b[o] + sum(f[o][c][k][l] * x[c][i*sy+k*dy-pady][j*sx+l*dx-padx])` for each output 
+	/// channel `o` like conv1d() does for each row, where values outside the input are 0. Blocks of results are distributed 
+	/// across threads by output rows and channels if [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and exceptions are 
+	/// disabled. The input and output must not overlap.
+	/// \param padding padding of input
+	/// \param ci number of input channels
+	/// \param co number of output channels
+	/// \param h number of rows per input channel
+	/// \param w number of columns per input channel
+	/// \param kh number of kernel rows
+	/// \param kw number of kernel columns
+	/// \param sy vertical distance between consecutive kernel positions, at least 1
+	/// \param sx horizontal distance between consecutive kernel positions, at least 1
+	/// \param dy vertical distance between consecutive kernel taps, at least 1
+	/// \param dx horizontal distance between consecutive kernel taps, at least 1
+	/// \param x \a ci input channels of \a h x \a w values each in row-major order
+	/// \param f \a co kernels of \a ci x \a kh x \a kw values each
+	/// \param b array of \a co offsets, or null pointer to not shift
+	/// \param y \a co output channels of `convolution_size(padding, h, kh, sy, dy)` x `convolution_size(padding, w, kw, sx, dx)` 
+	/// values each in row-major order
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void conv2d(convolution_padding padding, std::size_t ci, std::size_t co, std::size_t h, std::size_t w, std::size_t kh, 
+		std::size_t kw, std::size_t sy, std::size_t sx, std::size_t dy, std::size_t dx, const half *x, const half *f, const half *b, half *y)
+	{
+		std::size_t ho = convolution_size(padding, h, kh, sy, dy), wo = convolution_size(padding, w, kw, sx, dx);
+		std::size_t sh = (kh-1)*dy + 1, sw = (kw-1)*dx + 1;
+		std::size_t py = (padding==same_padding && ho && (ho-1)*sy+sh > h) ? (((ho-1)*sy+sh-h)/2) : 0;
+		std::size_t px = (padding==same_padding && wo && (wo-1)*sx+sw > w) ? (((wo-1)*sx+sw-w)/2) : 0;
+		detail::convolve(ci, co, h, w, kh, kw, sy, sx, dy, dx, py, px, ho, wo, x, f, b, y);
+	}
+
+	/// Rectified linear unit for array.
+	/// This computes relu() for each element, 8 at once with [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available. The 
+	/// arrays may be the same.
+	/// \param x array of values
+	/// \param y array to store results at
+	/// \param n number of elements
+	/// \exception FE_INVALID for signaling NaNs
+	inline void relu_array(const half *x, half *y, std::size_t n) { detail::rectify(x, y, n); }
+
+	/// Logistic sigmoid for array.
+	/// This computes sigmoid() for each element with the same correctly rounded results. The exponentials are 
+	/// approximated in single-precision, vectorized with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or 
+	/// [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available, and the few results too close to a rounding boundary to be 
+	/// rounded directly are recomputed exactly. The arrays may be the same.
+	/// \param x array of values
+	/// \param y array to store results at
+	/// \param n number of elements
+	/// \exception FE_INVALID for signaling NaNs
+	/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+	inline void sigmoid_array(const half *x, half *y, std::size_t n) { detail::activation<detail::sigmoid_op>(x, y, n); }
+
+	/// Sigmoid linear unit for array.
+	/// This computes silu() for each element with the same correctly rounded results, approximated like by the sigmoid 
+	/// for arrays. The arrays may be the same.
+	/// \param x array of values
+	/// \param y array to store results at
+	/// \param n number of elements
+	/// \exception FE_INVALID for signaling NaNs
+	/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+	inline void silu_array(const half *x, half *y, std::size_t n) { detail::activation<detail::silu_op>(x, y, n); }
+
+	/// Gaussian error linear unit for array.
+	/// This computes gelu() for each element with the same correctly rounded results. The normal distribution function 
+	/// is approximated in single-precision for values smaller than 6 in magnitude, vectorized with 
+	/// [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available, and all other 
+	/// results as well as those too close to a rounding boundary are computed exactly. The arrays may be the same.
+	/// \param x array of values
+	/// \param y array to store results at
+	/// \param n number of elements
+	/// \exception FE_INVALID for signaling NaNs
+	/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+	inline void gelu_array(const half *x, half *y, std::size_t n) { detail::activation<detail::gelu_op>(x, y, n); }
+
+	/// Stochastic gradient descent step for mixed-precision training.
+	/// This computes `w -= lr * (g + decay*w)` for single-precision master weights and rounds the updated weights to their 
+	/// half-precision copies in the same pass, vectorized with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or 
+	/// [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available. Chunks of large arrays are updated in parallel if 
+	/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and exceptions are disabled. Stochastic rounding only depends on the 
+	/// seed and the index of each weight, so the seed should change with every step.
+	/// \param lr learning rate
+	/// \param decay weight decay
+	/// \param g array of gradients
+	/// \param w array of master weights to update
+	/// \param h array to store rounded weights at
+	/// \param n number of weights
+	/// \param rounding rounding of weights
+	/// \param seed seed for stochastic rounding
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void sgd_step(float lr, float decay, const half *g, float *w, half *h, std::size_t n, 
+		weight_rounding rounding = nearest_rounding, unsigned long seed = 0)
+	{
+		detail::sgd_kernel kernel = { g, w, lr, decay };
+		detail::optimize(kernel, detail::weight_rounder(rounding==stochastic_rounding, seed), h, 0, n);
+	}
+
+	/// Momentum step for mixed-precision training.
+	/// This computes `d = g + decay*w` and `v = momentum*v + d` and then `w -= lr * v`, or `w -= lr * (d + momentum*v)` 
+	/// for Nesterov momentum, for single-precision master weights and velocities and rounds the updated weights to their 
+	/// half-precision copies in the same pass like sgd_step() does.
+	/// \param lr learning rate
+	/// \param momentum momentum factor
+	/// \param decay weight decay
+	/// \param nesterov `true` for Nesterov momentum
+	/// \param g array of gradients
+	/// \param w array of master weights to update
+	/// \param v array of velocities to update, initially 0
+	/// \param h array to store rounded weights at
+	/// \param n number of weights
+	/// \param rounding rounding of weights
+	/// \param seed seed for stochastic rounding
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void momentum_step(float lr, float momentum, float decay, bool nesterov, const half *g, float *w, float *v, half *h, 
+		std::size_t n, weight_rounding rounding = nearest_rounding, unsigned long seed = 0)
+	{
+		detail::momentum_kernel kernel = { g, w, v, lr, momentum, decay, nesterov };
+		detail::optimize(kernel, detail::weight_rounder(rounding==stochastic_rounding, seed), h, 0, n);
+	}
+
+	/// Adam step for mixed-precision training.
+	/// This computes `m = beta1*m + (1-beta1)*g` and `v = beta2*v + (1-beta2)*g^2` and then 
+	/// `w = (1-lr*decay)*w - lr/(1-beta1^t) * m / (sqrt(v/(1-beta2^t)) + eps)` with decoupled weight decay (AdamW) for 
+	/// single-precision master weights and moments and rounds the updated weights to their half-precision copies in the 
+	/// same pass like sgd_step() does. The bias corrections are computed once in double-precision.
+	/// \param lr learning rate
+	/// \param beta1 decay rate of first moments
+	/// \param beta2 decay rate of second moments
+	/// \param eps term added to denominator
+	/// \param decay weight decay
+	/// \param t number of this step, starting at 1
+	/// \param g array of gradients
+	/// \param w array of master weights to update
+	/// \param m array of first moments to update, initially 0
+	/// \param v array of second moments to update, initially 0
+	/// \param h array to store rounded weights at
+	/// \param n number of weights
+	/// \param rounding rounding of weights
+	/// \param seed seed for stochastic rounding
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void adam_step(float lr, float beta1, float beta2, float eps, float decay, unsigned long t, const half *g, float *w, 
+		float *m, float *v, half *h, std::size_t n, weight_rounding rounding = nearest_rounding, unsigned long seed = 0)
+	{
+		double c1 = 1.0 - std::pow(static_cast<double>(beta1), static_cast<double>(t));
+		double c2 = 1.0 - std::pow(static_cast<double>(beta2), static_cast<double>(t));
+		detail::adam_kernel kernel = { g, w, m, v, beta1, beta2, 1.0f-beta1, 1.0f-beta2, 
+			static_cast<float>(1.0-static_cast<double>(lr)*decay), static_cast<float>(lr/c1), static_cast<float>(1.0/std::sqrt(c2)), eps };
+		detail::optimize(kernel, detail::weight_rounder(rounding==stochastic_rounding, seed), h, 0, n);
+	}
+
+	/// Check array for infinities and NaNs.
+	/// This computes the same as applying isfinite() to all elements, but directly on the bit representations of blocks 
+	/// of values with 16-bit [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) integer operations if available, stopping at the 
+	/// first block with a non-finite value. Chunks of large arrays are checked in parallel if 
+	/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled. This is meant for checking gradients for overflows when training 
+	/// with a dynamic loss scale.
+	/// \param x array of values
+	/// \param n number of elements
+	/// \retval true if all values are finite or \a n is 0
+	/// \retval false if any value is infinite or NaN
+	inline bool all_finite(const half *x, std::size_t n)
+	{
+		if(sizeof(half) == sizeof(detail::uint16))
+			return detail::all_finite(reinterpret_cast<const detail::uint16*>(x), n);
+		for(std::size_t i=0; i<n; ++i)
+			if(!isfinite(x[i]))
+				return false;
+		return true;
+	}
+
+	/// Unscaling with check for infinities and NaNs.
+	/// This computes `y = half(scale * x)` for each element in single-precision and checks the rounded results for 
+	/// infinities and NaNs in the same pass, vectorized with [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) or 
+	/// [SSE2](\ref HALF_ENABLE_SSE2_INTRINSICS) if available. Chunks of large arrays are processed in parallel if 
+	/// [OpenMP](\ref HALF_ENABLE_OPENMP) is enabled and exceptions are disabled. When training with a dynamic loss scale, 
+	/// this unscales the gradients with the reciprocal of the loss scale and reports whether the step has to be skipped 
+	/// with a smaller loss scale. For scales that are powers of two the results are exact unless they underflow. The 
+	/// arrays may be the same.
+	/// \param scale factor for values, usually the reciprocal of the loss scale
+	/// \param x array of values
+	/// \param y array to store results at
+	/// \param n number of elements
+	/// \retval true if all results are finite or \a n is 0
+	/// \retval false if any result is infinite or NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline bool unscale_and_check(float scale, const half *x, half *y, std::size_t n) { return detail::unscale(scale, x, y, n); }
+	/// \}
+
+	/// Fast approximations of mathematical functions.
+	/// This namespace contains faster but less accurate versions of the mathematical functions, which compute their results 
+	/// in single-precision using short polynomial approximations and only round the final result to half-precision. Unless noted 
+	/// otherwise, each function is at most 1 ULP off the correctly rounded result, as measured exhaustively over all 
+	/// half-precision arguments when rounding to nearest. Exceptions are only raised according to the rounding of the final 
+	/// result and for signaling NaNs passed to pow() or hypot(), domain and pole errors are not signaled.
+	///
+	/// Since these functions take the same arguments as the corresponding functions in the half_float namespace, they should 
+	/// always be called with explicit qualification (e.g. `half_float::fast::exp(x)`) in order to not be ambiguous.
+	namespace fast
+	{
+		/// \name Exponential functions
+		/// \{
+
+		/// Fast exponential function.
+		///
+		/// **See also:** Documentation for [std::exp](https://en.cppreference.com/w/cpp/numeric/math/exp).
+		/// \param arg function argument
+		/// \return e raised to \a arg
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline half exp(half arg) { return half(detail::fast_exp2(1.44269504f*static_cast<float>(arg))); }
+
+		/// Fast binary exponential.
+		///
+		/// **See also:** Documentation for [std::exp2](https://en.cppreference.com/w/cpp/numeric/math/exp2).
+		/// \param arg function argument
+		/// \return 2 raised to \a arg
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline half exp2(half arg) { return half(detail::fast_exp2(static_cast<float>(arg))); }
+
+		/// Fast exponential minus one.
+		///
+		/// **See also:** Documentation for [std::expm1](https://en.cppreference.com/w/cpp/numeric/math/expm1).
+		/// \param arg function argument
+		/// \return e raised to \a arg and subtracted by 1
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline half expm1(half arg) { return half(detail::fast_expm1(static_cast<float>(arg))); }
+
+		/// Fast natural logarithm.
+		///
+		/// **See also:** Documentation for [std::log](https://en.cppreference.com/w/cpp/numeric/math/log).
+		/// \param arg function argument
+		/// \return logarithm of \a arg to base e
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline half log(half arg) { return half(detail::fast_log(static_cast<float>(arg))); }
+
+		/// Fast common logarithm.
+		///
+		/// **See also:** Documentation for [std::log10](https://en.cppreference.com/w/cpp/numeric/math/log10).
+		/// \param arg function argument
+		/// \return logarithm of \a arg to base 10
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline half log10(half arg) { return half(detail::fast_log2(static_cast<float>(arg))*0.301029996f); }
+
+		/// Fast binary logarithm.
+		/// This function has been found to be exact to rounding for all arguments.
+		///
+		/// **See also:** Documentation for [std::log2](https://en.cppreference.com/w/cpp/numeric/math/log2).
+		/// \param arg function argument
+		/// \return logarithm of \a arg to base 2
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline half log2(half arg) { return half(detail::fast_log2(static_cast<float>(arg))); }
+
+		/// Fast natural logarithm plus one.
+		///
+		/// **See also:** Documentation for [std::log1p](https://en.cppreference.com/w/cpp/numeric/math/log1p).
+		/// \param arg function argument
+		/// \return logarithm of \a arg plus 1 to base e
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline half log1p(half arg) { return half(detail::fast_log1p(static_cast<float>(arg))); }
+
+		/// \}
+		/// \name Power functions
+		/// \{
+
+		/// Fast square root.
+		/// This function has been found to be exact to rounding for all arguments.
+		///
+		/// **See also:** Documentation for [std::sqrt](https://en.cppreference.com/w/cpp/numeric/math/sqrt).
+		/// \param arg function argument
+		/// \return square root of \a arg
+		/// \exception FE_INEXACT according to rounding
+		inline half sqrt(half arg) { return half(std::sqrt(static_cast<float>(arg))); }
+
+		/// Fast inverse square root.
+		/// This function has been found to be exact to rounding for all arguments.
+		/// \param arg function argument
+		/// \return reciprocal of square root of \a arg
+		/// \exception FE_INEXACT according to rounding
+		inline half rsqrt(half arg) { return half(1.0f/std::sqrt(static_cast<float>(arg))); }
+
+		/// Fast cubic root.
+		///
+		/// **See also:** Documentation for [std::cbrt](https://en.cppreference.com/w/cpp/numeric/math/cbrt).
+		/// \param arg function argument
+		/// \return cubic root of \a arg
+		/// \exception FE_INEXACT according to rounding
+		inline half cbrt(half arg) { return half(detail::fast_cbrt(static_cast<float>(arg))); }
+
+		/// Fast power function.
+		/// NaN arguments are passed on to half_float::pow(), so signaling NaNs are handled the same.
+		///
+		/// **See also:** Documentation for [std::pow](https://en.cppreference.com/w/cpp/numeric/math/pow).
+		/// \param x base
+		/// \param y exponent
+		/// \return \a x raised to \a y
+		/// \exception FE_INVALID for signaling NaN
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline half pow(half x, half y)
+		{
+			if(isnan(x) || isnan(y))
+				return half_float::pow(x, y);
+			return half(detail::fast_pow(static_cast<float>(x), static_cast<float>(y)));
+		}
+
+		/// Fast hypotenuse function.
+		/// NaN arguments are passed on to half_float::hypot(), so signaling NaNs are handled the same.
+		///
+		/// **See also:** Documentation for [std::hypot](https://en.cppreference.com/w/cpp/numeric/math/hypot).
+		/// \param x first argument
+		/// \param y second argument
+		/// \return square root of sum of squares without internal over- or underflows
+		/// \exception FE_INVALID for signaling NaN
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline half hypot(half x, half y)
+		{
+			if(isnan(x) || isnan(y))
+				return half_float::hypot(x, y);
+			float fx = std::abs(static_cast<float>(x)), fy = std::abs(static_cast<float>(y));
+			if(fx == std::numeric_limits<float>::infinity() || fy == std::numeric_limits<float>::infinity())
+				return half(std::numeric_limits<float>::infinity());
+			return half(std::sqrt(fx*fx+fy*fy));
+		}
+
+		/// \}
+		/// \name Trigonometric functions
+		/// \{
+
+		/// Fast sine and cosine.
+		/// \param arg function argument
+		/// \param sin variable to take sine of \a arg
+		/// \param cos variable to take cosine of \a arg
+		/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+		inline void sincos(half arg, half *sin, half *cos)
+		{
+			std::pair<float,float> sc = detail::fast_sincos(static_cast<float>(arg));
+			*sin = half(sc.first);
+			*cos = half(sc.second);
+		}
+
+		/// Fast sine function.
+		///
+		/// **See also:** Documentation for [std::sin](https://en.cppreference.com/w/cpp/numeric/math/sin).
+		/// \param arg function argument
+		/// \return sine value of \a arg
+		/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+		inline half sin(half arg) { return half(detail::fast_sincos(static_cast<float>(arg)).first); }
+
+		/// Fast cosine function.
+		///
+		/// **See also:** Documentation for [std::cos](https://en.cppreference.com/w/cpp/numeric/math/cos).
+		/// \param arg function argument
+		/// \return cosine value of \a arg
+		/// \exception FE_INEXACT according to rounding
+		inline half cos(half arg) { return half(detail::fast_sincos(static_cast<float>(arg)).second); }
+
+		/// Fast tangent function.
+		///
+		/// **See also:** Documentation for [std::tan](https://en.cppreference.com/w/cpp/numeric/math/tan).
+		/// \param arg function argument
+		/// \return tangent value of \a arg
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline half tan(half arg)
+		{
+			std::pair<float,float> sc = detail::fast_sincos(static_cast<float>(arg));
+			return half(sc.first/sc.second);
+		}
+
+		/// Fast arc sine.
+		///
+		/// **See also:** Documentation for [std::asin](https://en.cppreference.com/w/cpp/numeric/math/asin).
+		/// \param arg function argument
+		/// \return arc sine value of \a arg
+		/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+		inline half asin(half arg)
+		{
+			float f = static_cast<float>(arg);
+			return half(detail::fast_atan2(f, std::sqrt(1.0f-f*f)));
+		}
+
+		/// Fast arc cosine function.
+		///
+		/// **See also:** Documentation for [std::acos](https://en.cppreference.com/w/cpp/numeric/math/acos).
+		/// \param arg function argument
+		/// \return arc cosine value of \a arg
+		/// \exception FE_INEXACT according to rounding
+		inline half acos(half arg)
+		{
+			float f = static_cast<float>(arg);
+			return half(detail::fast_atan2(std::sqrt(1.0f-f*f), f));
+		}
+
+		/// Fast arc tangent function.
+		///
+		/// **See also:** Documentation for [std::atan](https://en.cppreference.com/w/cpp/numeric/math/atan).
+		/// \param arg function argument
+		/// \return arc tangent value of \a arg
+		/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+		inline half atan(half arg) { return half(detail::fast_atan(static_cast<float>(arg))); }
+
+		/// Fast arc tangent function.
+		///
+		/// **See also:** Documentation for [std::atan2](https://en.cppreference.com/w/cpp/numeric/math/atan2).
+		/// \param y numerator
+		/// \param x denominator
+		/// \return arc tangent value
+		/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+		inline half atan2(half y, half x) { return half(detail::fast_atan2(static_cast<float>(y), static_cast<float>(x))); }
+
+		/// \}
+		/// \name Hyperbolic functions
+		/// \{
+
+		/// Fast hyperbolic sine.
+		///
+		/// **See also:** Documentation for [std::sinh](https://en.cppreference.com/w/cpp/numeric/math/sinh).
+		/// \param arg function argument
+		/// \return hyperbolic sine value of \a arg
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline half sinh(half arg)
+		{
+			float f = static_cast<float>(arg), a = std::abs(f), e;
+			if(a >= 16.0f)
+				return half(f*1.84467441e19f);
+			e = detail::fast_expm1(a);
+			e = 0.5f * (e+e/(e+1.0f));
+			return half((f<0.0f) ? -e : e);
+		}
+
+		/// Fast hyperbolic cosine.
+		///
+		/// **See also:** Documentation for [std::cosh](https://en.cppreference.com/w/cpp/numeric/math/cosh).
+		/// \param arg function argument
+		/// \return hyperbolic cosine value of \a arg
+		/// \exception FE_OVERFLOW, ...INEXACT according to rounding
+		inline half cosh(half arg)
+		{
+			float e = detail::fast_exp2(1.44269504f*std::abs(static_cast<float>(arg)));
+			return half(0.5f*(e+1.0f/e));
+		}
+
+		/// Fast hyperbolic tangent.
+		///
+		/// **See also:** Documentation for [std::tanh](https://en.cppreference.com/w/cpp/numeric/math/tanh).
+		/// \param arg function argument
+		/// \return hyperbolic tangent value of \a arg
+		/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+		inline half tanh(half arg)
+		{
+			float f = static_cast<float>(arg), a = std::abs(f), e;
+			if(a >= 16.0f)
+				e = 0.99999994f;
+			else
+			{
+				e = detail::fast_expm1(2.0f*a);
+				e /= e + 2.0f;
+			}
+			return half((f<0.0f) ? -e : e);
+		}
+
+		/// Fast hyperbolic area sine.
+		///
+		/// **See also:** Documentation for [std::asinh](https://en.cppreference.com/w/cpp/numeric/math/asinh).
+		/// \param arg function argument
+		/// \return area sine value of \a arg
+		/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+		inline half asinh(half arg)
+		{
+			float f = static_cast<float>(arg), a = std::abs(f);
+			if(a == std::numeric_limits<float>::infinity())
+				return arg;
+			a = detail::fast_log1p(a+a*a/(1.0f+std::sqrt(1.0f+a*a)));
+			return half((f<0.0f) ? -a : a);
+		}
+
+		/// Fast hyperbolic area cosine.
+		///
+		/// **See also:** Documentation for [std::acosh](https://en.cppreference.com/w/cpp/numeric/math/acosh).
+		/// \param arg function argument
+		/// \return area cosine value of \a arg
+		/// \exception FE_INEXACT according to rounding
+		inline half acosh(half arg)
+		{
+			float f = static_cast<float>(arg) - 1.0f;
+			return half((f<0.0f) ? std::numeric_limits<float>::quiet_NaN() : detail::fast_log1p(f+std::sqrt(f*(f+2.0f))));
+		}
+
+		/// Fast hyperbolic area tangent.
+		/// This function has been found to be exact to rounding for all arguments.
+		///
+		/// **See also:** Documentation for [std::atanh](https://en.cppreference.com/w/cpp/numeric/math/atanh).
+		/// \param arg function argument
+		/// \return area tangent value of \a arg
+		/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+		inline half atanh(half arg)
+		{
+			float f = static_cast<float>(arg), a = std::abs(f);
+			a = 0.5f * detail::fast_log1p(2.0f*a/(1.0f-a));
+			return half((f<0.0f) ? -a : a);
+		}
+
+		/// \}
+		/// \name Error and gamma functions
+		/// \{
+
+		/// Fast error function.
+		///
+		/// **See also:** Documentation for [std::erf](https://en.cppreference.com/w/cpp/numeric/math/erf).
+		/// \param arg function argument
+		/// \return error function value of \a arg
+		/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+		inline half erf(half arg)
+		{
+			float f = static_cast<float>(arg), z = f * f;
+			if(z < 0.25f)
+				return half(f*(1.12837917f+z*(-0.376126389f+z*(0.112837917f+z*(-2.68661706e-2f+z*5.22397762e-3f)))));
+			z = 1.0f - detail::fast_erfc(std::abs(f));
+			return half((f<0.0f) ? -z : z);
+		}
+
+		/// Fast complementary error function.
+		///
+		/// **See also:** Documentation for [std::erfc](https://en.cppreference.com/w/cpp/numeric/math/erfc).
+		/// \param arg function argument
+		/// \return 1 minus error function value of \a arg
+		/// \exception FE_UNDERFLOW, ...INEXACT according to rounding
+		inline half erfc(half arg) { return half(detail::fast_erfc(static_cast<float>(arg))); }
+
+		/// Fast natural logarithm of gamma function.
+		/// This function is at most 4 ULP off the correctly rounded result.
+		///
+		/// **See also:** Documentation for [std::lgamma](https://en.cppreference.com/w/cpp/numeric/math/lgamma).
+		/// \param arg function argument
+		/// \return natural logarith of gamma function for \a arg
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline half lgamma(half arg) { return half(detail::fast_lgamma(static_cast<float>(arg))); }
+
+		/// Fast gamma function.
+		///
+		/// **See also:** Documentation for [std::tgamma](https://en.cppreference.com/w/cpp/numeric/math/tgamma).
+		/// \param arg function argument
+		/// \return gamma function value of \a arg
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline half tgamma(half arg) { return half(detail::fast_tgamma(static_cast<float>(arg))); }
+		/// \}
+	}
 }
 
 
@@ -23,12 +23,15 @@ using half_float::half;
 
 #include <utility>
 #include <vector>
+#include <string>
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
+#include <memory>
 #include <functional>
 #include <random>
 #include <chrono>
+#include <cstdint>
 
 
 #define UNARY_PERFORMANCE_TEST(func, x, N) { \
@@ -52,6 +55,64 @@ using half_float::half;
 	auto ops = double(x.size() / N) * double(y.size() / N) / std::chrono::duration_cast<std::chrono::microseconds>(diff).count(); \
 	out << #op << "\t@ 1/" << (N*N) << ":\t" << tm << " ms \t-> " << ops << " MFLOPS\n\n"; if(csv) *csv << #op << ';' << ops << '\n'; }
 
+#define LATENCY_PERFORMANCE_TEST(op, x, N) { \
+	half r(1.0f); auto start = std::chrono::high_resolution_clock::now(); \
+	for(unsigned int i=0; i<N; ++i) for(unsigned int h=0; h<x.size(); ++h) r = x[h] op r; \
+	auto diff = std::chrono::high_resolution_clock::now() - start; auto tm = std::chrono::duration_cast<std::chrono::milliseconds>(diff).count(); \
+	auto ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(diff).count()) / double(x.size() * N); results[0] = r; \
+	out << #op << "\tchain x " << N << ":\t" << tm << " ms \t-> " << ns << " ns latency\n\n"; if(csv) *csv << #op << " chain;" << ns << '\n'; }
+
+#define ARRAY_PERFORMANCE_TEST(func, x, y, N) { \
+	auto start = std::chrono::high_resolution_clock::now(); \
+	for(unsigned int i=0; i<N; ++i) half_float::func(x.data(), y, results.data(), x.size()); \
+	auto diff = std::chrono::high_resolution_clock::now() - start; auto tm = std::chrono::duration_cast<std::chrono::milliseconds>(diff).count(); \
+	auto ops = double(x.size() * N) / std::chrono::duration_cast<std::chrono::microseconds>(diff).count(); \
+	out << #func "(" #x ", " #y ")\tx " << N << ":\t" << tm << " ms \t-> " << ops << " MFLOPS\n\n"; if(csv) *csv << #func "(" #x ", " #y ")" << ';' << ops << '\n'; }
+
+#define ARRAY_TERNARY_PERFORMANCE_TEST(func, x, y, z, N) { \
+	auto start = std::chrono::high_resolution_clock::now(); \
+	for(unsigned int i=0; i<N; ++i) half_float::func(x.data(), y, z, results.data(), x.size()); \
+	auto diff = std::chrono::high_resolution_clock::now() - start; auto tm = std::chrono::duration_cast<std::chrono::milliseconds>(diff).count(); \
+	auto ops = double(x.size() * N) / std::chrono::duration_cast<std::chrono::microseconds>(diff).count(); \
+	out << #func "(" #x ", " #y ", " #z ")\tx " << N << ":\t" << tm << " ms \t-> " << ops << " MFLOPS\n\n"; if(csv) *csv << #func "(" #x ", " #y ", " #z ")" << ';' << ops << '\n'; }
+
+#define DOT_PERFORMANCE_TEST(func, x, y, N) { \
+	auto start = std::chrono::high_resolution_clock::now(); double sum = 0.0; \
+	for(unsigned int i=0; i<N; ++i) sum += half_float::func(x.data(), y.data(), x.size()); \
+	auto diff = std::chrono::high_resolution_clock::now() - start; auto tm = std::chrono::duration_cast<std::chrono::milliseconds>(diff).count(); \
+	auto ops = double(x.size() * N) / std::chrono::duration_cast<std::chrono::microseconds>(diff).count(); results[0] = half(static_cast<float>(sum)); \
+	out << #func "(" << x.size() << ")\tx " << N << ":\t" << tm << " ms \t-> " << ops << " MFLOPS\n\n"; if(csv) *csv << #func "(" << x.size() << ");" << ops << '\n'; }
+
+#define SUM_PERFORMANCE_TEST(func, x, N) { \
+	auto start = std::chrono::high_resolution_clock::now(); double sum = 0.0; \
+	for(unsigned int i=0; i<N; ++i) sum += static_cast<double>(half_float::func(x.data(), x.size())); \
+	auto diff = std::chrono::high_resolution_clock::now() - start; auto tm = std::chrono::duration_cast<std::chrono::milliseconds>(diff).count(); \
+	auto ops = double(x.size() * N) / std::chrono::duration_cast<std::chrono::microseconds>(diff).count(); results[0] = half(static_cast<float>(sum)); \
+	out << #func "(" << x.size() << ")\tx " << N << ":\t" << tm << " ms \t-> " << ops << " MFLOPS\n\n"; if(csv) *csv << #func "(" << x.size() << ");" << ops << '\n'; }
+
+#define LOOP_PERFORMANCE_TEST(name, code, n, N) { \
+	auto start = std::chrono::high_resolution_clock::now(); \
+	for(unsigned int i=0; i<N; ++i) { code; } \
+	auto diff = std::chrono::high_resolution_clock::now() - start; auto tm = std::chrono::duration_cast<std::chrono::milliseconds>(diff).count(); \
+	auto ops = double(n) * N / std::chrono::duration_cast<std::chrono::microseconds>(diff).count(); \
+	out << name "(" << n << ")\tx " << N << ":\t" << tm << " ms \t-> " << ops << " MFLOPS\n\n"; if(csv) *csv << name "(" << n << ");" << ops << '\n'; }
+
+#define MATRIX_PERFORMANCE_TEST(name, code, m, n, k, N) { \
+	auto start = std::chrono::high_resolution_clock::now(); \
+	for(unsigned int i=0; i<N; ++i) { code; } \
+	auto diff = std::chrono::high_resolution_clock::now() - start; auto tm = std::chrono::duration_cast<std::chrono::milliseconds>(diff).count(); \
+	auto ops = 2.0 * double(m) * double(n) * double(k) * N / std::chrono::duration_cast<std::chrono::microseconds>(diff).count(); \
+	out << name "(" << m << 'x' << n << 'x' << k << ")\tx " << N << ":\t" << tm << " ms \t-> " << ops << " MFLOPS\n\n"; \
+	if(csv) *csv << name "(" << m << 'x' << n << 'x' << k << ");" << ops << '\n'; }
+
+#define BANDWIDTH_PERFORMANCE_TEST(name, code, bytes, N, peak) { \
+	auto start = std::chrono::high_resolution_clock::now(); \
+	for(unsigned int i=0; i<N; ++i) { code; } \
+	auto diff = std::chrono::high_resolution_clock::now() - start; auto tm = std::chrono::duration_cast<std::chrono::milliseconds>(diff).count(); \
+	auto rate = double(bytes) * N / std::chrono::duration_cast<std::chrono::microseconds>(diff).count() / 1e3; if(peak <= 0.0) peak = rate; \
+	out << name << "\tx " << N << ":\t" << tm << " ms \t-> " << rate << " GB/s (" << (100.0*rate/peak) << "% of triad)\n\n"; \
+	if(csv) *csv << name << ';' << rate << ';' << (rate/peak) << '\n'; }
+
 #define TERNARY_PERFORMANCE_TEST(func, x, y, z, N) { \
 	auto start = std::chrono::high_resolution_clock::now(); \
 	for(unsigned int i=0; i<x.size(); i+=N) for(unsigned int j=0; j<y.size(); j+=N) for(unsigned int k=0; k<z.size(); k+=N) results[k] = func(x[i], y[j], z[k]); \
@@ -59,10 +120,56 @@ using half_float::half;
 	auto ops = double(x.size() / N) * double(y.size() / N) * double(z.size() / N) / std::chrono::duration_cast<std::chrono::microseconds>(diff).count(); \
 	out << #func << "\t@ 1/" << (N*N*N) << ":\t" << tm << " ms \t-> " << ops << " MFLOPS\n\n"; if(csv) *csv << #func << ';' << ops << '\n'; }
 
+#define HYBRID_PERFORMANCE_TEST(func, x, N) { \
+	auto start = std::chrono::high_resolution_clock::now(); \
+	for(unsigned int i=0; i<N; ++i) for(unsigned int h=0; h<x.size(); ++h) results[h] = hybrid(std::func(half_float::half_cast<double>(x[h])), x[h], half_float::func); \
+	auto diff = std::chrono::high_resolution_clock::now() - start; auto tm = std::chrono::duration_cast<std::chrono::milliseconds>(diff).count(); \
+	auto ops = double(x.size() * N) / std::chrono::duration_cast<std::chrono::microseconds>(diff).count(); unsigned int bits, direct = 0; \
+	for(unsigned int h=0; h<x.size(); ++h) direct += half_float::detail::hybrid<std::numeric_limits<half>::round_style>(std::func(half_float::half_cast<double>(x[h])), bits); \
+	out << "hybrid " #func << "\tx " << N << ":\t" << tm << " ms \t-> " << ops << " MFLOPS, " << (100.0*direct/x.size()) << "% direct\n\n"; \
+	if(csv) *csv << "hybrid " #func << ';' << ops << ';' << (double(direct)/x.size()) << '\n'; }
+
+#define FAST_PERFORMANCE_TEST(func, x, N) { \
+	auto start = std::chrono::high_resolution_clock::now(); \
+	for(unsigned int i=0; i<N; ++i) for(unsigned int h=0; h<x.size(); ++h) results[h] = half_float::fast::func(x[h]); \
+	auto diff = std::chrono::high_resolution_clock::now() - start; auto tm = std::chrono::duration_cast<std::chrono::milliseconds>(diff).count(); \
+	auto ops = double(x.size() * N) / std::chrono::duration_cast<std::chrono::microseconds>(diff).count(); unsigned int ulps = 0; \
+	for(unsigned int h=0; h<x.size(); ++h) ulps = std::max(ulps, ulp_distance(half_float::fast::func(x[h]), half_float::func(x[h]))); \
+	out << "fast::" #func << "\tx " << N << ":\t" << tm << " ms \t-> " << ops << " MFLOPS, max " << ulps << " ULP\n\n"; \
+	if(csv) *csv << "fast::" #func << ';' << ops << ';' << ulps << '\n'; }
+
+#define FAST_BINARY_PERFORMANCE_TEST(func, x, y, N) { \
+	auto start = std::chrono::high_resolution_clock::now(); \
+	for(unsigned int i=0; i<x.size(); i+=N) for(unsigned int j=0; j<y.size(); j+=N) results[j] = half_float::fast::func(x[i], y[j]); \
+	auto diff = std::chrono::high_resolution_clock::now() - start; auto tm = std::chrono::duration_cast<std::chrono::milliseconds>(diff).count(); \
+	auto ops = double(x.size() / N) * double(y.size() / N) / std::chrono::duration_cast<std::chrono::microseconds>(diff).count(); unsigned int ulps = 0; \
+	for(unsigned int i=0; i<x.size(); i+=N) for(unsigned int j=0; j<y.size(); j+=N) ulps = std::max(ulps, ulp_distance(half_float::fast::func(x[i], y[j]), half_float::func(x[i], y[j]))); \
+	out << "fast::" #func << "\t@ 1/" << (N*N) << ":\t" << tm << " ms \t-> " << ops << " MFLOPS, max " << ulps << " ULP\n\n"; \
+	if(csv) *csv << "fast::" #func << ';' << ops << ';' << ulps << '\n'; }
+
+
+unsigned int ulp_distance(half a, half b)
+{
+	if(isnan(a) || isnan(b))
+		return (isnan(a) && isnan(b)) ? 0 : 65536;
+	int x = *reinterpret_cast<std::uint16_t*>(&a), y = *reinterpret_cast<std::uint16_t*>(&b);
+	x = (x&0x8000) ? -(x&0x7FFF) : x;
+	y = (y&0x8000) ? -(y&0x7FFF) : y;
+	return std::abs(x-y);
+}
+
+half hybrid(double d, half arg, half(*exact)(half))
+{
+	unsigned int bits;
+	if(!half_float::detail::hybrid<std::numeric_limits<half>::round_style>(d, bits))
+		return exact(arg);
+	std::uint16_t u = static_cast<std::uint16_t>(bits);
+	return *reinterpret_cast<half*>(&u);
+}
 
 void performance_test(std::ostream &out = std::cout, std::ostream *csv = nullptr)
 {
-	std::vector<half> finite, positive, one2one, one2inf, neg2inf;
+	std::vector<half> finite, positive, one2one, one2inf, neg2inf, subnormal;
 	for(std::uint16_t u=0; u<0x7C00; ++u)
 	{
 		half pos = *reinterpret_cast<half*>(&u), neg = -pos;
@@ -70,6 +177,11 @@ void performance_test(std::ostream &out = std::cout, std::ostream *csv = nullptr
 		finite.push_back(neg);
 		positive.push_back(pos);
 		neg2inf.push_back(pos);
+		if(u && u < 0x400)
+		{
+			subnormal.push_back(pos);
+			subnormal.push_back(neg);
+		}
 		if(u <= 0x3C00)
 		{
 			one2one.push_back(pos);
@@ -83,9 +195,14 @@ void performance_test(std::ostream &out = std::cout, std::ostream *csv = nullptr
 	std::default_random_engine g;
 	std::shuffle(finite.begin(), finite.end(), g);
 	std::shuffle(positive.begin(), positive.end(), g);
+	std::vector<half> pairs;		//x, x, y, y, ... keeps a chain r = x / r bounded
+	for(half h : positive)
+		if(h != half())
+			pairs.insert(pairs.end(), 2, h);
 	std::shuffle(one2one.begin(), one2one.end(), g);
 	std::shuffle(one2inf.begin(), one2inf.end(), g);
 	std::shuffle(neg2inf.begin(), neg2inf.end(), g);
+	std::shuffle(subnormal.begin(), subnormal.end(), g);
 	std::shuffle(xs.begin(), xs.end(), g);
 	std::shuffle(ys.begin(), ys.end(), g);
 	std::shuffle(zs.begin(), zs.end(), g);
@@ -97,9 +214,452 @@ void performance_test(std::ostream &out = std::cout, std::ostream *csv = nullptr
 	OPERATOR_PERFORMANCE_TEST(-, xs, ys, 4);
 	OPERATOR_PERFORMANCE_TEST(*, xs, ys, 4);
 	OPERATOR_PERFORMANCE_TEST(/, xs, ys, 4);
+	LATENCY_PERFORMANCE_TEST(/, pairs, 100);
+	UNARY_PERFORMANCE_TEST(recip, finite, 1000);
+
+	ARRAY_PERFORMANCE_TEST(add, xs, ys.data(), 1000);
+	ARRAY_PERFORMANCE_TEST(sub, xs, ys.data(), 1000);
+	ARRAY_PERFORMANCE_TEST(mul, xs, ys.data(), 1000);
+	ARRAY_PERFORMANCE_TEST(div, xs, ys.data(), 1000);
+	ARRAY_PERFORMANCE_TEST(add, xs, half(1.0f), 1000);
+	ARRAY_PERFORMANCE_TEST(mul, xs, half(0.5f), 1000);
+
+	out << "dot products and sums:\n\n";
+	for(std::size_t n=16; n<=(1<<24); n*=16)
+	{
+		std::vector<half> a(n), b(n);
+		for(std::size_t i=0; i<n; ++i)
+		{
+			a[i] = xs[i%xs.size()];
+			b[i] = ys[(i*7)%ys.size()];
+		}
+		unsigned int N = (1<<26) / n;
+		DOT_PERFORMANCE_TEST(dot, a, b, N);
+		DOT_PERFORMANCE_TEST(dot<half_float::accumulate_exact>, a, b, N);
+		DOT_PERFORMANCE_TEST(exact_dot, a, b, N);
+		SUM_PERFORMANCE_TEST(exact_sum, a, N);
+	}
+
+	out << "vector operations:\n\n";
+	{
+		std::size_t n = xs.size();
+		std::vector<float> fs(n);
+		half alpha(0.75f);
+		float fsum = 0.0f;
+		std::size_t index = 0;
+		LOOP_PERFORMANCE_TEST("axpy", half_float::axpy(alpha, xs.data(), results.data(), n), n, 1000);
+		LOOP_PERFORMANCE_TEST("scalar axpy", for(std::size_t j=0; j<n; ++j) results[j] += alpha * xs[j], n, 1000);
+		LOOP_PERFORMANCE_TEST("axpy float", half_float::axpy(static_cast<float>(alpha), xs.data(), fs.data(), n), n, 1000);
+		LOOP_PERFORMANCE_TEST("scalar axpy float", for(std::size_t j=0; j<n; ++j) fs[j] += static_cast<float>(alpha) * xs[j], n, 1000);
+		LOOP_PERFORMANCE_TEST("scal", half_float::scal(alpha, results.data(), n), n, 1000);
+		LOOP_PERFORMANCE_TEST("scalar scal", for(std::size_t j=0; j<n; ++j) results[j] *= alpha, n, 1000);
+		LOOP_PERFORMANCE_TEST("asum", fsum += half_float::asum(xs.data()+(i&1), n-1), n, 1000);
+		LOOP_PERFORMANCE_TEST("scalar asum", half s(0.0f); for(std::size_t j=i&1; j<n; ++j) s += abs(xs[j]); fsum += s, n, 1000);
+		LOOP_PERFORMANCE_TEST("exact_asum", fsum += half_float::exact_asum(xs.data()+(i&1), n-1), n, 1000);
+		LOOP_PERFORMANCE_TEST("nrm2", fsum += half_float::nrm2(xs.data()+(i&1), n-1), n, 1000);
+		LOOP_PERFORMANCE_TEST("scalar nrm2", half s(0.0f); for(std::size_t j=i&1; j<n; ++j) s = hypot(s, xs[j]); fsum += s, n, 1000);
+		LOOP_PERFORMANCE_TEST("exact_nrm2", fsum += half_float::exact_nrm2(xs.data()+(i&1), n-1), n, 1000);
+		LOOP_PERFORMANCE_TEST("iamax", index += half_float::iamax(xs.data()+(i&1), n-1), n, 1000);
+		LOOP_PERFORMANCE_TEST("scalar iamax", std::size_t k = i&1; for(std::size_t j=k+1; j<n; ++j) if(abs(xs[j]) > abs(xs[k])) k = j; index += k, n, 1000);
+		LOOP_PERFORMANCE_TEST("iamin", index += half_float::iamin(xs.data()+(i&1), n-1), n, 1000);
+		LOOP_PERFORMANCE_TEST("sum", fsum += half_float::sum(xs.data()+(i&1), n-1), n, 1000);
+		LOOP_PERFORMANCE_TEST("pairwise_sum", fsum += half_float::pairwise_sum(xs.data()+(i&1), n-1), n, 1000);
+		LOOP_PERFORMANCE_TEST("scalar sum", float s = 0.0f; for(std::size_t j=i&1; j<n; ++j) s += xs[j]; fsum += s, n, 1000);
+		LOOP_PERFORMANCE_TEST("reduce_min", fsum += half_float::reduce_min(xs.data()+(i&1), n-1), n, 1000);
+		LOOP_PERFORMANCE_TEST("reduce_max", fsum += half_float::reduce_max(xs.data()+(i&1), n-1), n, 1000);
+		LOOP_PERFORMANCE_TEST("scalar min", half m = xs[i&1]; for(std::size_t j=(i&1)+1; j<n; ++j) m = fmin(m, xs[j]); fsum += m, n, 1000);
+		LOOP_PERFORMANCE_TEST("argmin", index += half_float::argmin(xs.data()+(i&1), n-1), n, 1000);
+		LOOP_PERFORMANCE_TEST("argmax", index += half_float::argmax(xs.data()+(i&1), n-1), n, 1000);
+		LOOP_PERFORMANCE_TEST("scalar argmax", std::size_t k = i&1; for(std::size_t j=k+1; j<n; ++j) if(xs[j] > xs[k]) k = j; index += k, n, 1000);
+		results[0] = half(fsum+static_cast<float>(index));
+	}
+
+	out << "matrix multiplication:\n\n";
+	const std::size_t shapes[][3] = { { 64, 64, 64 }, { 256, 256, 256 }, { 1024, 1024, 1024 }, { 4096, 16, 4096 }, { 16, 4096, 4096 }, { 1, 4096, 4096 } };
+	for(auto &shape : shapes)
+	{
+		std::size_t m = shape[0], n = shape[1], k = shape[2];
+		std::vector<half> a(m*k), b(k*n), c(m*n);
+		for(std::size_t i=0; i<a.size(); ++i)
+			a[i] = one2one[i%one2one.size()];
+		for(std::size_t i=0; i<b.size(); ++i)
+			b[i] = one2one[(i*7)%one2one.size()];
+		std::vector<float> fa(a.size()), fb(b.size()), fc(c.size());
+		unsigned int N = std::max<unsigned int>(1, static_cast<unsigned int>((1ull<<30)/(m*n*k)));
+		MATRIX_PERFORMANCE_TEST("naive float gemm", 
+			std::copy(a.begin(), a.end(), fa.begin()); std::copy(b.begin(), b.end(), fb.begin()); std::fill(fc.begin(), fc.end(), 0.0f); 
+			for(std::size_t i=0; i<m; ++i) for(std::size_t l=0; l<k; ++l) for(std::size_t j=0; j<n; ++j) fc[i*n+j] += fa[i*k+l] * fb[l*n+j];
+			std::transform(fc.begin(), fc.end(), c.begin(), [](float f) { return half(f); }), m, n, k, N);
+		MATRIX_PERFORMANCE_TEST("gemm", half_float::gemm(half_float::row_major, half_float::no_transpose, half_float::no_transpose, 
+			m, n, k, 1.0f, a.data(), k, b.data(), n, 0.0f, c.data(), n), m, n, k, N);
+		MATRIX_PERFORMANCE_TEST("gemm float output", half_float::gemm(half_float::row_major, half_float::no_transpose, half_float::no_transpose, 
+			m, n, k, 1.0f, a.data(), k, b.data(), n, 0.0f, fc.data(), n), m, n, k, N);
+		MATRIX_PERFORMANCE_TEST("gemm transposed", half_float::gemm(half_float::row_major, half_float::transpose, half_float::transpose, 
+			m, n, k, 1.0f, a.data(), m, b.data(), k, 0.0f, c.data(), n), m, n, k, N);
+	}
+
+	out << "matrix-vector multiplication:\n\n";
+	{
+		std::vector<float> sa(1<<23), sb(sa.size(), 1.0f), sc(sa.size(), 2.0f);
+		double peak = 0.0;
+		BANDWIDTH_PERFORMANCE_TEST("stream triad", 
+			for(std::size_t i=0; i<sa.size(); ++i) sa[i] = sb[i] + 3.0f*sc[i], 3*sizeof(float)*sa.size(), 16, peak);
+		const std::size_t sizes[][2] = { { 4096, 4096 }, { 16384, 1024 }, { 1024, 16384 }, { 256, 65536 } };
+		for(auto &size : sizes)
+		{
+			std::size_t m = size[0], n = size[1];
+			std::vector<half> a(m*n);
+			for(std::size_t i=0; i<a.size(); ++i)
+				a[i] = one2one[i%one2one.size()];
+			std::vector<float> x(std::max(m, n), 1.0f), y(x.size());
+			std::size_t bytes = sizeof(half)*m*n + sizeof(float)*(m+n);
+			std::string dims = "(" + std::to_string(m) + 'x' + std::to_string(n) + ")";
+			BANDWIDTH_PERFORMANCE_TEST("gemv" + dims, half_float::gemv(half_float::row_major, half_float::no_transpose, 
+				m, n, 1.0f, a.data(), n, x.data(), 0.0f, y.data()), bytes, 32, peak);
+			BANDWIDTH_PERFORMANCE_TEST("gemv transposed" + dims, half_float::gemv(half_float::row_major, half_float::transpose, 
+				m, n, 1.0f, a.data(), n, x.data(), 0.0f, y.data()), bytes, 32, peak);
+		}
+	}
+
+	out << "prefix sums:\n\n";
+	{
+		std::vector<half> a(1<<24), b(a.size());
+		std::vector<float> f(a.size());
+		for(std::size_t i=0; i<a.size(); ++i)
+			a[i] = one2one[i%one2one.size()];
+		for(std::size_t n : { 1<<8, 1<<12, 1<<16, 1<<20, 1<<24 })
+		{
+			unsigned int N = (1<<26) / n;
+			LOOP_PERFORMANCE_TEST("serial operator+", half s(0.0f); for(std::size_t j=0; j<n; ++j) b[j] = s += a[j], n, N);
+			LOOP_PERFORMANCE_TEST("inclusive_scan", half_float::inclusive_scan(a.data(), b.data(), n), n, N);
+			LOOP_PERFORMANCE_TEST("exclusive_scan", half_float::exclusive_scan(a.data(), b.data(), n), n, N);
+			LOOP_PERFORMANCE_TEST("inclusive_scan to float", half_float::inclusive_scan(a.data(), f.data(), n), n, N);
+			LOOP_PERFORMANCE_TEST("inclusive_scan<accumulate_exact>", half_float::inclusive_scan<half_float::accumulate_exact>(a.data(), b.data(), n), n, std::max(N/8, 1u));
+		}
+	}
+
+	out << "deterministic reductions:\n\n";
+	{
+		std::vector<half> a(1<<24), b(a.size());
+		for(std::size_t i=0; i<a.size(); ++i)
+		{
+			a[i] = finite[i%finite.size()];
+			b[i] = finite[(i*7)%finite.size()];
+		}
+	#if HALF_ENABLE_OPENMP
+		int procs = omp_get_num_procs(), threads = omp_get_max_threads();
+	#else
+		int procs = 1;
+	#endif
+		double base[3] = { 0.0, 0.0, 0.0 };
+		float first[3];
+		for(int t=1; t<=procs; ++t)
+		{
+		#if HALF_ENABLE_OPENMP
+			omp_set_num_threads(t);
+		#endif
+			const char *names[] = { "sum<accumulate_pairwise>", "dot<accumulate_pairwise>", "nrm2<accumulate_pairwise>" };
+			for(int j=0; j<3; ++j)
+			{
+				float r = 0.0f;
+				auto start = std::chrono::high_resolution_clock::now();
+				for(unsigned int i=0; i<16; ++i)
+					r = (j==0) ? half_float::sum<half_float::accumulate_pairwise>(a.data(), a.size()) : (j==1) ?
+						half_float::dot<half_float::accumulate_pairwise>(a.data(), b.data(), a.size()) :
+						half_float::nrm2<half_float::accumulate_pairwise>(a.data(), a.size());
+				auto diff = std::chrono::high_resolution_clock::now() - start;
+				auto ops = double(a.size()) * 16 / std::chrono::duration_cast<std::chrono::microseconds>(diff).count();
+				if(t == 1)
+				{
+					base[j] = ops;
+					first[j] = r;
+				}
+				out << names[j] << "(" << a.size() << ") with " << t << " threads:\t" << ops << " MFLOPS\t(" <<
+					(ops/base[j]) << "x, " << ((r==first[j]) ? "identical" : "DIFFERENT") << ")\n\n";
+				if(csv)
+					*csv << names[j] << '(' << t << ");" << ops << '\n';
+			}
+		}
+	#if HALF_ENABLE_OPENMP
+		omp_set_num_threads(threads);
+	#endif
+	}
+
+	out << "neural network operations:\n\n";
+	{
+		const std::size_t sizes[][2] = { { 256, 64 }, { 64, 1024 }, { 1, 50257 } };
+		std::vector<half> a(64*1024), b(a.size());
+		for(std::size_t i=0; i<a.size(); ++i)
+			a[i] = finite[i%finite.size()] / half(4096.0f);
+		auto scalar_softmax = [&](std::size_t m, std::size_t n) {
+			for(std::size_t r=0; r<m; ++r)
+			{
+				const half *x = a.data() + r*n;
+				half *y = b.data() + r*n, max = x[0], sum(0.0f);
+				for(std::size_t j=1; j<n; ++j)
+					max = half_float::fmax(max, x[j]);
+				for(std::size_t j=0; j<n; ++j)
+					sum += y[j] = half_float::exp(x[j]-max);
+				for(std::size_t j=0; j<n; ++j)
+					y[j] /= sum;
+			} };
+		for(auto &size : sizes)
+		{
+			std::size_t m = size[0], n = size[1];
+			LOOP_PERFORMANCE_TEST("scalar softmax", scalar_softmax(m, n), m*n, 100);
+			LOOP_PERFORMANCE_TEST("softmax", half_float::softmax(a.data(), b.data(), m, n), m*n, 1000);
+			LOOP_PERFORMANCE_TEST("log_softmax", half_float::log_softmax(a.data(), b.data(), m, n), m*n, 1000);
+		}
+		std::vector<half> gamma(1024), beta(gamma.size());
+		for(std::size_t i=0; i<gamma.size(); ++i)
+		{
+			gamma[i] = finite[(3*i)%finite.size()] / half(4096.0f);
+			beta[i] = finite[(7*i)%finite.size()] / half(4096.0f);
+		}
+		auto scalar_layer_norm = [&](std::size_t m, std::size_t n) {
+			for(std::size_t r=0; r<m; ++r)
+			{
+				const half *x = a.data() + r*n;
+				half *y = b.data() + r*n, mean(0.0f), var(0.0f);
+				for(std::size_t j=0; j<n; ++j)
+					mean += x[j];
+				mean /= half(static_cast<float>(n));
+				for(std::size_t j=0; j<n; ++j)
+					var += (x[j]-mean) * (x[j]-mean);
+				half scale = half(1.0f) / half_float::sqrt(var/half(static_cast<float>(n))+half(1e-5f));
+				for(std::size_t j=0; j<n; ++j)
+					y[j] = (x[j]-mean) * scale * gamma[j] + beta[j];
+			} };
+		for(auto &size : sizes)
+		{
+			std::size_t m = size[0], n = size[1];
+			if(n > gamma.size())
+				continue;
+			LOOP_PERFORMANCE_TEST("scalar layer_norm", scalar_layer_norm(m, n), m*n, 100);
+			LOOP_PERFORMANCE_TEST("layer_norm", half_float::layer_norm(a.data(), gamma.data(), beta.data(), b.data(), m, n, 1e-5f), m*n, 1000);
+			LOOP_PERFORMANCE_TEST("rms_norm", half_float::rms_norm(a.data(), gamma.data(), b.data(), m, n, 1e-5f), m*n, 1000);
+		}
+	}
+
+	out << "convolutions:\n\n";
+	{
+		const std::size_t shapes[][6] = { { 1, 1, 1, 65536, 1, 31 }, { 8, 8, 1, 4096, 1, 5 }, { 16, 16, 56, 56, 3, 3 }, { 3, 32, 128, 128, 3, 3 } };
+		std::vector<half> x(65536), f(16*16*31), y(65536);
+		for(std::size_t i=0; i<x.size(); ++i)
+			x[i] = finite[i%finite.size()] / half(4096.0f);
+		for(std::size_t i=0; i<f.size(); ++i)
+			f[i] = finite[(5*i)%finite.size()] / half(4096.0f);
+		for(auto &shape : shapes)
+		{
+			std::size_t ci = shape[0], co = shape[1], h = shape[2], w = shape[3], kh = shape[4], kw = shape[5];
+			std::size_t ho = half_float::convolution_size(half_float::same_padding, h, kh, 1, 1), wo = half_float::convolution_size(half_float::same_padding, w, kw, 1, 1);
+			std::size_t taps = co * ho * wo * ci * kh * kw;
+			x.resize(std::max(x.size(), ci*h*w));
+			y.resize(std::max(y.size(), co*ho*wo));
+			auto naive = [&]() {
+				for(std::size_t o=0; o<co; ++o) for(std::size_t i=0; i<ho; ++i) for(std::size_t j=0; j<wo; ++j)
+				{
+					half sum(0.0f);
+					for(std::size_t c=0; c<ci; ++c) for(std::size_t r=0; r<kh; ++r) for(std::size_t l=0; l<kw; ++l)
+					{
+						long iy = static_cast<long>(i+r) - static_cast<long>(kh/2), ix = static_cast<long>(j+l) - static_cast<long>(kw/2);
+						if(iy >= 0 && ix >= 0 && iy < static_cast<long>(h) && ix < static_cast<long>(w))
+							sum += f[((o*ci+c)*kh+r)*kw+l] * x[(c*h+iy)*w+ix];
+					}
+					y[(o*ho+i)*wo+j] = sum;
+				} };
+			LOOP_PERFORMANCE_TEST("naive convolution", naive(), taps, 1);
+			if(h == 1)
+			{
+				LOOP_PERFORMANCE_TEST("conv1d", half_float::conv1d(half_float::same_padding, ci, co, w, kw, 1, 1, x.data(), f.data(), nullptr, y.data()), taps, 100);
+			}
+			else
+			{
+				LOOP_PERFORMANCE_TEST("conv2d", half_float::conv2d(half_float::same_padding, ci, co, h, w, kh, kw, 1, 1, 1, 1, x.data(), f.data(), nullptr, y.data()), taps, 100);
+			}
+		}
+	}
+
+	out << "attention:\n\n";
+	{
+		const std::size_t shapes[][4] = { { 8, 1, 2048, 64 }, { 8, 512, 512, 64 }, { 2, 1024, 1024, 128 } };
+		std::vector<half> q(8*512*64), k(8*2048*64), v(k.size()), o(q.size());
+		for(std::size_t i=0; i<k.size(); ++i)
+		{
+			k[i] = finite[i%finite.size()] / half(16384.0f);
+			v[i] = finite[(3*i)%finite.size()] / half(16384.0f);
+		}
+		for(std::size_t i=0; i<q.size(); ++i)
+			q[i] = finite[(7*i)%finite.size()] / half(16384.0f);
+		for(auto &shape : shapes)
+		{
+			std::size_t heads = shape[0], m = shape[1], n = shape[2], d = shape[3], flops = 4 * heads * m * n * d;
+			std::vector<float> scores(n), sums(d);
+			auto unfused = [&](bool causal) {
+				for(std::size_t h=0; h<heads; ++h)
+					for(std::size_t i=0; i<m; ++i)
+					{
+						std::size_t keys = causal ? (i+n-m+1) : n;
+						for(std::size_t j=0; j<keys; ++j)
+							scores[j] = half_float::dot(&q[(h*m+i)*d], &k[(h*n+j)*d], d) * 0.125f;
+						float max = *std::max_element(scores.begin(), scores.begin()+keys), sum = 0.0f;
+						std::fill(sums.begin(), sums.end(), 0.0f);
+						for(std::size_t j=0; j<keys; ++j)
+						{
+							sum += scores[j] = std::exp(scores[j]-max);
+							for(std::size_t t=0; t<d; ++t)
+								sums[t] += scores[j] * static_cast<float>(v[(h*n+j)*d+t]);
+						}
+						for(std::size_t t=0; t<d; ++t)
+							o[(h*m+i)*d+t] = half(sums[t]/sum);
+					} };
+			LOOP_PERFORMANCE_TEST("unfused attention", unfused(false), flops, 1);
+			LOOP_PERFORMANCE_TEST("attention", half_float::attention(heads, m, n, d, q.data(), k.data(), v.data(), o.data(), 0.125f, false), flops, 10);
+			if(m > 1)
+			{
+				LOOP_PERFORMANCE_TEST("causal attention", half_float::attention(heads, m, n, d, q.data(), k.data(), v.data(), o.data(), 0.125f, true), flops/2, 10);
+			}
+		}
+	}
+
+	out << "activations:\n\n";
+	{
+		std::normal_distribution<float> dist(0.0f, 1.0f);
+		std::vector<half> a(1<<20), b(a.size());
+		for(half &h : a)
+			h = half(dist(g));
+		std::size_t n = a.size();
+		LOOP_PERFORMANCE_TEST("scalar relu", for(std::size_t j=0; j<n; ++j) b[j] = half_float::relu(a[j]), n, 10);
+		LOOP_PERFORMANCE_TEST("relu_array", half_float::relu_array(a.data(), b.data(), n), n, 1000);
+		LOOP_PERFORMANCE_TEST("scalar sigmoid", for(std::size_t j=0; j<n; ++j) b[j] = half_float::sigmoid(a[j]), n, 1);
+		LOOP_PERFORMANCE_TEST("sigmoid_array", half_float::sigmoid_array(a.data(), b.data(), n), n, 100);
+		LOOP_PERFORMANCE_TEST("scalar silu", for(std::size_t j=0; j<n; ++j) b[j] = half_float::silu(a[j]), n, 1);
+		LOOP_PERFORMANCE_TEST("silu_array", half_float::silu_array(a.data(), b.data(), n), n, 100);
+		LOOP_PERFORMANCE_TEST("scalar gelu", for(std::size_t j=0; j<n; ++j) b[j] = half_float::gelu(a[j]), n, 1);
+		LOOP_PERFORMANCE_TEST("gelu_array", half_float::gelu_array(a.data(), b.data(), n), n, 100);
+	}
+
+	out << "optimizers:\n\n";
+	{
+		std::normal_distribution<float> dist(0.0f, 1.0f);
+		std::vector<half> gr(1<<22), h(gr.size());
+		std::vector<float> w(gr.size()), m(gr.size()), v(gr.size());
+		for(std::size_t j=0; j<gr.size(); ++j)
+		{
+			gr[j] = half(dist(g));
+			w[j] = dist(g);
+		}
+		std::size_t n = gr.size();
+		double peak = 0.0;
+		BANDWIDTH_PERFORMANCE_TEST("stream triad", 
+			for(std::size_t j=0; j<n; ++j) w[j] = m[j] + 3.0f*v[j], 3*sizeof(float)*n, 20, peak);
+		std::size_t bytes = (2*sizeof(half)+2*sizeof(float)) * n;
+		BANDWIDTH_PERFORMANCE_TEST("scalar sgd", for(std::size_t j=0; j<n; ++j) 
+			h[j] = half(w[j] -= 1e-3f * (w[j]*1e-4f+static_cast<float>(gr[j]))), bytes, 20, peak);
+		BANDWIDTH_PERFORMANCE_TEST("sgd", half_float::sgd_step(1e-3f, 1e-4f, gr.data(), w.data(), h.data(), n), bytes, 20, peak);
+		BANDWIDTH_PERFORMANCE_TEST("sgd stochastic", half_float::sgd_step(1e-3f, 1e-4f, gr.data(), w.data(), h.data(), n, 
+			half_float::stochastic_rounding, i), bytes, 20, peak);
+		bytes += 2 * sizeof(float) * n;
+		BANDWIDTH_PERFORMANCE_TEST("scalar momentum", for(std::size_t j=0; j<n; ++j) 
+			h[j] = half(w[j] -= 1e-3f * (v[j] = v[j]*0.9f + w[j]*1e-4f+static_cast<float>(gr[j]))), bytes, 20, peak);
+		BANDWIDTH_PERFORMANCE_TEST("momentum", half_float::momentum_step(1e-3f, 0.9f, 1e-4f, false, gr.data(), w.data(), v.data(), 
+			h.data(), n), bytes, 20, peak);
+		bytes += 2 * sizeof(float) * n;
+		std::fill(v.begin(), v.end(), 0.0f);
+		BANDWIDTH_PERFORMANCE_TEST("scalar adam", for(std::size_t j=0; j<n; ++j) { float x = static_cast<float>(gr[j]); 
+			m[j] = 0.9f*m[j] + 0.1f*x; v[j] = 0.999f*v[j] + 0.001f*x*x; h[j] = half(w[j] = w[j]*0.9999f - 1e-3f*m[j]/(std::sqrt(v[j])+1e-8f)); }, 
+			bytes, 20, peak);
+		BANDWIDTH_PERFORMANCE_TEST("adam", half_float::adam_step(1e-3f, 0.9f, 0.999f, 1e-8f, 0.1f, i+1, gr.data(), w.data(), 
+			m.data(), v.data(), h.data(), n), bytes, 20, peak);
+		BANDWIDTH_PERFORMANCE_TEST("adam stochastic", half_float::adam_step(1e-3f, 0.9f, 0.999f, 1e-8f, 0.1f, i+1, gr.data(), w.data(), 
+			m.data(), v.data(), h.data(), n, half_float::stochastic_rounding, i), bytes, 20, peak);
+	}
+
+	out << "loss scaling:\n\n";
+	{
+		std::normal_distribution<float> dist(0.0f, 1.0f);
+		std::vector<half> a(1<<24), b(a.size());
+		for(half &h : a)
+			h = half(dist(g));
+		std::vector<float> sa(a.size()/2), sb(sa.size(), 1.0f), sc(sa.size(), 2.0f);
+		std::size_t n = a.size();
+		double peak = 0.0;
+		bool finite = true;
+		BANDWIDTH_PERFORMANCE_TEST("stream triad", 
+			for(std::size_t j=0; j<sa.size(); ++j) sa[j] = sb[j] + 3.0f*sc[j], 3*sizeof(float)*sa.size(), 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("scalar isfinite", for(std::size_t j=0; j<n; ++j) finite = finite && half_float::isfinite(a[j]), 
+			sizeof(half)*n, 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("all_finite", finite = finite && half_float::all_finite(a.data(), n), sizeof(half)*n, 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("scalar unscale", for(std::size_t j=0; j<n; ++j) { b[j] = half(static_cast<float>(a[j])*0.5f); 
+			finite = finite && half_float::isfinite(b[j]); }, 2*sizeof(half)*n, 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("unscale_and_check", finite = half_float::unscale_and_check(0.5f, a.data(), b.data(), n) && finite, 
+			2*sizeof(half)*n, 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("unscale_and_check in-place", finite = half_float::unscale_and_check(1.0f, b.data(), b.data(), n) && finite, 
+			2*sizeof(half)*n, 10, peak);
+		if(!finite)
+			out << "non-finite values found\n\n";
+	}
+
+	out << "classification:\n\n";
+	{
+		std::normal_distribution<float> dist(0.0f, 1.0f);
+		std::vector<half> a(1<<24);
+		for(half &h : a)
+			h = half(std::ldexp(dist(g), static_cast<int>(g()%40)-24));
+		std::unique_ptr<bool[]> r(new bool[a.size()]);
+		std::vector<float> sa(a.size()/2), sb(sa.size(), 1.0f), sc(sa.size(), 2.0f);
+		std::size_t n = a.size(), count = 0;
+		half s(0.5f);
+		double peak = 0.0;
+		half_float::class_counts counts;
+		BANDWIDTH_PERFORMANCE_TEST("stream triad", 
+			for(std::size_t j=0; j<sa.size(); ++j) sa[j] = sb[j] + 3.0f*sc[j], 3*sizeof(float)*sa.size(), 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("scalar isnormal", for(std::size_t j=0; j<n; ++j) r[j] = half_float::isnormal(a[j]), 
+			(sizeof(half)+sizeof(bool))*n, 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("isnormal_array", half_float::isnormal_array(a.data(), r.get(), n), (sizeof(half)+sizeof(bool))*n, 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("scalar isless", for(std::size_t j=0; j<n; ++j) r[j] = half_float::isless(a[j], s), 
+			(sizeof(half)+sizeof(bool))*n, 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("isless_array", half_float::isless_array(a.data(), s, r.get(), n), (sizeof(half)+sizeof(bool))*n, 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("scalar class counts", for(std::size_t j=0; j<n; ++j) count += half_float::isnan(a[j]) + 
+			half_float::isinf(a[j]) + (half_float::fpclassify(a[j])==FP_SUBNORMAL) + half_float::signbit(a[j]), sizeof(half)*n, 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("count_classes", counts = half_float::count_classes(a.data(), n); count += counts.nan, 
+			sizeof(half)*n, 10, peak);
+		if(std::count(r.get(), r.get()+n, true) + count == 0)
+			out << "no values counted\n\n";
+	}
+
+	out << "array rounding:\n\n";
+	{
+		std::normal_distribution<float> dist(0.0f, 100.0f);
+		std::vector<half> a(1<<24), b(a.size());
+		for(half &h : a)
+			h = half(dist(g));
+		std::vector<short> c(a.size());
+		std::vector<float> sa(a.size()/2), sb(sa.size(), 1.0f), sc(sa.size(), 2.0f);
+		std::size_t n = a.size();
+		double peak = 0.0;
+		BANDWIDTH_PERFORMANCE_TEST("stream triad", 
+			for(std::size_t j=0; j<sa.size(); ++j) sa[j] = sb[j] + 3.0f*sc[j], 3*sizeof(float)*sa.size(), 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("scalar floor", for(std::size_t j=0; j<n; ++j) b[j] = half_float::floor(a[j]), 2*sizeof(half)*n, 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("floor_array", half_float::floor_array(a.data(), b.data(), n), 2*sizeof(half)*n, 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("scalar rint", for(std::size_t j=0; j<n; ++j) b[j] = half_float::rint(a[j]), 2*sizeof(half)*n, 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("rint_array", half_float::rint_array(a.data(), b.data(), n), 2*sizeof(half)*n, 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("scalar lrint", for(std::size_t j=0; j<n; ++j) c[j] = static_cast<short>(half_float::lrint(a[j])), 
+			(sizeof(half)+sizeof(short))*n, 10, peak);
+		BANDWIDTH_PERFORMANCE_TEST("lrint_array", half_float::lrint_array(a.data(), c.data(), n), (sizeof(half)+sizeof(short))*n, 10, peak);
+	}
+
+	out << "subnormal operands:\n\n";
+	OPERATOR_PERFORMANCE_TEST(-, subnormal, subnormal, 1);
+	OPERATOR_PERFORMANCE_TEST(*, subnormal, subnormal, 1);
+	OPERATOR_PERFORMANCE_TEST(/, subnormal, subnormal, 1);
+	UNARY_PERFORMANCE_TEST(recip, subnormal, 10000);
+	UNARY_PERFORMANCE_TEST(cbrt, subnormal, 1000);
+	UNARY_PERFORMANCE_TEST(logb, subnormal, 10000);
 
 	BINARY_PERFORMANCE_TEST(fdim, xs, ys, 8);
 	TERNARY_PERFORMANCE_TEST(fma, xs, ys, zs, 64);
+	ARRAY_TERNARY_PERFORMANCE_TEST(fma_array, xs, ys.data(), zs.data(), 1000);
 
 	UNARY_PERFORMANCE_TEST(exp, finite, 1000);
 	UNARY_PERFORMANCE_TEST(exp2, finite, 1000);
@@ -135,6 +695,60 @@ void performance_test(std::ostream &out = std::cout, std::ostream *csv = nullptr
 	UNARY_PERFORMANCE_TEST(lgamma, finite, 1000);
 	UNARY_PERFORMANCE_TEST(tgamma, finite, 1000);
 
+	//hybrid evaluation like with HALF_HYBRID_MATH, falling back to the functions above
+	HYBRID_PERFORMANCE_TEST(exp, finite, 1000);
+	HYBRID_PERFORMANCE_TEST(log, positive, 1000);
+	HYBRID_PERFORMANCE_TEST(sin, finite, 1000);
+	HYBRID_PERFORMANCE_TEST(atan, finite, 1000);
+	HYBRID_PERFORMANCE_TEST(tanh, finite, 1000);
+	HYBRID_PERFORMANCE_TEST(erf, finite, 1000);
+	HYBRID_PERFORMANCE_TEST(lgamma, finite, 1000);
+
+	UNARY_PERFORMANCE_TEST(half_float::tiered::exp<half_float::accuracy_ulp2>, finite, 1000);
+	UNARY_PERFORMANCE_TEST(half_float::tiered::exp<half_float::accuracy_ulp8>, finite, 1000);
+	UNARY_PERFORMANCE_TEST(half_float::tiered::log<half_float::accuracy_ulp2>, positive, 1000);
+	UNARY_PERFORMANCE_TEST(half_float::tiered::log<half_float::accuracy_ulp8>, positive, 1000);
+	UNARY_PERFORMANCE_TEST(half_float::tiered::sin<half_float::accuracy_ulp2>, finite, 1000);
+	UNARY_PERFORMANCE_TEST(half_float::tiered::sin<half_float::accuracy_ulp8>, finite, 1000);
+	UNARY_PERFORMANCE_TEST(half_float::tiered::atan<half_float::accuracy_ulp2>, finite, 1000);
+	UNARY_PERFORMANCE_TEST(half_float::tiered::atan<half_float::accuracy_ulp8>, finite, 1000);
+	UNARY_PERFORMANCE_TEST(half_float::tiered::tanh<half_float::accuracy_ulp2>, finite, 1000);
+	UNARY_PERFORMANCE_TEST(half_float::tiered::tanh<half_float::accuracy_ulp8>, finite, 1000);
+
+	FAST_PERFORMANCE_TEST(exp, finite, 1000);
+	FAST_PERFORMANCE_TEST(exp2, finite, 1000);
+	FAST_PERFORMANCE_TEST(expm1, finite, 1000);
+	FAST_PERFORMANCE_TEST(log, positive, 1000);
+	FAST_PERFORMANCE_TEST(log10, positive, 1000);
+	FAST_PERFORMANCE_TEST(log2, positive, 1000);
+	FAST_PERFORMANCE_TEST(log1p, neg2inf, 1000);
+
+	FAST_PERFORMANCE_TEST(sqrt, positive, 1000);
+	FAST_PERFORMANCE_TEST(rsqrt, positive, 1000);
+	FAST_PERFORMANCE_TEST(cbrt, finite, 1000);
+	FAST_BINARY_PERFORMANCE_TEST(pow, xs, ys, 8);
+	FAST_BINARY_PERFORMANCE_TEST(hypot, xs, ys, 8);
+
+	FAST_PERFORMANCE_TEST(sin, finite, 1000);
+	FAST_PERFORMANCE_TEST(cos, finite, 1000);
+	FAST_PERFORMANCE_TEST(tan, finite, 1000);
+	FAST_PERFORMANCE_TEST(asin, one2one, 1000);
+	FAST_PERFORMANCE_TEST(acos, one2one, 1000);
+	FAST_PERFORMANCE_TEST(atan, finite, 1000);
+	FAST_BINARY_PERFORMANCE_TEST(atan2, xs, ys, 8);
+
+	FAST_PERFORMANCE_TEST(sinh, finite, 1000);
+	FAST_PERFORMANCE_TEST(cosh, finite, 1000);
+	FAST_PERFORMANCE_TEST(tanh, finite, 1000);
+	FAST_PERFORMANCE_TEST(asinh, finite, 1000);
+	FAST_PERFORMANCE_TEST(acosh, one2inf, 1000);
+	FAST_PERFORMANCE_TEST(atanh, one2one, 1000);
+
+	FAST_PERFORMANCE_TEST(erf, finite, 1000);
+	FAST_PERFORMANCE_TEST(erfc, finite, 1000);
+	FAST_PERFORMANCE_TEST(lgamma, finite, 1000);
+	FAST_PERFORMANCE_TEST(tgamma, finite, 1000);
+
 	if( csv )
 		*csv << std::defaultfloat << std::setprecision(6);
 }
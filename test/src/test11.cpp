@@ -226,6 +226,827 @@ public:
 		binary_double_test("multiplication", [](half a, half b) { return a*b; }, [](double a, double b) { return a*b; });
 		binary_double_test("division", [](half a, half b) { return a/b; }, [](double a, double b) { return a/b; });
 
+	#if HALF_ENABLE_SSE2_INTRINSICS
+		//test vectorized operators
+		typedef std::size_t(*simd_op)(const void*, std::size_t, const void*, std::size_t, void*, std::size_t);
+		auto simd = [](half a, half b, half c, simd_op op) -> bool { half x[8], y[8], z[8]; std::fill_n(x, 8, a); std::fill_n(y, 8, b); 
+			std::size_t n = op(x, 1, y, 1, z, 8); return n == 8 && std::all_of(z, z+8, [=](half h) { return comp(h, c); }); };
+		using half_float::detail::sse2;
+		const std::float_round_style round_style = std::numeric_limits<half>::round_style;
+		binary_test("SSE2 addition", [&](half a, half b) { return simd(a, b, a+b, half_float::detail::simd_array<sse2,half_float::detail::simd_add<round_style,sse2>>); });
+		binary_test("SSE2 subtraction", [&](half a, half b) { return simd(a, b, a-b, half_float::detail::simd_array<sse2,half_float::detail::simd_sub<round_style,sse2>>); });
+		binary_test("SSE2 multiplication", [&](half a, half b) { return simd(a, b, a*b, half_float::detail::simd_array<sse2,half_float::detail::simd_mul<round_style,sse2>>); });
+		binary_test("SSE2 division", [&](half a, half b) { return simd(a, b, a/b, half_float::detail::simd_array<sse2,half_float::detail::simd_div<round_style,sse2>>); });
+	#if HALF_ENABLE_AVX2_INTRINSICS
+		using half_float::detail::avx2;
+		binary_test("AVX2 addition", [&](half a, half b) { return simd(a, b, a+b, half_float::detail::simd_array<avx2,half_float::detail::simd_add<round_style,avx2>>); });
+		binary_test("AVX2 subtraction", [&](half a, half b) { return simd(a, b, a-b, half_float::detail::simd_array<avx2,half_float::detail::simd_sub<round_style,avx2>>); });
+		binary_test("AVX2 multiplication", [&](half a, half b) { return simd(a, b, a*b, half_float::detail::simd_array<avx2,half_float::detail::simd_mul<round_style,avx2>>); });
+		binary_test("AVX2 division", [&](half a, half b) { return simd(a, b, a/b, half_float::detail::simd_array<avx2,half_float::detail::simd_div<round_style,avx2>>); });
+	#endif
+	#endif
+
+		//test array operators
+		auto array = [](half a, half b, void(*op)(const half*, const half*, half*, std::size_t), void(*opl)(const half*, half, half*, std::size_t), 
+			void(*opr)(half, const half*, half*, std::size_t), half(*scalar)(half, half)) -> bool {
+			half_float::feclearexcept(FE_ALL_EXCEPT); half c = scalar(a, b); int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+			half x[19], y[19], z[57]; std::fill_n(x, 19, a); std::fill_n(y, 19, b); half_float::feclearexcept(FE_ALL_EXCEPT);
+			op(x, y, z, 19); opl(x, b, z+19, 19); opr(a, y, z+38, 19);
+			return half_float::fetestexcept(FE_ALL_EXCEPT) == flags && std::all_of(z, z+57, [=](half h) { return comp(h, c); }); };
+		binary_test("array addition", [&](half a, half b) { return array(a, b, half_float::add, half_float::add, half_float::add, [](half x, half y) { return x+y; }); });
+		binary_test("array subtraction", [&](half a, half b) { return array(a, b, half_float::sub, half_float::sub, half_float::sub, [](half x, half y) { return x-y; }); });
+		binary_test("array multiplication", [&](half a, half b) { return array(a, b, half_float::mul, half_float::mul, half_float::mul, [](half x, half y) { return x*y; }); });
+		binary_test("array division", [&](half a, half b) { return array(a, b, half_float::div, half_float::div, half_float::div, [](half x, half y) { return x/y; }); });
+
+		//test array reductions
+		binary_test("dot", [](half a, half b) -> bool {
+			half x[37], y[37]; std::fill_n(x, 37, a); std::fill_n(y, 37, b);
+			double d = half_cast<double>(a) * half_cast<double>(b) * 37.0, e = half_float::dot<half_float::accumulate_exact>(x, y, 37);
+			float f = half_float::dot(x, y, 37);
+			return (std::isnan(d) && std::isnan(e) && std::isnan(f)) || (e == d && (f == d || std::abs(f-d) <= std::abs(d)*37.0*std::numeric_limits<float>::epsilon())); });
+		binary_test("exact dot", [](half a, half b) -> bool {
+			half x[37], y[37]; std::fill_n(x, 37, a); std::fill_n(y, 37, b);
+			return comp(half_float::exact_dot(x, y, 37), half_cast<half>(half_cast<double>(a)*half_cast<double>(b)*37.0)); });
+		binary_test("exact sum", [](half a, half b) -> bool {
+			half x[74]; std::fill_n(x, 37, a); std::fill_n(x+37, 37, b);
+			half_float::exact_accumulator acc;
+			for(unsigned int i=0; i<37; ++i)
+				(acc += b) -= -a;
+			half h = half_float::exact_sum(x, 74);
+			return comp(h, acc.value()) && compz(h, half_cast<half>(half_cast<double>(a)*37.0+half_cast<double>(b)*37.0)) && 
+				(h != 0.0f || signbit(h) == ((signbit(a) && signbit(b)) || (std::numeric_limits<half>::round_style == std::round_toward_neg_infinity && (signbit(a) || signbit(b))))); });
+		simple_test("exact reductions", []() -> bool {
+			auto fsum = [](const std::vector<double> &v) -> double {		//correctly rounded sum by Shewchuk's algorithm
+				std::vector<double> p;
+				for(double x : v)
+				{
+					std::size_t i = 0;
+					for(double y : p)
+					{
+						if(std::abs(x) < std::abs(y))
+							std::swap(x, y);
+						double hi = x + y, lo = y - (hi-x);
+						if(lo != 0.0)
+							p[i++] = lo;
+						x = hi;
+					}
+					p.resize(i);
+					p.push_back(x);
+				}
+				std::size_t n = p.size();
+				double hi = n ? p[--n] : 0.0, lo = 0.0;
+				while(n && lo == 0.0)
+				{
+					double x = hi, y = p[--n];
+					hi = x + y;
+					lo = y - (hi-x);
+				}
+				if(n && ((lo < 0.0 && p[n-1] < 0.0) || (lo > 0.0 && p[n-1] > 0.0)) && (hi+2.0*lo)-hi == 2.0*lo)
+					hi += 2.0 * lo;
+				return hi;
+			};
+			std::default_random_engine g;
+			std::uniform_int_distribution<std::uint16_t> dist(0, 0x7BFF);
+			for(std::size_t n : { 1, 7, 8, 33, 1000, 32769, 100000 })
+			{
+				std::vector<half> x(n), y(n);
+				std::vector<double> p(n);
+				for(std::size_t i=0; i<n; ++i)
+				{
+					x[i] = b2h(dist(g)|((i&1)<<15));
+					y[i] = b2h(dist(g)|((dist(g)&1)<<15));
+					p[i] = half_cast<double>(x[i]) * half_cast<double>(y[i]);
+				}
+				double d = half_float::dot<half_float::accumulate_exact>(x.data(), y.data(), n);
+				half h = half_float::exact_dot(x.data(), y.data(), n), s = half_float::exact_sum(x.data(), n);
+				std::vector<double> v, w;
+				half_float::exact_accumulator acc;
+				for(std::size_t i=0; i<n; ++i)
+				{
+					v.push_back(half_cast<double>(x[i]));
+					if(i%3 == 0)
+					{
+						w.push_back(v.back());
+						acc += x[i];
+					}
+				}
+				if(d != fsum(p) || !comp(h, half_cast<half>(d)) || !comp(s, half_cast<half>(fsum(v))) || acc.to_double() != fsum(w))
+					return false;
+				std::reverse(x.begin(), x.end());
+				std::reverse(y.begin(), y.end());
+				if(d != half_float::dot<half_float::accumulate_exact>(x.data(), y.data(), n) || h2b(h) != h2b(half_float::exact_dot(x.data(), y.data(), n)) || 
+					h2b(s) != h2b(half_float::exact_sum(x.data(), n)))
+					return false;
+			}
+			return true; });
+		simple_test("vector operations", []() -> bool {
+			std::default_random_engine g;
+			std::uniform_int_distribution<std::uint16_t> dist(0x2C00, 0x4BFF);
+			for(std::size_t n : { 1, 7, 8, 33, 1000, 4099 })
+			{
+				std::vector<half> x(n), y(n);
+				std::vector<float> fy(n);
+				std::vector<double> a(n), q(n);
+				for(std::size_t i=0; i<n; ++i)
+				{
+					x[i] = b2h(dist(g)|((dist(g)&1)<<15));
+					y[i] = b2h(dist(g)|((dist(g)&1)<<15));
+					fy[i] = y[i];
+					a[i] = std::abs(half_cast<double>(x[i]));
+					q[i] = a[i] * a[i];
+				}
+				half alpha = b2h(dist(g));
+				std::vector<half> hy(y), hs(x);
+				std::vector<float> ry(fy);
+				half_float::axpy(alpha, x.data(), hy.data(), n);
+				half_float::axpy(static_cast<float>(alpha), x.data(), ry.data(), n);
+				half_float::scal(alpha, hs.data(), n);
+				for(std::size_t i=0; i<n; ++i)
+					if(h2b(hy[i]) != h2b(fma(alpha, x[i], y[i])) || h2b(hs[i]) != h2b(alpha*x[i]) || 
+						std::abs(ry[i]-(static_cast<float>(alpha)*static_cast<float>(x[i])+fy[i])) > 
+						2.0f*std::numeric_limits<float>::epsilon()*(std::abs(static_cast<float>(alpha)*static_cast<float>(x[i]))+std::abs(fy[i])))
+						return false;
+				double sa = std::accumulate(a.begin(), a.end(), 0.0), sq = std::sqrt(std::accumulate(q.begin(), q.end(), 0.0));		//exact for this range
+				if(half_float::asum<half_float::accumulate_exact>(x.data(), n) != sa || h2b(half_float::exact_asum(x.data(), n)) != h2b(half_cast<half>(sa)) || 
+					std::abs(half_float::asum(x.data(), n)-sa) > n*std::numeric_limits<float>::epsilon()*sa || 
+					half_float::nrm2<half_float::accumulate_exact>(x.data(), n) != sq || h2b(half_float::exact_nrm2(x.data(), n)) != h2b(half_cast<half>(sq)) || 
+					std::abs(half_float::nrm2(x.data(), n)-sq) > n*std::numeric_limits<float>::epsilon()*sq)
+					return false;
+				std::size_t imax = 0, imin = 0;
+				for(std::size_t i=1; i<n; ++i)
+				{
+					imax = (a[i]>a[imax]) ? i : imax;
+					imin = (a[i]<a[imin]) ? i : imin;
+				}
+				if(half_float::iamax(x.data(), n) != imax || half_float::iamin(x.data(), n) != imin)
+					return false;
+				x[n/2] = std::numeric_limits<half>::quiet_NaN();
+				if(half_float::iamax(x.data(), n) != n/2 || half_float::iamin(x.data(), n) != n/2 || !std::isnan(half_float::nrm2(x.data(), n)) || 
+					!isnan(half_float::exact_asum(x.data(), n)))
+					return false;
+				x[n/3] = std::numeric_limits<half>::infinity();
+				if(!isinf(half_float::exact_nrm2(x.data(), n)))
+					return false;
+			}
+			std::vector<half> big(4, std::numeric_limits<half>::max()), tiny(4, std::numeric_limits<half>::denorm_min());
+			return isinf(half_float::exact_nrm2(big.data(), 4)) && half_float::nrm2(big.data(), 4) == 131008.0f && 
+				h2b(half_float::exact_nrm2(tiny.data(), 4)) == 2 && half_float::iamax(big.data(), 0) == 0; });
+		simple_test("min max reductions", []() -> bool {
+			std::default_random_engine g;
+			std::uniform_int_distribution<std::uint16_t> dist(0, 0xFFFF);
+			for(std::size_t n : { 0, 1, 7, 8, 33, 1000, 4099 })
+			{
+				for(int mode=0; mode<4; ++mode)
+				{
+					std::vector<half> x(n);
+					for(half &h : x)
+					{
+						std::uint16_t b = dist(g);
+						h = b2h((mode==1) ? (b&0x8000) : (mode==2 && (b&3)) ? (0x7E00|(b&0x8000)) : (mode==3) ? (0xFE00|(b&0x1FF)) : b);
+						if(isnan(h))
+							h = b2h(h2b(h)|0x200);
+					}
+					half lo = std::numeric_limits<half>::quiet_NaN(), hi = lo;
+					for(half h : x)
+					{
+						lo = fmin(lo, h);
+						hi = fmax(hi, h);
+					}
+					std::size_t imin = 0, imax = 0;
+					if(!isnan(lo))
+					{
+						for(; h2b(x[imin])!=h2b(lo); ++imin) ;
+						for(; h2b(x[imax])!=h2b(hi); ++imax) ;
+					}
+					if(!comp(half_float::reduce_min(x.data(), n), lo) || !comp(half_float::reduce_max(x.data(), n), hi) || 
+						half_float::argmin(x.data(), n) != imin || half_float::argmax(x.data(), n) != imax)
+						return false;
+				}
+			}
+			std::uniform_int_distribution<std::uint16_t> finite(0, 0x5BFF);
+			for(std::size_t n : { 1, 7, 8, 33, 1000, 4099, 100000 })
+			{
+				std::vector<half> x(n);
+				double sum = 0.0, mag = 0.0;
+				for(half &h : x)
+				{
+					h = b2h(finite(g)|(dist(g)&0x8000));
+					sum += half_cast<double>(h);
+					mag += std::abs(half_cast<double>(h));
+				}
+				if(half_float::sum<half_float::accumulate_exact>(x.data(), n) != sum || 
+					std::abs(half_float::sum(x.data(), n)-sum) > n*std::numeric_limits<float>::epsilon()*mag || 
+					std::abs(half_float::pairwise_sum(x.data(), n)-sum) > (256+std::log2(n))*std::numeric_limits<float>::epsilon()*mag)
+					return false;
+			}
+			return true; });
+		simple_test("deterministic reductions", []() -> bool {
+			std::default_random_engine g;
+			std::uniform_int_distribution<std::uint16_t> dist(0, 0xFFFF), finite(0, 0x4BFF);
+			for(std::size_t n : { 0, 1, 255, 257, 65536, 65537, 300001 })
+			{
+				std::vector<half> x(n), y(n);
+				double sum = 0.0, dot = 0.0, sqr = 0.0, mag = 0.0;
+				for(std::size_t i=0; i<n; ++i)
+				{
+					x[i] = b2h(finite(g)|(dist(g)&0x8000));
+					y[i] = b2h(finite(g)|(dist(g)&0x8000));
+					sum += half_cast<double>(x[i]);
+					dot += half_cast<double>(x[i]) * half_cast<double>(y[i]);
+					sqr += half_cast<double>(x[i]) * half_cast<double>(x[i]);
+					mag += std::abs(half_cast<double>(x[i])) + std::abs(half_cast<double>(x[i])*half_cast<double>(y[i]));
+				}
+				float s = half_float::sum<half_float::accumulate_pairwise>(x.data(), n);
+				float d = half_float::dot<half_float::accumulate_pairwise>(x.data(), y.data(), n);
+				float r = half_float::nrm2<half_float::accumulate_pairwise>(x.data(), n);
+				double e = half_float::sum<half_float::accumulate_exact>(x.data(), n);
+				double ed = half_float::dot<half_float::accumulate_exact>(x.data(), y.data(), n);
+				double bound = (256+std::log2(n+1)) * std::numeric_limits<float>::epsilon();
+				if(std::abs(s-sum) > bound*mag || std::abs(d-dot) > bound*mag || std::abs(r-std::sqrt(sqr)) > bound*std::sqrt(sqr) ||
+					e != sum || std::abs(ed-dot) > n*std::numeric_limits<double>::epsilon()*mag || half_float::pairwise_sum(x.data(), n) != s)
+					return false;
+			#if HALF_ENABLE_OPENMP
+				int threads = omp_get_max_threads();
+				for(int t=1; t<=std::max(threads, 4); ++t)
+				{
+					omp_set_num_threads(t);
+					bool same = half_float::sum<half_float::accumulate_pairwise>(x.data(), n) == s &&
+						half_float::dot<half_float::accumulate_pairwise>(x.data(), y.data(), n) == d &&
+						half_float::nrm2<half_float::accumulate_pairwise>(x.data(), n) == r &&
+						half_float::sum<half_float::accumulate_exact>(x.data(), n) == e &&
+						half_float::dot<half_float::accumulate_exact>(x.data(), y.data(), n) == ed;
+					omp_set_num_threads(threads);
+					if(!same)
+						return false;
+				}
+			#endif
+			}
+			return true; });
+		simple_test("prefix sums", []() -> bool {
+			std::default_random_engine g;
+			std::uniform_int_distribution<std::uint16_t> dist(0, 0xFFFF), finite(0, 0x4BFF);
+			for(std::size_t n : { 0, 1, 7, 8, 9, 100, 4099, 65537, 200003 })
+			{
+				std::vector<half> x(n), hi(n), he(n), xi(n), xe(n), in(n);
+				std::vector<float> fi(n), fe(n), ff(n);
+				for(half &h : x)
+					h = b2h(finite(g)|(dist(g)&0x8000));
+				half_float::inclusive_scan(x.data(), hi.data(), n);
+				half_float::exclusive_scan(x.data(), he.data(), n);
+				half_float::inclusive_scan(x.data(), fi.data(), n);
+				half_float::exclusive_scan(x.data(), fe.data(), n);
+				half_float::inclusive_scan<half_float::accumulate_exact>(x.data(), xi.data(), n);
+				half_float::exclusive_scan<half_float::accumulate_exact>(x.data(), xe.data(), n);
+				half_float::inclusive_scan<half_float::accumulate_exact>(x.data(), ff.data(), n);
+				in = x;
+				half_float::exclusive_scan<half_float::accumulate_exact>(in.data(), in.data(), n);
+				double sum = 0.0, mag = 0.0;
+				for(std::size_t i=0; i<n; ++i)
+				{
+					double prev = sum, bound = (i+1) * std::numeric_limits<float>::epsilon() * (mag+=std::abs(half_cast<double>(x[i])));
+					sum += half_cast<double>(x[i]);
+					if(std::abs(fi[i]-sum) > bound || std::abs(fe[i]-prev) > bound ||
+						std::abs(half_cast<double>(hi[i])-sum) > bound+std::abs(sum)*std::numeric_limits<half>::epsilon() ||
+						!comp(xi[i], half_cast<half>(sum)) || !comp(xe[i], half_cast<half>(prev)) || !comp(in[i], xe[i]) || ff[i] != static_cast<float>(sum))
+						return false;
+				}
+				if(n && (half_float::signbit(he[0]) || half_float::signbit(xe[0]) || fe[0] != 0.0f))
+					return false;
+			#if HALF_ENABLE_OPENMP
+				int threads = omp_get_max_threads();
+				for(int t=2; t<=std::max(threads, 4); ++t)
+				{
+					std::vector<half> h(n), e(n);
+					omp_set_num_threads(t);
+					half_float::inclusive_scan(x.data(), h.data(), n);
+					half_float::exclusive_scan<half_float::accumulate_exact>(x.data(), e.data(), n);
+					omp_set_num_threads(threads);
+					if(!std::equal(h.begin(), h.end(), hi.begin(), comp) || !std::equal(e.begin(), e.end(), xe.begin(), comp))
+						return false;
+				}
+			#endif
+			}
+			half nz = b2h(0x8000), z[4] = { nz, nz, nz, nz }, r[4];
+			half_float::inclusive_scan<half_float::accumulate_exact>(z, r, 4);
+			return std::all_of(r, r+4, [](half h) { return half_float::signbit(h); }); });
+
+		//test matrix operations
+		simple_test("gemm", []() -> bool {
+			std::default_random_engine g;
+			std::uniform_real_distribution<float> dist(-2.0f, 2.0f);
+			for(std::size_t m : { 1, 17, 100, 400 }) for(std::size_t n : { 1, 7, 250 }) for(std::size_t k : { 0, 3, 300 })
+			{
+				std::vector<half> a(m*k), b(k*n), hc(m*n);
+				for(half &h : a)
+					h = half_cast<half>(dist(g));
+				for(half &h : b)
+					h = half_cast<half>(dist(g));
+				for(half &h : hc)
+					h = half_cast<half>(dist(g));
+				for(int layout=0; layout<4; ++layout) for(int trans=0; trans<4; ++trans)
+				{
+					half_float::matrix_layout lay = (layout&1) ? half_float::column_major : half_float::row_major;
+					bool ta = trans & 1, tb = trans & 2, col = lay == half_float::column_major;
+					std::size_t lda = (col!=ta) ? m : k, ldb = (col!=tb) ? k : n, ldc = col ? m : n;
+					float alpha = 1.5f, beta = (layout&2) ? 0.0f : -0.5f;
+					std::vector<half> c(hc);
+					std::vector<float> fc(hc.begin(), hc.end());
+					half_float::gemm(lay, ta ? half_float::transpose : half_float::no_transpose, tb ? half_float::transpose : half_float::no_transpose, 
+						m, n, k, alpha, a.data(), std::max<std::size_t>(lda, 1), b.data(), std::max<std::size_t>(ldb, 1), beta, fc.data(), std::max<std::size_t>(ldc, 1));
+					half_float::gemm(lay, ta ? half_float::transpose : half_float::no_transpose, tb ? half_float::transpose : half_float::no_transpose, 
+						m, n, k, alpha, a.data(), std::max<std::size_t>(lda, 1), b.data(), std::max<std::size_t>(ldb, 1), beta, c.data(), std::max<std::size_t>(ldc, 1));
+					for(std::size_t i=0; i<m; ++i)
+						for(std::size_t j=0; j<n; ++j)
+						{
+							double sum = 0.0, mag = 0.0;
+							for(std::size_t l=0; l<k; ++l)
+							{
+								double p = half_cast<double>(a[(col!=ta) ? (i+l*lda) : (i*lda+l)]) * half_cast<double>(b[(col!=tb) ? (l+j*ldb) : (l*ldb+j)]);
+								sum += p;
+								mag += std::abs(p);
+							}
+							std::size_t ic = col ? (i+j*ldc) : (i*ldc+j);
+							double ref = alpha*sum + ((beta!=0.0f) ? beta*half_cast<double>(hc[ic]) : 0.0);
+							if(std::abs(fc[ic]-ref) > (alpha*mag+std::abs(ref)+1.0)*(k+2)*std::numeric_limits<float>::epsilon() || 
+								std::abs(half_cast<double>(c[ic])-fc[ic]) > std::max(std::abs(fc[ic])*static_cast<float>(std::numeric_limits<half>::epsilon()), 
+								static_cast<float>(std::numeric_limits<half>::denorm_min())))
+								return false;
+						}
+				}
+			}
+			std::vector<half> big(16*16, half_cast<half>(300.0f)), r(16*16);
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			half_float::gemm(half_float::column_major, half_float::no_transpose, half_float::no_transpose, 16, 16, 1, 
+				1.0f, big.data(), 16, big.data(), 1, 0.0f, r.data(), 16);
+			return half_float::fetestexcept(FE_OVERFLOW|FE_UNDERFLOW) == FE_OVERFLOW && std::all_of(r.begin(), r.end(), [](half h) { return isinf(h); }); });
+		simple_test("gemv", []() -> bool {
+			std::default_random_engine g;
+			std::uniform_real_distribution<float> dist(-2.0f, 2.0f);
+			for(std::size_t m : { 1, 5, 100, 1500 }) for(std::size_t n : { 1, 3, 33, 700 })
+			{
+				std::vector<half> a(m*n);
+				for(half &h : a)
+					h = half_cast<half>(dist(g));
+				std::vector<float> x(std::max(m, n)), y(x.size());
+				for(float &f : x)
+					f = dist(g);
+				for(float &f : y)
+					f = dist(g);
+				for(int layout=0; layout<4; ++layout) for(int trans=0; trans<2; ++trans)
+				{
+					half_float::matrix_layout lay = (layout&1) ? half_float::column_major : half_float::row_major;
+					bool col = lay == half_float::column_major;
+					std::size_t lda = col ? m : n, rows = trans ? n : m, cols = trans ? m : n;
+					float alpha = 1.5f, beta = (layout&2) ? 0.0f : -0.5f;
+					std::vector<float> r(y);
+					if(beta == 0.0f)
+						std::fill(r.begin(), r.end(), std::numeric_limits<float>::quiet_NaN());
+					half_float::gemv(lay, trans ? half_float::transpose : half_float::no_transpose, m, n, alpha, a.data(), lda, x.data(), beta, r.data());
+					for(std::size_t i=0; i<rows; ++i)
+					{
+						double sum = 0.0, mag = 0.0;
+						for(std::size_t j=0; j<cols; ++j)
+						{
+							std::size_t ia = trans ? j : i, ja = trans ? i : j;
+							double p = half_cast<double>(a[col ? (ia+ja*lda) : (ia*lda+ja)]) * x[j];
+							sum += p;
+							mag += std::abs(p);
+						}
+						double ref = alpha*sum + ((beta!=0.0f) ? beta*y[i] : 0.0);
+						if(!(std::abs(r[i]-ref) <= (alpha*mag+std::abs(ref)+1.0)*(cols+2)*std::numeric_limits<float>::epsilon()))
+							return false;
+					}
+				}
+			}
+			return true; });
+
+		//test neural network operations
+		simple_test("softmax", []() -> bool {
+			std::default_random_engine g;
+			std::normal_distribution<float> dist(0.0f, 4.0f);
+			for(std::size_t m : { 1, 3, 70 }) for(std::size_t n : { 1, 2, 7, 16, 33, 1000, 5000 })
+			{
+				std::vector<half> x(m*n), p(m*n), l(m*n), in;
+				for(half &h : x)
+					h = half_cast<half>(dist(g));
+				half_float::softmax(x.data(), p.data(), m, n);
+				half_float::log_softmax(x.data(), l.data(), m, n);
+				for(std::size_t i=0; i<m; ++i)
+				{
+					double max = -std::numeric_limits<double>::infinity(), sum = 0.0;
+					for(std::size_t j=0; j<n; ++j)
+						max = std::max(max, half_cast<double>(x[i*n+j]));
+					for(std::size_t j=0; j<n; ++j)
+						sum += std::exp(half_cast<double>(x[i*n+j])-max);
+					for(std::size_t j=0; j<n; ++j)
+					{
+						double d = half_cast<double>(x[i*n+j]) - max;
+						if(std::abs(h2b(p[i*n+j])-h2b(half_cast<half>(std::exp(d)/sum))) > 1 ||
+							std::abs(h2b(l[i*n+j])-h2b(half_cast<half>(d-std::log(sum)))) > 1)
+							return false;
+					}
+				}
+				in = x;
+				half_float::softmax(in.data(), in.data(), m, n);
+				if(!std::equal(in.begin(), in.end(), p.begin(), comp))
+					return false;
+			}
+			half x[] = { half(1.0f), std::numeric_limits<half>::quiet_NaN(), half(2.0f) }, y[3];
+			half_float::softmax(x, y, 3);
+			if(!std::all_of(y, y+3, [](half h) { return isnan(h); }))
+				return false;
+			x[1] = -std::numeric_limits<half>::infinity();
+			half_float::softmax(x, y, 3);
+			if(!comp(y[1], half(0.0f)) || std::abs(half_cast<double>(y[0])+half_cast<double>(y[2])-1.0) > 1e-3)
+				return false;
+			half_float::log_softmax(x, y, 3);
+			return comp(y[1], -std::numeric_limits<half>::infinity()) && comp(y[2], half_cast<half>(-std::log1p(std::exp(-1.0)))); });
+		simple_test("layer norm", []() -> bool {
+			std::default_random_engine g;
+			std::normal_distribution<float> dist(3.0f, 2.0f);
+			for(std::size_t m : { 1, 3, 70 }) for(std::size_t n : { 1, 2, 7, 16, 33, 1000 })
+			{
+				std::vector<half> x(m*n), gamma(n), beta(n), l(m*n), r(m*n), in;
+				for(half &h : x)
+					h = half_cast<half>(dist(g));
+				for(std::size_t j=0; j<n; ++j)
+				{
+					gamma[j] = half_cast<half>(dist(g));
+					beta[j] = half_cast<half>(dist(g));
+				}
+				half_float::layer_norm(x.data(), gamma.data(), beta.data(), l.data(), m, n, 1e-5f);
+				half_float::rms_norm(x.data(), nullptr, r.data(), m, n, 1e-5f);
+				for(std::size_t i=0; i<m; ++i)
+				{
+					double mean = 0.0, var = 0.0, sqr = 0.0;
+					for(std::size_t j=0; j<n; ++j)
+						mean += half_cast<double>(x[i*n+j]);
+					mean /= n;
+					for(std::size_t j=0; j<n; ++j)
+					{
+						double v = half_cast<double>(x[i*n+j]);
+						var += (v-mean) * (v-mean);
+						sqr += v * v;
+					}
+					double ls = 1.0 / std::sqrt(var/n+1e-5), rs = 1.0 / std::sqrt(sqr/n+1e-5);
+					for(std::size_t j=0; j<n; ++j)
+					{
+						double v = half_cast<double>(x[i*n+j]), s = (v-mean) * ls * half_cast<double>(gamma[j]), b = half_cast<double>(beta[j]);
+						if(std::abs(half_cast<double>(l[i*n+j])-(s+b)) > 1e-3*(std::abs(s)+std::abs(b)) + 1e-6 ||
+							std::abs(h2b(r[i*n+j])-h2b(half_cast<half>(v*rs))) > 1)
+							return false;
+					}
+				}
+				in = x;
+				half_float::layer_norm(in.data(), gamma.data(), beta.data(), in.data(), m, n, 1e-5f);
+				if(!std::equal(in.begin(), in.end(), l.begin(), comp))
+					return false;
+				half_float::layer_norm(x.data(), nullptr, nullptr, l.data(), m, n, 1e-5f);
+				half_float::rms_norm(x.data(), gamma.data(), r.data(), m, n, 1e-5f);
+				for(std::size_t i=0; i<m*n; ++i)
+					if(isnan(l[i]) || isnan(r[i]))
+						return false;
+			}
+			half x[] = { half(1.0f), std::numeric_limits<half>::quiet_NaN(), half(2.0f) }, y[3];
+			half_float::layer_norm(x, nullptr, nullptr, y, 1, 3, 1e-5f);
+			if(!std::all_of(y, y+3, [](half h) { return isnan(h); }))
+				return false;
+			half_float::rms_norm(x, nullptr, y, 1, 3, 1e-5f);
+			if(!std::all_of(y, y+3, [](half h) { return isnan(h); }))
+				return false;
+			x[1] = half(1.0f);
+			x[2] = half(1.0f);
+			half_float::layer_norm(x, nullptr, nullptr, y, 1, 3, 1e-5f);
+			return std::all_of(y, y+3, [](half h) { return comp(h, half(0.0f)); }); });
+		simple_test("convolution", []() -> bool {
+			std::default_random_engine g;
+			std::normal_distribution<float> dist(0.0f, 1.0f);
+			for(auto padding : { half_float::valid_padding, half_float::same_padding })
+			for(std::size_t ci : { 1, 3 }) for(std::size_t co : { 1, 17 }) for(std::size_t h : { 1, 9 }) for(std::size_t w : { 7, 300 })
+			for(std::size_t kh : { 1, 3 }) for(std::size_t kw : { 1, 4 }) for(std::size_t s : { 1, 2 }) for(std::size_t d : { 1, 2 })
+			{
+				std::size_t ho = half_float::convolution_size(padding, h, kh, s, d), wo = half_float::convolution_size(padding, w, kw, s, d);
+				long py = 0, px = 0;
+				if(padding == half_float::same_padding)
+				{
+					py = std::max(static_cast<long>((ho-1)*s+(kh-1)*d+1)-static_cast<long>(h), 0L) / 2;
+					px = std::max(static_cast<long>((wo-1)*s+(kw-1)*d+1)-static_cast<long>(w), 0L) / 2;
+				}
+				std::vector<half> x(ci*h*w), f(co*ci*kh*kw), b(co), y(co*ho*wo+1, half(7.0f)), y1(co*ho*wo);
+				for(half &v : x)
+					v = half_cast<half>(dist(g));
+				for(half &v : f)
+					v = half_cast<half>(dist(g));
+				for(half &v : b)
+					v = half_cast<half>(dist(g));
+				half_float::conv2d(padding, ci, co, h, w, kh, kw, s, s, d, d, x.data(), f.data(), b.data(), y.data());
+				if(!comp(y.back(), half(7.0f)))
+					return false;
+				for(std::size_t o=0; o<co; ++o) for(std::size_t i=0; i<ho; ++i) for(std::size_t j=0; j<wo; ++j)
+				{
+					double sum = half_cast<double>(b[o]), mag = std::abs(sum);
+					for(std::size_t c=0; c<ci; ++c) for(std::size_t k=0; k<kh; ++k) for(std::size_t l=0; l<kw; ++l)
+					{
+						long iy = static_cast<long>(i*s+k*d) - py, ix = static_cast<long>(j*s+l*d) - px;
+						if(iy < 0 || ix < 0 || iy >= static_cast<long>(h) || ix >= static_cast<long>(w))
+							continue;
+						double p = half_cast<double>(f[((o*ci+c)*kh+k)*kw+l]) * half_cast<double>(x[(c*h+iy)*w+ix]);
+						sum += p;
+						mag += std::abs(p);
+					}
+					if(std::abs(half_cast<double>(y[(o*ho+i)*wo+j])-sum) > 1e-3*std::abs(sum) + 1e-6*mag + 6e-8)
+						return false;
+				}
+				if(h == 1 && kh == 1)
+				{
+					half_float::conv1d(padding, ci, co, w, kw, s, d, x.data(), f.data(), b.data(), y1.data());
+					if(!std::equal(y1.begin(), y1.end(), y.begin(), comp))
+						return false;
+				}
+			}
+			return true; });
+		simple_test("attention", []() -> bool {
+			std::default_random_engine g;
+			std::normal_distribution<float> dist(0.0f, 1.5f);
+			for(std::size_t heads : { 1, 3 }) for(std::size_t m : { 1, 33, 100 }) for(std::size_t n : { 7, 65, 200 }) for(std::size_t d : { 3, 8, 64 })
+			for(bool causal : { false, true })
+			{
+				if(causal && n < m)
+					continue;
+				std::vector<half> q(heads*m*d), k(heads*n*d), v(heads*n*d), o(heads*m*d+1, half(7.0f));
+				for(half &h : q)
+					h = half_cast<half>(dist(g));
+				for(half &h : k)
+					h = half_cast<half>(dist(g));
+				for(half &h : v)
+					h = half_cast<half>(dist(g));
+				double scale = 1.0 / std::sqrt(static_cast<double>(d));
+				half_float::attention(heads, m, n, d, q.data(), k.data(), v.data(), o.data(), static_cast<float>(scale), causal);
+				if(!comp(o.back(), half(7.0f)))
+					return false;
+				for(std::size_t h=0; h<heads; ++h) for(std::size_t i=0; i<m; ++i)
+				{
+					std::size_t keys = causal ? (i+n-m+1) : n;
+					std::vector<double> p(keys);
+					double max = -std::numeric_limits<double>::infinity(), sum = 0.0;
+					for(std::size_t j=0; j<keys; ++j)
+					{
+						for(std::size_t t=0; t<d; ++t)
+							p[j] += half_cast<double>(q[(h*m+i)*d+t]) * half_cast<double>(k[(h*n+j)*d+t]);
+						max = std::max(max, p[j]*=scale);
+					}
+					for(double &x : p)
+						sum += x = std::exp(x-max);
+					for(std::size_t t=0; t<d; ++t)
+					{
+						double ref = 0.0, mag = 0.0;
+						for(std::size_t j=0; j<keys; ++j)
+						{
+							ref += p[j] * half_cast<double>(v[(h*n+j)*d+t]);
+							mag += p[j] * std::abs(half_cast<double>(v[(h*n+j)*d+t]));
+						}
+						if(std::abs(half_cast<double>(o[(h*m+i)*d+t])-ref/sum) > 1e-3*mag/sum)
+							return false;
+					}
+				}
+			}
+			return true; });
+		simple_test("activations", []() -> bool {
+			std::vector<half> x(0x10000), y(0x10000), z(0x10000);
+			for(unsigned int i=0; i<0x10000; ++i)
+				x[i] = b2h(i);
+			auto check = [&](void(*batch)(const half*,half*,std::size_t), half(*scalar)(half)) -> bool {
+				batch(x.data()+1, y.data(), x.size()-1);
+				z = x;
+				batch(z.data(), z.data(), z.size());
+				for(std::size_t i=0; i<x.size(); ++i)
+					if(!comp(z[i], scalar(x[i])) || (i && !comp(y[i-1], z[i])))
+						return false;
+				return true; };
+			return check(half_float::relu_array, half_float::relu) && check(half_float::sigmoid_array, half_float::sigmoid) && 
+				check(half_float::silu_array, half_float::silu) && check(half_float::gelu_array, half_float::gelu); });
+
+		simple_test("optimizers", []() -> bool {
+			std::default_random_engine g;
+			std::normal_distribution<float> dist(0.0f, 1.0f);
+			std::size_t n = 1003;
+			std::vector<half> grad(n), h(n), s(n);
+			std::vector<float> w0(n);
+			for(std::size_t i=0; i<n; ++i)
+			{
+				grad[i] = half_cast<half>(dist(g));
+				w0[i] = std::ldexp(dist(g), static_cast<int>(i%40)-30);
+			}
+			for(int k=0; k<4; ++k)
+			{
+				std::vector<float> w(w0), m(n), v(n), w1(w0), m1(n), v1(n);
+				std::vector<double> wd(w0.begin(), w0.end()), md(n), vd(n);
+				for(unsigned long t=1; t<=3; ++t)
+				{
+					double c1 = 1.0 - std::pow(0.9, t), c2 = 1.0 - std::pow(0.999, t);
+					for(std::size_t i=0; i<n; ++i)
+					{
+						double x = half_cast<double>(grad[i]);
+						double d = x + 0.1*wd[i];
+						if(k == 0)
+							wd[i] -= 0.01 * d;
+						else if(k == 1)
+							wd[i] -= 0.01 * (d+0.9*(md[i]=0.9*md[i]+d));
+						else if(k == 3)
+							wd[i] -= 0.001 * (md[i]=0.9*md[i]+d);
+						else
+						{
+							md[i] = 0.9*md[i] + 0.1*x;
+							vd[i] = 0.999*vd[i] + 0.001*x*x;
+							wd[i] = wd[i]*(1.0-0.01*0.1) - 0.01/c1*md[i]/(std::sqrt(vd[i]/c2)+1e-8);
+						}
+					}
+					if(k == 0)
+					{
+						sgd_step(0.01f, 0.1f, grad.data(), w.data(), h.data(), n);
+						sgd_step(0.01f, 0.1f, grad.data(), w1.data(), s.data(), n, half_float::stochastic_rounding, t);
+					}
+					else if(k == 1)
+					{
+						momentum_step(0.01f, 0.9f, 0.1f, true, grad.data(), w.data(), m.data(), h.data(), n);
+						momentum_step(0.01f, 0.9f, 0.1f, true, grad.data(), w1.data(), m1.data(), s.data(), n, half_float::stochastic_rounding, t);
+					}
+					else if(k == 3)
+					{
+						momentum_step(0.001f, 0.9f, 0.1f, false, grad.data(), w.data(), m.data(), h.data(), n);
+						momentum_step(0.001f, 0.9f, 0.1f, false, grad.data(), w1.data(), m1.data(), s.data(), n, half_float::stochastic_rounding, t);
+					}
+					else
+					{
+						adam_step(0.01f, 0.9f, 0.999f, 1e-8f, 0.1f, t, grad.data(), w.data(), m.data(), v.data(), h.data(), n);
+						adam_step(0.01f, 0.9f, 0.999f, 1e-8f, 0.1f, t, grad.data(), w1.data(), m1.data(), v1.data(), s.data(), n, half_float::stochastic_rounding, t);
+					}
+				}
+				for(std::size_t i=0; i<n; ++i)
+				{
+					half lo = half_cast<half,std::round_toward_zero>(w1[i]), hi = nextafter(lo, copysign(std::numeric_limits<half>::infinity(), lo));
+					if(std::abs(w[i]-wd[i]) > 1e-5*std::abs(wd[i])+1e-9 || w[i] != w1[i] || !comp(h[i], half_cast<half>(w[i])) || 
+						!(comp(s[i], lo) || (half_cast<float>(lo) != w1[i] && comp(s[i], hi))))
+						return false;
+				}
+			}
+			std::vector<float> w(0x10000, 1.000244140625f);
+			grad.assign(w.size(), half_cast<half>(0.0f));
+			h.resize(w.size());
+			s.resize(w.size());
+			sgd_step(0.0f, 0.0f, grad.data(), w.data(), h.data(), w.size(), half_float::stochastic_rounding, 1);
+			sgd_step(0.0f, 0.0f, grad.data(), w.data(), s.data(), w.size(), half_float::stochastic_rounding, 1);
+			double mean = std::accumulate(h.begin(), h.end(), 0.0, [](double a, half b) { return a + half_cast<double>(b); }) / h.size();
+			bool same = std::equal(h.begin(), h.end(), s.begin(), comp);
+			std::fill(w.begin(), w.end(), 70000.0f);
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			sgd_step(0.0f, 0.0f, grad.data(), w.data(), h.data(), w.size());
+			return same && std::abs(mean-1.000244140625) < 1e-5 && half_float::fetestexcept(FE_OVERFLOW) && 
+				std::all_of(h.begin(), h.end(), [](half b) { return isinf(b); }); });
+
+		simple_test("loss scaling", []() -> bool {
+			std::vector<half> x(0x10000), y(0x10000), z(300017, half_cast<half>(1.0f)), w(z.size());
+			for(unsigned int i=0; i<0x10000; ++i)
+				x[i] = b2h(i);
+			for(float scale : { 0.5f, 0.1f, 3.0f, 0.0f })
+			{
+				half_float::feclearexcept(FE_ALL_EXCEPT);
+				bool finite = unscale_and_check(scale, x.data(), y.data(), 0x7C00), all = unscale_and_check(scale, x.data()+1, y.data(), x.size()-1);
+				int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+				for(unsigned int i=1; i<0x10000; ++i)
+				{
+					half h = half_cast<half>(half_cast<float>(x[i])*scale);
+					if(!comp(y[i-1], h) || (i<0x7C00 && !isfinite(h) && finite))
+						return false;
+				}
+				if(all || finite != (scale<2.0f) || all_finite(y.data(), 0x7BFF) != finite || all_finite(y.data(), 0x7C00) || 
+					flags != ((scale==0.0f) ? 0 : (scale<2.0f) ? (FE_UNDERFLOW|FE_INEXACT) : (FE_OVERFLOW|FE_INEXACT)))
+					return false;
+			}
+			for(std::size_t i : { 0, 7, 31, 32, 100, 65535, 65536, 300000, 300016 })
+			{
+				z[i] = std::numeric_limits<half>::infinity();
+				bool found = all_finite(z.data(), z.size()) || !all_finite(z.data(), i);
+				z[i] = std::numeric_limits<half>::quiet_NaN();
+				found = found || all_finite(z.data(), z.size());
+				z[i] = std::numeric_limits<half>::max();
+				if(found || !all_finite(z.data(), z.size()) || unscale_and_check(2.0f, z.data(), w.data(), i+1))
+					return false;
+				z[i] = half_cast<half>(1.0f);
+			}
+			return all_finite(z.data(), 0) && unscale_and_check(1.0f, z.data(), z.data(), z.size()) && std::all_of(z.begin(), z.end(), 
+				[](half h) { return h == half_cast<half>(1.0f); }); });
+		simple_test("classification masks", []() -> bool {
+			std::vector<half> x(0x10000), y(0x10000);
+			std::vector<int> c(0x10001, -1);
+			std::unique_ptr<bool[]> r(new bool[0x10001]);
+			for(unsigned int i=0; i<0x10000; ++i)
+			{
+				x[i] = b2h(i);
+				y[i] = b2h((i*40503)&0xFFFF);
+			}
+			auto check = [&](std::size_t n, std::function<bool(std::size_t)> f) -> bool {
+				for(std::size_t i=0; i<n; ++i)
+					if(r[i] != f(i))
+						return false;
+				return true; };
+			r[0x10000] = true;
+			fpclassify_array(x.data(), c.data(), 0x10000);
+			isfinite_array(x.data(), r.get(), 0x10000);
+			bool pass = c.back() == -1 && check(0x10000, [&](std::size_t i) { return isfinite(x[i]) && c[i] == fpclassify(x[i]); });
+			isinf_array(x.data()+1, r.get(), 0xFFFF);
+			pass = pass && check(0xFFFF, [&](std::size_t i) { return isinf(x[i+1]); });
+			isnan_array(x.data(), r.get(), 0x10000);
+			pass = pass && check(0x10000, [&](std::size_t i) { return isnan(x[i]); });
+			isnormal_array(x.data(), r.get(), 0x10000);
+			pass = pass && check(0x10000, [&](std::size_t i) { return isnormal(x[i]); });
+			signbit_array(x.data(), r.get(), 0x10000);
+			pass = pass && check(0x10000, [&](std::size_t i) { return signbit(x[i]); });
+			isgreater_array(x.data(), y.data(), r.get(), 0x10000);
+			pass = pass && check(0x10000, [&](std::size_t i) { return isgreater(x[i], y[i]); });
+			isgreaterequal_array(x.data(), y.data(), r.get(), 0x10000);
+			pass = pass && check(0x10000, [&](std::size_t i) { return isgreaterequal(x[i], y[i]); });
+			isless_array(x.data(), y.data(), r.get(), 0x10000);
+			pass = pass && check(0x10000, [&](std::size_t i) { return isless(x[i], y[i]); });
+			islessequal_array(x.data(), y.data(), r.get(), 0x10000);
+			pass = pass && check(0x10000, [&](std::size_t i) { return islessequal(x[i], y[i]); });
+			islessgreater_array(x.data(), y.data(), r.get(), 0x10000);
+			pass = pass && check(0x10000, [&](std::size_t i) { return islessgreater(x[i], y[i]); });
+			isunordered_array(x.data(), y.data(), r.get(), 0x10000);
+			pass = pass && check(0x10000, [&](std::size_t i) { return isunordered(x[i], y[i]); });
+			for(unsigned int bits : { 0x0000, 0x8000, 0x0001, 0xBC00, 0x7C00, 0xFC00, 0x7E00 })
+			{
+				half s = b2h(bits);
+				isgreater_array(x.data(), s, r.get(), 0x10000);
+				pass = pass && check(0x10000, [&](std::size_t i) { return isgreater(x[i], s); });
+				islessequal_array(x.data(), s, r.get(), 0x10000);
+				pass = pass && check(0x10000, [&](std::size_t i) { return islessequal(x[i], s); });
+				islessgreater_array(x.data(), s, r.get(), 0x10000);
+				pass = pass && check(0x10000, [&](std::size_t i) { return islessgreater(x[i], s); });
+			}
+			half_float::class_counts all = count_classes(x.data(), 0x10000), part = count_classes(x.data()+5, 0x7C00);
+			return pass && r[0x10000] && all.zero == 2 && all.subnormal == 0x7FE && all.normal == 0xF000 && all.infinite == 2 &&
+				all.nan == 0x7FE && all.negative == 0x8000 && part.zero == 0 && part.subnormal == 0x3FB && part.normal == 0x7800 &&
+				part.infinite == 1 && part.nan == 4 && part.negative == 0; });
+		simple_test("array rounding", []() -> bool {
+			std::vector<half> x(0x10000), y(0x10001, b2h(0x1234));
+			for(unsigned int i=0; i<0x10000; ++i)
+				x[i] = b2h(i);
+			auto round = [&](void(*op)(const half*, half*, std::size_t), half(*scalar)(half)) -> bool {
+				for(std::pair<std::size_t,std::size_t> r : { std::make_pair(0, 0x10000), std::make_pair(0, 3), std::make_pair(0x8000, 0x3C00),
+					std::make_pair(0x3C00, 0x2800), std::make_pair(0x7C00, 0x201), std::make_pair(0x7E00, 0x200) })
+				{
+					half_float::feclearexcept(FE_ALL_EXCEPT);
+					for(std::size_t i=0; i<r.second; ++i)
+						scalar(x[r.first+i]);
+					int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+					half_float::feclearexcept(FE_ALL_EXCEPT);
+					op(x.data()+r.first, y.data(), r.second);
+					if(half_float::fetestexcept(FE_ALL_EXCEPT) != flags || !comp(y.back(), b2h(0x1234)))
+						return false;
+					for(std::size_t i=0; i<r.second; ++i)
+						if(h2b(y[i]) != h2b(scalar(x[r.first+i])))
+							return false;
+				}
+				return true; };
+			auto convert = [&](void(*op16)(const half*, short*, std::size_t), void(*op32)(const half*, int*, std::size_t), long(*scalar)(half)) -> bool {
+				std::vector<short> s(0x10001);
+				std::vector<int> l(0x10001);
+				for(std::pair<std::size_t,std::size_t> r : { std::make_pair(0, 0x10000), std::make_pair(0, 0x7800), std::make_pair(0x8000, 0x7801),
+					std::make_pair(0x3800, 0x800), std::make_pair(0xB800, 0x800), std::make_pair(0x5000, 0x2C00) })
+				{
+					half_float::feclearexcept(FE_ALL_EXCEPT);
+					bool saturated = false;
+					for(std::size_t i=0; i<r.second; ++i)
+					{
+						long v = scalar(x[r.first+i]);
+						saturated = saturated || v < std::numeric_limits<short>::min() || v > std::numeric_limits<short>::max();
+					}
+					int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+					half_float::feclearexcept(FE_ALL_EXCEPT);
+					s[r.second] = 77;
+					op16(x.data()+r.first, s.data(), r.second);
+					int flags16 = half_float::fetestexcept(FE_ALL_EXCEPT);
+					half_float::feclearexcept(FE_ALL_EXCEPT);
+					l[r.second] = 77;
+					op32(x.data()+r.first, l.data(), r.second);
+					if(flags16 != (flags|(saturated ? FE_INVALID : 0)) || half_float::fetestexcept(FE_ALL_EXCEPT) != flags || s[r.second] != 77 || l[r.second] != 77)
+						return false;
+					for(std::size_t i=0; i<r.second; ++i)
+					{
+						long v = scalar(x[r.first+i]);
+						if(s[i] != std::min<long>(std::max<long>(v, std::numeric_limits<short>::min()), std::numeric_limits<short>::max()) || 
+							l[i] != std::min<long>(std::max<long>(v, std::numeric_limits<int>::min()), std::numeric_limits<int>::max()))
+							return false;
+					}
+				}
+				return true; };
+			return round(half_float::ceil_array, half_float::ceil) && round(half_float::floor_array, half_float::floor) &&
+				round(half_float::trunc_array, half_float::trunc) && round(half_float::round_array, half_float::round) &&
+				round(half_float::rint_array, half_float::rint) && round(half_float::nearbyint_array, half_float::nearbyint) &&
+				convert(half_float::lround_array, half_float::lround_array, half_float::lround) && 
+				convert(half_float::lrint_array, half_float::lrint_array, half_float::lrint); });
+
 		//test comparison operators
 		binary_except_test("equal", [](half a, half b) { return (a==b) == (half_cast<double>(a)==half_cast<double>(b)); });
 		binary_except_test("not equal", [](half a, half b) { return (a!=b) == (half_cast<double>(a)!=half_cast<double>(b)); });
@@ -247,6 +1068,11 @@ public:
 		binary_double_test("fdim", half_float::fdim, [](double x, double y) { return std::fdim(x, y); });
 		ternary_double_test("fma", half_float::fma, [](double x, double y, double z) { return std::fma(x, y, z); });
 	#endif
+		ternary_test("array fma", [](half a, half b, half c) -> bool {
+			half_float::feclearexcept(FE_ALL_EXCEPT); half d = fma(a, b, c); int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+			half x[19], y[19], z[19], w[57]; std::fill_n(x, 19, a); std::fill_n(y, 19, b); std::fill_n(z, 19, c); half_float::feclearexcept(FE_ALL_EXCEPT);
+			fma_array(x, y, z, w, 19); fma_array(x, b, z, w+19, 19); fma_array(x, y, c, w+38, 19);
+			return half_float::fetestexcept(FE_ALL_EXCEPT) == flags && std::all_of(w, w+57, [=](half h) { return comp(h, d); }); });
 
 		//test exponential functions
 		unary_reference_test("exp", half_float::exp);
@@ -287,8 +1113,82 @@ public:
 		unary_reference_test("lgamma", half_float::lgamma);
 		unary_reference_test("tgamma", half_float::tgamma);
 
+		//test activation functions
+		unary_test("relu", [](half arg) { return comp(relu(arg), (isnan(arg) || !signbit(arg)) ? arg : half(0.0f)); });
+		unary_test("sigmoid", [](half arg) { long double x = half_cast<double>(arg); 
+			return comp(sigmoid(arg), half_cast<half>(static_cast<double>(1.0L/(1.0L+std::exp(-x))))); });
+		unary_test("silu", [](half arg) { long double x = half_cast<double>(arg); 
+			return comp(silu(arg), isinf(arg) ? (signbit(arg) ? -half(0.0f) : arg) : half_cast<half>(static_cast<double>(x/(1.0L+std::exp(-x))))); });
+		unary_test("gelu", [](half arg) { long double x = half_cast<double>(arg); 
+			return comp(gelu(arg), isinf(arg) ? (signbit(arg) ? -half(0.0f) : arg) : half_cast<half>(static_cast<double>(0.5L*x*std::erfc(-x/std::sqrt(2.0L))))); });
+
+		//test hybrid rounding
+		auto hybrid = [](double d, half h) { unsigned int bits; return !half_float::detail::hybrid<std::numeric_limits<half>::round_style>(d, bits) || comp(b2h(bits), h); };
+		unary_test("hybrid exp", [&](half arg) { return hybrid(std::exp(half_cast<double>(arg)), exp(arg)); });
+		unary_test("hybrid log", [&](half arg) { return hybrid(std::log(half_cast<double>(arg)), log(arg)); });
+		unary_test("hybrid sin", [&](half arg) { return hybrid(std::sin(half_cast<double>(arg)), sin(arg)); });
+		unary_test("hybrid tanh", [&](half arg) { return hybrid(std::tanh(half_cast<double>(arg)), tanh(arg)); });
+
+		//test fast approximations
+		auto ulps = [](half a, half b) -> int { int x = h2b(a), y = h2b(b); return (isnan(a) || isnan(b)) ? ((isnan(a) && isnan(b)) ? 0 : 65536) : 
+			std::abs(((x&0x8000) ? -(x&0x7FFF) : x)-((y&0x8000) ? -(y&0x7FFF) : y)); };
+		#define FAST_TEST(func, ulp) unary_test("fast::" #func, [&](half arg) { return ulps(half_float::fast::func(arg), func(arg)) <= ulp; })
+		FAST_TEST(exp, 1);
+		FAST_TEST(exp2, 1);
+		FAST_TEST(expm1, 1);
+		FAST_TEST(log, 1);
+		FAST_TEST(log10, 1);
+		FAST_TEST(log2, 0);
+		FAST_TEST(log1p, 1);
+		FAST_TEST(sqrt, 0);
+		FAST_TEST(rsqrt, 0);
+		FAST_TEST(cbrt, 1);
+		FAST_TEST(sin, 1);
+		FAST_TEST(cos, 1);
+		FAST_TEST(tan, 1);
+		FAST_TEST(asin, 1);
+		FAST_TEST(acos, 1);
+		FAST_TEST(atan, 1);
+		FAST_TEST(sinh, 1);
+		FAST_TEST(cosh, 1);
+		FAST_TEST(tanh, 1);
+		FAST_TEST(asinh, 1);
+		FAST_TEST(acosh, 1);
+		FAST_TEST(atanh, 0);
+		FAST_TEST(erf, 1);
+		FAST_TEST(erfc, 1);
+		FAST_TEST(lgamma, 4);
+		FAST_TEST(tgamma, 1);
+		#undef FAST_TEST
+		binary_test("fast::pow", [&](half x, half y) { return ulps(half_float::fast::pow(x, y), pow(x, y)) <= 1; });
+		binary_test("fast::atan2", [&](half x, half y) { return ulps(half_float::fast::atan2(x, y), atan2(x, y)) <= 1; });
+		binary_test("fast::hypot", [&](half x, half y) { return ulps(half_float::fast::hypot(x, y), hypot(x, y)) <= 1; });
+
+		//test accuracy tiers
+		#define ACCURACY_TEST(func) unary_test(#func "<accuracy>", [&](half arg) { using namespace half_float; return ulps(tiered::func<accuracy_exact>(arg), func(arg)) == 0 && \
+			ulps(tiered::func<accuracy_ulp1>(arg), func(arg)) <= 1 && ulps(tiered::func<accuracy_ulp2>(arg), func(arg)) <= 2 && \
+			ulps(tiered::func<accuracy_ulp8>(arg), func(arg)) <= 8; })
+		ACCURACY_TEST(exp);
+		ACCURACY_TEST(exp2);
+		ACCURACY_TEST(log);
+		ACCURACY_TEST(log10);
+		ACCURACY_TEST(log2);
+		ACCURACY_TEST(sin);
+		ACCURACY_TEST(cos);
+		ACCURACY_TEST(tan);
+		ACCURACY_TEST(asin);
+		ACCURACY_TEST(acos);
+		ACCURACY_TEST(atan);
+		ACCURACY_TEST(sinh);
+		ACCURACY_TEST(cosh);
+		ACCURACY_TEST(tanh);
+		#undef ACCURACY_TEST
+		unary_test("sincos<accuracy>", [&](half arg) -> bool { half s, c, s8, c8; sincos(arg, &s, &c); half_float::tiered::sincos<half_float::accuracy_ulp8>(arg, &s8, &c8); 
+			return ulps(s8, s) <= 8 && ulps(c8, c) <= 8; });
+
 		unary_test("rsqrt", [](half arg) { half a = rsqrt(arg), b = half(1.0f) / sqrt(arg), c = half_cast<half>(1.0/sqrt(half_cast<double>(arg)));
 			return comp(a, b) || std::abs(h2b(a)-h2b(c)) <= std::abs(h2b(b)-h2b(c)); });
+		unary_test("recip", [](half arg) { return comp(recip(arg), half(1.0f)/arg); });
 
 	#if HALF_ENABLE_CPP11_CMATH
 		//test binary functions